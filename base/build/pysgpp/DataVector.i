@@ -25,6 +25,7 @@ namespace base
 {
 
 %apply double *OUTPUT { double* min, double* max };
+%apply double& OUTPUT { double& squaredNorm };
 %apply std::string *OUTPUT { std::string& text };
 
 %rename(assign) DataVector::operator=;
@@ -99,8 +100,12 @@ $1 = PySequence_Check($input) ? 1 : 0;
   double RMSNorm() const;
   double l2Norm() const;
   double dotProduct(const DataVector& vec) const;
+  double dotProductWithNorm(const DataVector& vec, double& squaredNorm) const;
   
   void axpy(double alpha, DataVector& x);
+  void axpy(double a, const DataVector& x, double b, const DataVector& y);
+  double axpyDot(double a, const DataVector& x);
+  void xpay(double a, const DataVector& x);
   
   size_t getSize() const;
   size_t getNumberNonZero() const;
@@ -8,6 +8,7 @@
 
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataVectorView.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBoundaryBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearStretchedBoundaryBasis.hpp>
 
@@ -66,12 +67,12 @@ class AlgorithmEvaluation {
    * \f[ \sum_{r\in\mathbf{result}} \alpha[r\rightarrow\mathbf{first}] \cdot r\rightarrow\mathbf{second}. \f]
    *
    * @param basis a sparse grid basis
-   * @param point evaluation point within the domain
+   * @param point evaluation point within the domain (e.g., a DataVector or a row of a DataMatrix)
    * @param alpha the sparse grid's coefficients
    *
    * @result result result of the function evaluation
    */
-  double operator()(BASIS& basis, const DataVector& point, const DataVector& alpha) {
+  double operator()(BASIS& basis, ConstDataVectorView point, const DataVector& alpha) {
     GridStorage::grid_iterator working(storage);
 
     const size_t bits = sizeof(index_t) * 8;  // how many levels can we store in a index_type?
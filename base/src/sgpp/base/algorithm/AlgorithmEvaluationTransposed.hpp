@@ -8,6 +8,7 @@
 
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataVectorView.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBoundaryBasis.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -41,11 +42,11 @@ class AlgorithmEvaluationTransposed {
    * \f[ \sum_{r\in\mathbf{result}} \alpha[r\rightarrow\mathbf{first}] \cdot r\rightarrow\mathbf{second}. \f]
    *
    * @param basis a sparse grid basis
-   * @param point evaluation point within the domain
+   * @param point evaluation point within the domain (e.g., a DataVector or a row of a DataMatrix)
    * @param alpha the coefficient of the regarded ansatzfunction
    * @param result vector that will contain the local support of the given ansatzfuction for all evaluations points
    */
-  void operator()(BASIS& basis, const DataVector& point, double alpha, DataVector& result) {
+  void operator()(BASIS& basis, ConstDataVectorView point, double alpha, DataVector& result) {
     GridStorage::grid_iterator working(storage);
 
     const size_t bits = sizeof(index_t) * 8;  // how many levels can we store in a index_type?
@@ -0,0 +1,303 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef ALGORITHMHIERARCHICALDESCENT_HPP
+#define ALGORITHMHIERARCHICALDESCENT_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineModifiedBasis.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Describes the supports of the basis functions of a 1D basis for
+ * AlgorithmHierarchicalDescent. Has to be specialized for every basis:
+ *
+ * - getSupportRadius(basis) returns r such that the support of the basis function
+ *   of level l and index i (if it is not a modified boundary function) is contained in
+ *   \f$[(i - r) h_l, (i + r) h_l]\f$. It must hold \f$r \ge 1\f$, such that the support
+ *   of a basis function is contained in the support of its hierarchical parent.
+ * - modified states whether the basis functions of level 1 are constant and
+ *   the outermost basis functions of the other levels are extended to the boundary.
+ *
+ * @tparam BASIS 1D basis
+ */
+template <class BASIS>
+struct HierarchicalDescentSupport;
+
+/**
+ * Support of B-splines: degree p touches (p+1)/2 neighbors per level.
+ */
+template <class LT, class IT>
+struct HierarchicalDescentSupport<BsplineBasis<LT, IT>> {
+  static const bool modified = false;
+
+  static double getSupportRadius(BsplineBasis<LT, IT>& basis) {
+    return static_cast<double>(basis.getDegree() + 1) / 2.0;
+  }
+};
+
+/**
+ * Support of modified B-splines: like B-splines, but the outermost basis functions
+ * are extended to the boundary.
+ */
+template <class LT, class IT>
+struct HierarchicalDescentSupport<BsplineModifiedBasis<LT, IT>> {
+  static const bool modified = true;
+
+  static double getSupportRadius(BsplineModifiedBasis<LT, IT>& basis) {
+    return static_cast<double>(basis.getDegree() + 1) / 2.0;
+  }
+};
+
+/**
+ * Support-aware evaluation of sparse grid functions whose basis functions have compact,
+ * but wider support than the hat functions (e.g., B-splines). This generalizes the descent
+ * of AlgorithmEvaluation, which follows exactly one path per dimension.
+ *
+ * In every dimension, the basis functions which may be non-zero at the evaluation point
+ * form a subtree of the 1D hierarchy, since the support of every basis function is contained
+ * in the support of its parent. The descent enumerates this subtree level by level
+ * (about r indices per level), looks the points up in the storage, and only descends
+ * below the points that exist (the parents of all grid points exist in valid grids).
+ * The 1D basis functions (and derivatives) are evaluated once per evaluation point and
+ * reused for all grid points. This way, evaluating takes about
+ * \f$\mathcal{O}((n r)^d)\f$ lookups for n levels instead of \f$\mathcal{O}(N)\f$.
+ *
+ * @tparam BASIS 1D basis (HierarchicalDescentSupport has to be specialized for it)
+ */
+template <class BASIS>
+class AlgorithmHierarchicalDescent {
+ public:
+  /**
+   * 1D basis function that may be non-zero at the evaluation point.
+   */
+  struct Entry {
+    /// level
+    level_t level;
+    /// index
+    index_t index;
+    /// value of the basis function at the evaluation point
+    double value;
+    /// value of the first derivative (only if requested)
+    double dx;
+    /// value of the second derivative (only if requested)
+    double dxdx;
+    /// position of the first child in the list of entries
+    size_t firstChild;
+    /// number of children (valid only if childrenGenerated is true)
+    size_t numberOfChildren;
+    /// whether the children have been generated
+    bool childrenGenerated;
+  };
+
+  /**
+   * Constructor.
+   *
+   * @param storage   storage of the sparse grid
+   * @param basis     1D basis
+   */
+  AlgorithmHierarchicalDescent(GridStorage& storage, BASIS& basis)
+      : storage(storage),
+        basis(basis),
+        dim(storage.getDimension()),
+        point(storage.getDimension()),
+        pointInUnitCube(nullptr),
+        derivativeOrder(0),
+        supportRadius(HierarchicalDescentSupport<BASIS>::getSupportRadius(basis)),
+        entries(storage.getDimension()),
+        stacks(storage.getDimension()),
+        factors(storage.getDimension()) {}
+
+  /**
+   * Calls visitor(seq, factors) for all grid points whose basis function may be non-zero
+   * at the given point, where factors[t] points to the Entry of the 1D basis function
+   * in dimension t.
+   *
+   * @param pointInUnitCube   evaluation point in the unit cube
+   * @param derivativeOrder   0 to evaluate only the 1D basis functions, 1 to evaluate
+   *                          the first derivatives, too, 2 to evaluate also the second ones
+   * @param visitor           functor
+   */
+  template <class VISITOR>
+  void operator()(const DataVector& pointInUnitCube, size_t derivativeOrder,
+                  VISITOR& visitor) {
+    this->pointInUnitCube = &pointInUnitCube;
+    this->derivativeOrder = derivativeOrder;
+
+    if (storage.getSize() == 0) {
+      return;
+    }
+
+    for (size_t t = 0; t < dim; t++) {
+      entries[t].clear();
+      point.set(t, 1, 1);
+
+      // level 1 (the support of its basis function always contains the evaluation point,
+      // since the support radius is at least 1)
+      appendEntry(t, 1, 1);
+    }
+
+    rec(0, visitor);
+  }
+
+ protected:
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// 1D basis
+  BASIS& basis;
+  /// dimensionality
+  size_t dim;
+  /// grid point used for the lookups
+  GridPoint point;
+  /// current evaluation point
+  const DataVector* pointInUnitCube;
+  /// current derivative order
+  size_t derivativeOrder;
+  /// support radius of the basis functions in mesh widths
+  double supportRadius;
+  /// per dimension: entries of the 1D basis functions in the order of generation
+  std::vector<std::vector<Entry>> entries;
+  /// per dimension: stack of positions of entries for the depth-first traversal
+  std::vector<std::vector<size_t>> stacks;
+  /// current 1D factors (one per dimension)
+  std::vector<const Entry*> factors;
+
+  /**
+   * @param t dimension
+   * @param l level
+   * @param i index
+   * @return  whether the support of the basis function may contain the evaluation point
+   */
+  bool isCandidate(size_t t, level_t l, index_t i) const {
+    const index_t hInv = static_cast<index_t>(1) << l;
+    const double x = (*pointInUnitCube)[t] * static_cast<double>(hInv);
+
+    if (HierarchicalDescentSupport<BASIS>::modified) {
+      if (i == 1) {
+        return (x <= 1.0 + supportRadius);
+      } else if (i == hInv - 1) {
+        return (x >= static_cast<double>(hInv - 1) - supportRadius);
+      }
+    }
+
+    return (std::abs(x - static_cast<double>(i)) <= supportRadius);
+  }
+
+  /**
+   * Appends an entry for a 1D basis function and evaluates it.
+   *
+   * @param t dimension
+   * @param l level
+   * @param i index
+   */
+  void appendEntry(size_t t, level_t l, index_t i) {
+    const double x = (*pointInUnitCube)[t];
+    Entry entry;
+    entry.level = l;
+    entry.index = i;
+    entry.value = basis.eval(l, i, x);
+    entry.dx = (derivativeOrder >= 1) ? basis.evalDx(l, i, x) : 0.0;
+    entry.dxdx = (derivativeOrder >= 2) ? basis.evalDxDx(l, i, x) : 0.0;
+    entry.firstChild = 0;
+    entry.numberOfChildren = 0;
+    entry.childrenGenerated = false;
+    entries[t].push_back(entry);
+  }
+
+  /**
+   * Generates the entries of the children of an entry, if this has not happened yet.
+   *
+   * @param t         dimension
+   * @param position  position of the entry
+   */
+  void generateChildren(size_t t, size_t position) {
+    if (entries[t][position].childrenGenerated) {
+      return;
+    }
+
+    const level_t l = entries[t][position].level + 1;
+    const index_t i = entries[t][position].index;
+    const size_t firstChild = entries[t].size();
+
+    if (isCandidate(t, l, 2 * i - 1)) {
+      appendEntry(t, l, 2 * i - 1);
+    }
+
+    if (isCandidate(t, l, 2 * i + 1)) {
+      appendEntry(t, l, 2 * i + 1);
+    }
+
+    // appendEntry may have reallocated the entries
+    Entry& entry = entries[t][position];
+    entry.firstChild = firstChild;
+    entry.numberOfChildren = entries[t].size() - firstChild;
+    entry.childrenGenerated = true;
+  }
+
+  /**
+   * Depth-first traversal of the candidates in dimension t.
+   *
+   * @param t       dimension
+   * @param visitor functor
+   */
+  template <class VISITOR>
+  void rec(size_t t, VISITOR& visitor) {
+    // the maximal level that fits into the index type
+    const level_t maxLevel = static_cast<level_t>(sizeof(index_t) * 8 - 1);
+    std::vector<size_t>& stack = stacks[t];
+    stack.clear();
+    stack.push_back(0);
+
+    while (!stack.empty()) {
+      const size_t position = stack.back();
+      stack.pop_back();
+
+      const level_t l = entries[t][position].level;
+      point.set(t, l, entries[t][position].index);
+      const size_t seq = storage.getSequenceNumber(point);
+
+      if (storage.isInvalidSequenceNumber(seq)) {
+        // then, the descendants of the point don't exist, either
+        continue;
+      }
+
+      // the recursion only generates entries of the other dimensions,
+      // so the pointer stays valid until the children are generated below
+      factors[t] = &entries[t][position];
+
+      if (t == dim - 1) {
+        visitor(seq, factors);
+      } else {
+        rec(t + 1, visitor);
+      }
+
+      if (l < maxLevel) {
+        generateChildren(t, position);
+        const Entry& entry = entries[t][position];
+
+        for (size_t k = 0; k < entry.numberOfChildren; k++) {
+          stack.push_back(entry.firstChild + k);
+        }
+      }
+    }
+
+    point.set(t, 1, 1);
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* ALGORITHMHIERARCHICALDESCENT_HPP */
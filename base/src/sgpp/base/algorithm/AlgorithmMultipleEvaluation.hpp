@@ -53,15 +53,12 @@ class AlgorithmMultipleEvaluation {
     {
       DataVector privateResult(result.getSize());
 
-      DataVector line(x.getNcols());
       AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
 
 #pragma omp for schedule(static)
 
       for (size_t i = 0; i < source_size; i++) {
-        x.getRow(i, line);
-
-        AlgoEvalTrans(basis, line, source[i], privateResult);
+        AlgoEvalTrans(basis, x.getRowView(i), source[i], privateResult);
       }
 
 #pragma omp critical
@@ -109,15 +106,12 @@ class AlgorithmMultipleEvaluation {
 
 #pragma omp parallel
     {
-      DataVector line(x.getNcols());
       AlgorithmEvaluation<BASIS> AlgoEval(storage);
 
 #pragma omp for schedule(static)
 
       for (size_t i = 0; i < result_size; i++) {
-        x.getRow(i, line);
-
-        result[i] = AlgoEval(basis, line, source);
+        result[i] = AlgoEval(basis, x.getRowView(i), source);
       }
     }
   }
@@ -0,0 +1,166 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/algorithm/PoleBatch.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+const size_t PoleBatch::lanes;
+const level_t PoleBatch::maxDepth;
+const size_t PoleBatch::npos;
+
+PoleBatch::PoleBatch(GridStorage& storage, size_t dim)
+    : storage(storage), dim(dim), depths(), offsets(), seqs(), skippedPoles() {}
+
+void PoleBatch::gather(const size_t* poles, size_t numPoles) {
+  depths.clear();
+  offsets.clear();
+  seqs.clear();
+  skippedPoles.clear();
+
+  // points of the poles in heap order
+  std::vector<std::vector<size_t>> heaps(numPoles, std::vector<size_t>(2, npos));
+  std::vector<level_t> poleDepths(numPoles, 1);
+  std::vector<bool> skipped(numPoles, false);
+
+  // the poles are traversed level by level, such that the children of all points
+  // of a level can be looked up at once
+  std::vector<size_t> frontierPoles;
+  std::vector<size_t> frontierPositions;
+  std::vector<size_t> frontierSeqs;
+
+  for (size_t k = 0; k < numPoles; k++) {
+    heaps[k][1] = poles[k];
+
+    if (!storage.getPoint(poles[k]).isLeaf()) {
+      frontierPoles.push_back(k);
+      frontierPositions.push_back(1);
+      frontierSeqs.push_back(poles[k]);
+    }
+  }
+
+  std::vector<size_t> leftChildren;
+  std::vector<size_t> rightChildren;
+  std::vector<size_t> nextPoles;
+  std::vector<size_t> nextPositions;
+  std::vector<size_t> nextSeqs;
+
+  for (level_t level = 1; !frontierSeqs.empty(); level++) {
+    storage.getChildSequenceNumbers(frontierSeqs, dim, leftChildren, rightChildren);
+    nextPoles.clear();
+    nextPositions.clear();
+    nextSeqs.clear();
+
+    for (size_t j = 0; j < frontierSeqs.size(); j++) {
+      const size_t k = frontierPoles[j];
+
+      if (skipped[k]) {
+        continue;
+      }
+
+      for (size_t side = 0; side < 2; side++) {
+        const size_t seq = (side == 0) ? leftChildren[j] : rightChildren[j];
+
+        if (seq >= storage.getSize()) {
+          continue;
+        }
+
+        if (level + 1 > maxDepth) {
+          skipped[k] = true;
+          break;
+        }
+
+        const size_t position = 2 * frontierPositions[j] + side;
+
+        if (heaps[k].size() <= position) {
+          heaps[k].resize(static_cast<size_t>(1) << (level + 1), npos);
+        }
+
+        heaps[k][position] = seq;
+        poleDepths[k] = level + 1;
+
+        if (!storage.getPoint(seq).isLeaf()) {
+          nextPoles.push_back(k);
+          nextPositions.push_back(position);
+          nextSeqs.push_back(seq);
+        }
+      }
+    }
+
+    frontierPoles.swap(nextPoles);
+    frontierPositions.swap(nextPositions);
+    frontierSeqs.swap(nextSeqs);
+  }
+
+  // sort the poles by depth, such that the poles of a batch have (almost) the same depth
+  std::vector<size_t> order;
+
+  for (size_t k = 0; k < numPoles; k++) {
+    if (skipped[k]) {
+      skippedPoles.push_back(poles[k]);
+    } else {
+      order.push_back(k);
+    }
+  }
+
+  std::stable_sort(order.begin(), order.end(),
+                   [&poleDepths](size_t a, size_t b) { return poleDepths[a] < poleDepths[b]; });
+
+  for (size_t start = 0; start < order.size(); start += lanes) {
+    const size_t count = std::min(lanes, order.size() - start);
+    const level_t depth = poleDepths[order[start + count - 1]];
+    const size_t numPositions = static_cast<size_t>(1) << depth;
+    const size_t offset = seqs.size();
+
+    depths.push_back(depth);
+    offsets.push_back(offset);
+    seqs.resize(offset + numPositions * lanes, npos);
+
+    for (size_t k = 0; k < count; k++) {
+      const std::vector<size_t>& heap = heaps[order[start + k]];
+
+      for (size_t p = 1; p < heap.size(); p++) {
+        seqs[offset + p * lanes + k] = heap[p];
+      }
+    }
+  }
+}
+
+size_t PoleBatch::getNumberOfBatches() const { return depths.size(); }
+
+level_t PoleBatch::getDepth(size_t batch) const { return depths[batch]; }
+
+size_t PoleBatch::getBufferSize(size_t batch) const {
+  return (static_cast<size_t>(1) << depths[batch]) * lanes;
+}
+
+void PoleBatch::load(size_t batch, const DataVector& source, double* values) const {
+  const size_t* batchSeqs = &seqs[offsets[batch]];
+  const size_t size = getBufferSize(batch);
+
+  for (size_t j = 0; j < size; j++) {
+    values[j] = (batchSeqs[j] == npos) ? 0.0 : source[batchSeqs[j]];
+  }
+}
+
+void PoleBatch::store(size_t batch, const double* values, DataVector& result) const {
+  const size_t* batchSeqs = &seqs[offsets[batch]];
+  const size_t size = getBufferSize(batch);
+
+  for (size_t j = 0; j < size; j++) {
+    if (batchSeqs[j] != npos) {
+      result[batchSeqs[j]] = values[j];
+    }
+  }
+}
+
+const std::vector<size_t>& PoleBatch::getSkippedPoles() const { return skippedPoles; }
+
+}  // namespace base
+}  // namespace sgpp
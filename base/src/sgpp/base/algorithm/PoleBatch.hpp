@@ -0,0 +1,122 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef POLEBATCH_HPP
+#define POLEBATCH_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Gathers several 1D poles of a sweep into dense buffers, such that 1D kernels can
+ * process them as a stream instead of hopping through the grid with a grid iterator.
+ *
+ * The points of a pole are stored in heap order: the root (level 1, index 1) of the
+ * pole has the position 1, and the children of position p are at the positions 2p and 2p+1.
+ * Hence, position p always corresponds to the same level and index in the sweep dimension.
+ * The poles are sorted by depth and grouped into batches of "lanes" poles each.
+ * In the buffers of a batch, the values of the poles are interleaved
+ * (buffer[p * lanes + k] belongs to pole k), so that a kernel processes the poles
+ * of the batch in its innermost (vectorizable) loop with the same level and index.
+ *
+ * Only poles without boundary points (as visited by sweep::sweep1D) are supported.
+ * The poles are traversed like the recursive functors do it: the children of a point are only
+ * visited if the point is not marked as a leaf.
+ */
+class PoleBatch {
+ public:
+  /// number of poles per batch
+  static const size_t lanes = 8;
+  /// maximal depth of poles that are gathered (deeper poles are skipped)
+  static const level_t maxDepth = 12;
+  /// position of points that aren't contained in the pole
+  static const size_t npos = static_cast<size_t>(-1);
+
+  /**
+   * Constructor
+   *
+   * @param storage the grid storage
+   * @param dim     the sweep dimension
+   */
+  PoleBatch(GridStorage& storage, size_t dim);
+
+  /**
+   * Gathers the points of the given poles.
+   *
+   * @param poles    sequence numbers of the starting points (level 1 in the sweep dimension)
+   * @param numPoles number of poles
+   */
+  void gather(const size_t* poles, size_t numPoles);
+
+  /**
+   * @return number of batches
+   */
+  size_t getNumberOfBatches() const;
+
+  /**
+   * @param batch batch
+   * @return depth (maximal level in the sweep dimension) of the poles of the batch
+   */
+  level_t getDepth(size_t batch) const;
+
+  /**
+   * @param batch batch
+   * @return number of entries of the buffers of the batch, i.e., 2^depth * lanes
+   */
+  size_t getBufferSize(size_t batch) const;
+
+  /**
+   * Reads the values of the poles of a batch from a vector.
+   * Positions not contained in a pole are set to zero.
+   *
+   * @param      batch  batch
+   * @param      source values of all grid points
+   * @param[out] values buffer of getBufferSize(batch) entries
+   */
+  void load(size_t batch, const DataVector& source, double* values) const;
+
+  /**
+   * Writes the values of the poles of a batch to a vector.
+   * Positions not contained in a pole are not written.
+   *
+   * @param      batch  batch
+   * @param      values buffer of getBufferSize(batch) entries
+   * @param[out] result values of all grid points
+   */
+  void store(size_t batch, const double* values, DataVector& result) const;
+
+  /**
+   * @return sequence numbers of the starting points of poles that are deeper than maxDepth
+   *         and have to be processed otherwise
+   */
+  const std::vector<size_t>& getSkippedPoles() const;
+
+ private:
+  /// the grid storage
+  GridStorage& storage;
+  /// the sweep dimension
+  size_t dim;
+  /// depths of the batches
+  std::vector<level_t> depths;
+  /// offsets of the batches in seqs
+  std::vector<size_t> offsets;
+  /// sequence numbers of the points of all batches (npos for missing points)
+  std::vector<size_t> seqs;
+  /// starting points of skipped poles
+  std::vector<size_t> skippedPoles;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* POLEBATCH_HPP */
@@ -11,19 +11,45 @@
 
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
 #include <vector>
 #include <utility>
 #include <iostream>
+#include <type_traits>
 
 
 namespace sgpp {
 namespace base {
 
+/**
+ * Traits of the functors used by sweep.
+ * By default, the 1D poles of a sweep are processed in parallel, each thread working with its
+ * own copy of the functor. Functors that write to shared state other than the result coefficients
+ * of their pole have to specialize this template with parallel = false.
+ */
+template<class FUNC>
+struct sweep_traits {
+  /// whether the poles of a sweep with FUNC may be processed in parallel
+  static const bool parallel = true;
+  /// whether FUNC provides processPoles(source, result, poles, numPoles, dim), which processes
+  /// several poles without boundaries at once (see PoleBatch), used by sweep1D for DataVectors
+  static const bool batched = false;
+};
+
 /**
  * Standard sweep operation
  * FUNC should be a class with overwritten operator(). For an example see laplace_up_functor in laplace.hpp.
  * It must be default constructable or copyable.
  * STORAGE must provide a grid_iterator supporting left_child, step_right, up, hint and seq.
+ *
+ * For a fixed sweep dimension, the functor is called once per 1D pole, and the poles are
+ * independent of each other. If OpenMP is enabled and the grid is large enough, the starting
+ * points of the poles are collected first and then distributed among the threads.
+ * Functors marked as batched in sweep_traits get whole chunks of poles at once.
  */
 template<class FUNC>
 class sweep {
@@ -39,6 +65,11 @@ class sweep {
   /// number of algorithmic dimensions
   const size_t numAlgoDims_;
 
+  /// minimal number of grid points for processing the poles in parallel
+  static const size_t minParallelGridSize = 4096;
+  /// number of poles that are handed to a thread at once
+  static const size_t poleChunkSize = 64;
+
  public:
   /**
    * Create a new sweep object with a default constructed functor
@@ -89,7 +120,14 @@ class sweep {
 
     grid_iterator index(storage);
 
-    sweep_rec(source, result, index, dim_list, storage.getDimension() - 1, dim_sweep);
+    if (sweep_traits<FUNC>::batched || useParallelSweep()) {
+      std::vector<size_t> poles;
+      collect_rec(index, dim_list, storage.getDimension() - 1, poles);
+      sweep_poles(source, result, poles, dim_sweep,
+                  std::integral_constant<bool, sweep_traits<FUNC>::batched>());
+    } else {
+      sweep_rec(source, result, index, dim_list, storage.getDimension() - 1, dim_sweep);
+    }
   }
 
   /**
@@ -113,8 +151,14 @@ class sweep {
 
     grid_iterator index(storage);
 
-    sweep_rec(source, result, index, dim_list, this->numAlgoDims_ - 1,
-              dim_sweep);
+    if (useParallelSweep()) {
+      std::vector<size_t> poles;
+      collect_rec(index, dim_list, this->numAlgoDims_ - 1, poles);
+      sweep_poles(source, result, poles, dim_sweep, std::false_type());
+    } else {
+      sweep_rec(source, result, index, dim_list, this->numAlgoDims_ - 1,
+                dim_sweep);
+    }
   }
 
   /**
@@ -140,8 +184,15 @@ class sweep {
     grid_iterator index(storage);
     index.resetToLevelZero();
 
-    sweep_Boundary_rec(source, result, index, dim_list, storage.getDimension() - 1,
-                       dim_sweep);
+    if (useParallelSweep()) {
+      std::vector<size_t> poles;
+      collect_Boundary_rec(source, result, index, dim_list, storage.getDimension() - 1,
+                           dim_sweep, poles);
+      sweep_poles(source, result, poles, dim_sweep, std::false_type());
+    } else {
+      sweep_Boundary_rec(source, result, index, dim_list, storage.getDimension() - 1,
+                         dim_sweep);
+    }
   }
 
 
@@ -168,11 +219,194 @@ class sweep {
     grid_iterator index(storage);
     index.resetToLevelZero();
 
-    sweep_Boundary_rec(source, result, index, dim_list, storage.getDimension() - 1,
-                       dim_sweep);
+    if (useParallelSweep()) {
+      std::vector<size_t> poles;
+      collect_Boundary_rec(source, result, index, dim_list, storage.getDimension() - 1,
+                           dim_sweep, poles);
+      sweep_poles(source, result, poles, dim_sweep, std::false_type());
+    } else {
+      sweep_Boundary_rec(source, result, index, dim_list, storage.getDimension() - 1,
+                         dim_sweep);
+    }
   }
 
  protected:
+  /**
+   * @return whether the poles should be processed in parallel
+   */
+  bool useParallelSweep() const {
+#ifdef _OPENMP
+    // nested calls (e.g., from the OpenMP tasks of the UpDown operators) stay sequential
+    return sweep_traits<FUNC>::parallel && !omp_in_parallel() &&
+           (omp_get_max_threads() > 1) && (storage.getSize() >= minParallelGridSize);
+#else
+    return false;
+#endif
+  }
+
+  /**
+   * Calls the functor for all given poles, in parallel if useParallelSweep() holds.
+   * Every thread works with its own copy of the functor and its own grid iterator.
+   *
+   * @param source coefficients of the sparse grid (DataVector or DataMatrix)
+   * @param result coefficients of the function computed by sweep
+   * @param poles sequence numbers of the starting points of the poles
+   * @param dim_sweep static dimension, in this dimension the functor is executed
+   * @param batched std::true_type if the poles are handed to FUNC::processPoles
+   */
+  template<class DATA, class BATCHED>
+  void sweep_poles(DATA& source, DATA& result, const std::vector<size_t>& poles,
+                   size_t dim_sweep, BATCHED batched) {
+    #pragma omp parallel if (useParallelSweep())
+    {
+      FUNC localFunctor(functor);
+      grid_iterator index(storage);
+
+      // the poles differ in length, so distribute them dynamically
+      #pragma omp for schedule(dynamic)
+      for (size_t start = 0; start < poles.size(); start += poleChunkSize) {
+        const size_t count = std::min(poleChunkSize, poles.size() - start);
+        process_poles(localFunctor, source, result, index, &poles[start], count, dim_sweep,
+                      batched);
+      }
+    }
+  }
+
+  /**
+   * Calls the functor for each of the given poles.
+   */
+  template<class DATA>
+  void process_poles(FUNC& localFunctor, DATA& source, DATA& result, grid_iterator& index,
+                     const size_t* poles, size_t count, size_t dim_sweep, std::false_type) {
+    for (size_t k = 0; k < count; k++) {
+      index.set(storage.getPoint(poles[k]));
+      localFunctor(source, result, index, dim_sweep);
+    }
+  }
+
+  /**
+   * Hands the given poles to the functor at once.
+   */
+  template<class DATA>
+  void process_poles(FUNC& localFunctor, DATA& source, DATA& result, grid_iterator&,
+                     const size_t* poles, size_t count, size_t dim_sweep, std::true_type) {
+    localFunctor.processPoles(source, result, poles, count, dim_sweep);
+  }
+
+  /**
+   * Collects the starting points of the poles visited by sweep_rec.
+   *
+   * @param index current grid position
+   * @param dim_list list of dimensions, that should be handled
+   * @param dim_rem number of remaining dims
+   * @param poles sequence numbers of the starting points of the poles
+   */
+  void collect_rec(grid_iterator& index, std::vector<size_t>& dim_list, size_t dim_rem,
+                   std::vector<size_t>& poles) {
+    poles.push_back(index.seq());
+
+    // dimension recursion unrolled
+    for (size_t d = 0; d < dim_rem; d++) {
+      size_t current_dim = dim_list[d];
+
+      if (index.hint()) {
+        continue;
+      }
+
+      index.leftChild(current_dim);
+
+      if (!storage.isInvalidSequenceNumber(index.seq())) {
+        collect_rec(index, dim_list, d + 1, poles);
+      }
+
+      index.stepRight(current_dim);
+
+      if (!storage.isInvalidSequenceNumber(index.seq())) {
+        collect_rec(index, dim_list, d + 1, poles);
+      }
+
+      index.up(current_dim);
+    }
+  }
+
+  /**
+   * Collects the starting points of the poles visited by sweep_Boundary_rec.
+   * Poles starting at a point that is not contained in the grid (e.g., a missing
+   * boundary point) are processed right away, as they can't be referred to by
+   * a sequence number.
+   *
+   * @param source coefficients of the sparse grid (DataVector or DataMatrix)
+   * @param result coefficients of the function computed by sweep
+   * @param index current grid position
+   * @param dim_list list of dimensions, that should be handled
+   * @param dim_rem number of remaining dims
+   * @param dim_sweep static dimension, in this dimension the functor is executed
+   * @param poles sequence numbers of the starting points of the poles
+   */
+  template<class DATA>
+  void collect_Boundary_rec(DATA& source, DATA& result, grid_iterator& index,
+                            std::vector<size_t>& dim_list, size_t dim_rem,
+                            size_t dim_sweep, std::vector<size_t>& poles) {
+    if (dim_rem == 0) {
+      if (storage.isInvalidSequenceNumber(index.seq())) {
+        functor(source, result, index, dim_sweep);
+      } else {
+        poles.push_back(index.seq());
+      }
+    } else {
+      typedef level_t level_type;
+      typedef index_t index_type;
+
+      level_type current_level;
+      index_type current_index;
+
+      index.get(dim_list[dim_rem - 1], current_level, current_index);
+
+      // handle level greater zero
+      if (current_level > 0) {
+        // given current point to next dim
+        collect_Boundary_rec(source, result, index, dim_list, dim_rem - 1, dim_sweep,
+                             poles);
+
+        if (!index.hint()) {
+          index.leftChild(dim_list[dim_rem - 1]);
+
+          if (!storage.isInvalidSequenceNumber(index.seq())) {
+            collect_Boundary_rec(source, result, index, dim_list, dim_rem, dim_sweep,
+                                 poles);
+          }
+
+          index.stepRight(dim_list[dim_rem - 1]);
+
+          if (!storage.isInvalidSequenceNumber(index.seq())) {
+            collect_Boundary_rec(source, result, index, dim_list, dim_rem, dim_sweep,
+                                 poles);
+          }
+
+          index.up(dim_list[dim_rem - 1]);
+        }
+      } else {  // handle level zero
+        collect_Boundary_rec(source, result, index, dim_list, dim_rem - 1, dim_sweep,
+                             poles);
+
+        index.resetToRightLevelZero(dim_list[dim_rem - 1]);
+        collect_Boundary_rec(source, result, index, dim_list, dim_rem - 1, dim_sweep,
+                             poles);
+
+        if (!index.hint()) {
+          index.resetToLevelOne(dim_list[dim_rem - 1]);
+
+          if (!storage.isInvalidSequenceNumber(index.seq())) {
+            collect_Boundary_rec(source, result, index, dim_list, dim_rem, dim_sweep,
+                                 poles);
+          }
+        }
+
+        index.resetToLeftLevelZero(dim_list[dim_rem - 1]);
+      }
+    }
+  }
+
   /**
    * Descends on all dimensions beside dim_sweep. Class functor for dim_sweep.
    * Boundaries are not regarded
@@ -396,6 +630,12 @@ class sweep {
   }
 };
 
+template<class FUNC>
+const size_t sweep<FUNC>::minParallelGridSize;
+
+template<class FUNC>
+const size_t sweep<FUNC>::poleChunkSize;
+
 }  // namespace base
 }  // namespace sgpp
 
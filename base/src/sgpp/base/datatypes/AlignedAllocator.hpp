@@ -0,0 +1,96 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef ALIGNEDALLOCATOR_HPP
+#define ALIGNEDALLOCATOR_HPP
+
+#include <sgpp/base/datatypes/MemoryArena.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Allocator of DataVector and DataMatrix.
+ * The memory is taken from the MemoryArena responsible for the size of the allocation
+ * and is always aligned to MemoryArena::alignment (64) bytes, so SIMD kernels may use
+ * aligned loads on the beginning of the data.
+ *
+ * The allocator is stateless: every allocation is prefixed by one alignment block that
+ * records the arena, such that the memory can be freed by any instance of the allocator.
+ *
+ * @tparam T value type
+ */
+template <class T>
+class AlignedAllocator {
+ public:
+  typedef T value_type;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+
+  template <class U>
+  struct rebind {
+    typedef AlignedAllocator<U> other;
+  };
+
+  AlignedAllocator() {}
+
+  template <class U>
+  AlignedAllocator(const AlignedAllocator<U>&) {}
+
+  /**
+   * @param n number of elements
+   * @return memory for n elements, aligned to MemoryArena::alignment bytes
+   */
+  T* allocate(size_t n) {
+    if (n > (std::numeric_limits<size_t>::max() - MemoryArena::alignment) / sizeof(T)) {
+      throw std::bad_alloc();
+    }
+
+    const size_t bytes = n * sizeof(T) + MemoryArena::alignment;
+    MemoryArena& arena = MemoryArena::getArena(bytes);
+    char* block = static_cast<char*>(arena.allocate(bytes));
+    *reinterpret_cast<MemoryArena**>(block) = &arena;
+    return reinterpret_cast<T*>(block + MemoryArena::alignment);
+  }
+
+  /**
+   * @param p memory returned by allocate
+   * @param n number of elements passed to allocate
+   */
+  void deallocate(T* p, size_t n) {
+    char* block = reinterpret_cast<char*>(p) - MemoryArena::alignment;
+    MemoryArena* arena = *reinterpret_cast<MemoryArena**>(block);
+    arena->deallocate(block, n * sizeof(T) + MemoryArena::alignment);
+  }
+
+  size_t max_size() const {
+    return (std::numeric_limits<size_t>::max() - MemoryArena::alignment) / sizeof(T);
+  }
+};
+
+template <class T, class U>
+bool operator==(const AlignedAllocator<T>&, const AlignedAllocator<U>&) {
+  return true;
+}
+
+template <class T, class U>
+bool operator!=(const AlignedAllocator<T>&, const AlignedAllocator<U>&) {
+  return false;
+}
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* ALIGNEDALLOCATOR_HPP */
@@ -30,13 +30,24 @@ DataMatrix::DataMatrix(size_t nrows, size_t ncols, double value) : nrows(nrows),
 }
 
 DataMatrix::DataMatrix(const double* input, size_t nrows, size_t ncols)
-    : std::vector<double>(input, input + nrows * ncols), nrows(nrows), ncols(ncols) {}
+    : std::vector<double, AlignedAllocator<double>>(input, input + nrows * ncols),
+      nrows(nrows),
+      ncols(ncols) {}
 
 DataMatrix::DataMatrix(std::vector<double> input, size_t nrows)
     : DataMatrix(input.data(), nrows, input.size() / nrows) {}
 
+DataMatrix::DataMatrix(ConstDataMatrixView view) : DataMatrix(view.getNrows(), view.getNcols()) {
+  for (size_t i = 0; i < nrows; i++) {
+    std::copy(view.getPointer() + i * view.getRowStride(),
+              view.getPointer() + i * view.getRowStride() + ncols, this->data() + i * ncols);
+  }
+}
+
 DataMatrix::DataMatrix(std::initializer_list<double> input, size_t nrows)
-    : std::vector<double>(input), nrows(nrows), ncols(input.size() / nrows) {}
+    : std::vector<double, AlignedAllocator<double>>(input),
+      nrows(nrows),
+      ncols(input.size() / nrows) {}
 
 DataMatrix DataMatrix::fromFile(const std::string& fileName) {
   std::ifstream f(fileName, std::ifstream::in);
@@ -118,7 +129,7 @@ void DataMatrix::resizeRows(size_t nrows) {
     return;
   }
   this->nrows = nrows;
-  this->std::vector<double>::resize(nrows * ncols);
+  this->std::vector<double, AlignedAllocator<double>>::resize(nrows * ncols);
 }
 
 void DataMatrix::resize(size_t nrows, size_t ncols) { this->resizeRowsCols(nrows, ncols); }
@@ -130,7 +141,7 @@ void DataMatrix::resizeRowsCols(size_t nrows, size_t ncols) {
   }
   this->nrows = nrows;
   this->ncols = ncols;
-  this->std::vector<double>::resize(nrows * ncols);
+  this->std::vector<double, AlignedAllocator<double>>::resize(nrows * ncols);
 }
 
 void DataMatrix::resizeQuadratic(size_t size) {
@@ -181,7 +192,7 @@ void DataMatrix::resizeToSubMatrix(size_t row_1, size_t col_1, size_t row_2, siz
   this->ncols = ncols_new;
 
   // free unused memory
-  this->std::vector<double>::resize(this->nrows * this->ncols);
+  this->std::vector<double, AlignedAllocator<double>>::resize(this->nrows * this->ncols);
   this->shrink_to_fit();
 }
 
@@ -317,6 +328,18 @@ void DataMatrix::setRow(size_t row, const DataVector& vec) {
   }
 }
 
+void DataMatrix::setRow(size_t row, ConstDataVectorView vec) {
+  if (vec.getSize() != this->ncols) {
+    throw sgpp::base::data_exception("DataMatrix::setRow : Dimensions do not match");
+  } else if (row >= this->nrows) {
+    throw sgpp::base::data_exception("DataMatrix::setRow : \"row\" out of bounds");
+  }
+
+  for (size_t i = 0; i < this->ncols; ++i) {
+    (*this)[row * ncols + i] = vec[i];
+  }
+}
+
 void DataMatrix::getColumn(size_t col, DataVector& vec) const {
   if (vec.getSize() != this->nrows) {
     throw sgpp::base::data_exception("DataMatrix::getColumn : Dimensions do not match");
@@ -8,6 +8,9 @@
 
 #include <sgpp/base/datatypes/DataVector.hpp>
 
+#include <sgpp/base/datatypes/AlignedAllocator.hpp>
+#include <sgpp/base/datatypes/DataMatrixView.hpp>
+#include <sgpp/base/datatypes/DataVectorView.hpp>
 #include <sgpp/globaldef.hpp>
 
 #include <algorithm>
@@ -24,8 +27,9 @@ namespace base {
  * Thus, typical functionality like obtaining the maximum for a certain dimension (or attribute),
  * or normalizing all data points to the unit interval for a certain dimension are
  * provided.
+ * The data is aligned to 64 bytes (see AlignedAllocator).
  */
-class DataMatrix : public std::vector<double> {
+class DataMatrix : public std::vector<double, AlignedAllocator<double>> {
  public:
   /**
    * Creates an empty two-dimensional DataMatrix.
@@ -106,6 +110,13 @@ class DataMatrix : public std::vector<double> {
    */
   explicit DataMatrix(std::initializer_list<double> input, size_t nrows);
 
+  /**
+   * Create a new DataMatrix from a view by copying its elements.
+   *
+   * @param view view that contains the data
+   */
+  explicit DataMatrix(ConstDataMatrixView view);
+
   static DataMatrix fromFile(const std::string& fileName);
 
   static DataMatrix fromString(const std::string& serializedVector);
@@ -316,6 +327,32 @@ class DataMatrix : public std::vector<double> {
    */
   void setRow(size_t row, const DataVector& vec);
 
+  /**
+   * Sets a row of the DataMatrix to the values of a view, e.g., of a row of another DataMatrix.
+   *
+   * @param row The row which is to be overwritten
+   * @param vec view containing the data of the row
+   */
+  void setRow(size_t row, ConstDataVectorView vec);
+
+  /**
+   * Returns a view of a row without copying.
+   * The view is invalidated if the DataMatrix is resized.
+   *
+   * @param row The row
+   * @return Contiguous view of the row
+   */
+  inline DataVectorView getRowView(size_t row) { return getView().getRow(row); }
+
+  /**
+   * Returns a read-only view of a row without copying.
+   * The view is invalidated if the DataMatrix is resized.
+   *
+   * @param row The row
+   * @return Contiguous read-only view of the row
+   */
+  inline ConstDataVectorView getRowView(size_t row) const { return getView().getRow(row); }
+
   /**
    * Copies the values of a column to the DataVector vec.
    *
@@ -332,6 +369,26 @@ class DataMatrix : public std::vector<double> {
    */
   void setColumn(size_t col, const DataVector& vec);
 
+  /**
+   * Returns a view of a column without copying.
+   * The view is invalidated if the DataMatrix is resized.
+   *
+   * @param col The column
+   * @return Strided view of the column
+   */
+  inline DataVectorView getColumnView(size_t col) { return getView().getColumn(col); }
+
+  /**
+   * Returns a read-only view of a column without copying.
+   * The view is invalidated if the DataMatrix is resized.
+   *
+   * @param col The column
+   * @return Strided read-only view of the column
+   */
+  inline ConstDataVectorView getColumnView(size_t col) const {
+    return getView().getColumn(col);
+  }
+
   /**
    * Adds the values from another DataMatrix to the current values.
    * Modifies the current values.
@@ -504,6 +561,36 @@ class DataMatrix : public std::vector<double> {
    */
   const double* getPointer() const;
 
+  /**
+   * Returns a view of the whole DataMatrix (without the additionally reserved rows).
+   * The view is invalidated if the DataMatrix is resized.
+   *
+   * @return View of the data
+   */
+  inline DataMatrixView getView() { return DataMatrixView(this->data(), nrows, ncols); }
+
+  /**
+   * Returns a read-only view of the whole DataMatrix (without the additionally reserved rows).
+   * The view is invalidated if the DataMatrix is resized.
+   *
+   * @return Read-only view of the data
+   */
+  inline ConstDataMatrixView getView() const {
+    return ConstDataMatrixView(this->data(), nrows, ncols);
+  }
+
+  /**
+   * Implicit conversion to a view, such that DataMatrices can be passed to functions
+   * taking views.
+   */
+  inline operator DataMatrixView() { return getView(); }  // NOLINT(runtime/explicit)
+
+  /**
+   * Implicit conversion to a read-only view, such that DataMatrices can be passed to functions
+   * taking read-only views.
+   */
+  inline operator ConstDataMatrixView() const { return getView(); }  // NOLINT(runtime/explicit)
+
   /**
    * Returns the total number of (used) elements, i.e., getNrows()*getNCols()
    *
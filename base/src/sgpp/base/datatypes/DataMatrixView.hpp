@@ -0,0 +1,163 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef DATAMATRIXVIEW_HPP
+#define DATAMATRIXVIEW_HPP
+
+#include <sgpp/base/datatypes/DataVectorView.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Non-owning view of two-dimensional row-major data, e.g., of a DataMatrix, of a block of
+ * consecutive rows of a DataMatrix, or of an external buffer.
+ * The element [row,col] is located at data[row*rowStride+col].
+ * The view does not copy the data, so the data has to outlive the view, and
+ * resizing the viewed DataMatrix invalidates the view.
+ *
+ * Use the typedefs DataMatrixView (mutable elements) and ConstDataMatrixView
+ * (read-only elements). Rows are contiguous views, columns are strided views.
+ *
+ * @tparam T double or const double
+ */
+template <class T>
+class BasicDataMatrixView {
+ public:
+  /**
+   * Creates an empty view.
+   */
+  BasicDataMatrixView() : data(nullptr), nrows(0), ncols(0), rowStride(0) {}
+
+  /**
+   * Creates a view of a row-major array.
+   *
+   * @param data      pointer to the first element
+   * @param nrows     number of rows
+   * @param ncols     number of columns
+   * @param rowStride distance between two consecutive rows (in elements)
+   */
+  BasicDataMatrixView(T* data, size_t nrows, size_t ncols, size_t rowStride)
+      : data(data), nrows(nrows), ncols(ncols), rowStride(rowStride) {}
+
+  /**
+   * Creates a view of a contiguous row-major array.
+   *
+   * @param data      pointer to the first element
+   * @param nrows     number of rows
+   * @param ncols     number of columns
+   */
+  BasicDataMatrixView(T* data, size_t nrows, size_t ncols)
+      : BasicDataMatrixView(data, nrows, ncols, ncols) {}
+
+  /**
+   * Converts a mutable view to a read-only view.
+   *
+   * @param other view to convert
+   */
+  template <class U, class = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+  BasicDataMatrixView(const BasicDataMatrixView<U>& other)  // NOLINT(runtime/explicit)
+      : data(other.getPointer()),
+        nrows(other.getNrows()),
+        ncols(other.getNcols()),
+        rowStride(other.getRowStride()) {}
+
+  /**
+   * @param row row
+   * @param col column
+   * @return value of the element [row,col]
+   */
+  inline double get(size_t row, size_t col) const { return data[row * rowStride + col]; }
+
+  /**
+   * Sets the element [row,col] (only for mutable views).
+   *
+   * @param row   row
+   * @param col   column
+   * @param value new value of the element
+   */
+  inline void set(size_t row, size_t col, double value) const {
+    data[row * rowStride + col] = value;
+  }
+
+  /**
+   * @param row row
+   * @return contiguous view of the row
+   */
+  inline BasicDataVectorView<T> getRow(size_t row) const {
+    return BasicDataVectorView<T>(data + row * rowStride, ncols);
+  }
+
+  /**
+   * @param col column
+   * @return strided view of the column
+   */
+  inline BasicDataVectorView<T> getColumn(size_t col) const {
+    return BasicDataVectorView<T>(data + col, nrows, rowStride);
+  }
+
+  /**
+   * @param start first row
+   * @param count number of rows
+   * @return view of the rows start, ..., start+count-1
+   */
+  BasicDataMatrixView getRows(size_t start, size_t count) const {
+    if (start + count > nrows) {
+      throw data_exception("DataMatrixView::getRows : Rows out of bounds");
+    }
+
+    return BasicDataMatrixView(data + start * rowStride, count, ncols, rowStride);
+  }
+
+  /**
+   * @return pointer to the first element
+   */
+  inline T* getPointer() const { return data; }
+
+  /**
+   * @return number of rows
+   */
+  inline size_t getNrows() const { return nrows; }
+
+  /**
+   * @return number of columns
+   */
+  inline size_t getNcols() const { return ncols; }
+
+  /**
+   * @return distance between two consecutive rows (in elements)
+   */
+  inline size_t getRowStride() const { return rowStride; }
+
+  /**
+   * @return whether the elements are stored consecutively in memory
+   */
+  inline bool isContiguous() const { return (rowStride == ncols) || (nrows <= 1); }
+
+ private:
+  /// pointer to the first element
+  T* data;
+  /// number of rows
+  size_t nrows;
+  /// number of columns
+  size_t ncols;
+  /// distance between two consecutive rows
+  size_t rowStride;
+};
+
+/// view of two-dimensional data with mutable elements
+typedef BasicDataMatrixView<double> DataMatrixView;
+/// view of two-dimensional data with read-only elements
+typedef BasicDataMatrixView<const double> ConstDataMatrixView;
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* DATAMATRIXVIEW_HPP */
@@ -24,6 +24,11 @@
 namespace sgpp {
 namespace base {
 
+namespace {
+/// minimal number of entries for which the operations are parallelized with OpenMP
+const size_t MIN_PARALLEL_SIZE = 16384;
+}  // namespace
+
 DataVector::DataVector() : DataVector(0) {}
 
 DataVector::DataVector(size_t size) : DataVector(size, 0.0) {}
@@ -31,13 +36,19 @@ DataVector::DataVector(size_t size) : DataVector(size, 0.0) {}
 DataVector::DataVector(size_t size, double value) { this->assign(size, value); }
 
 DataVector::DataVector(double* input, size_t size)
-    : std::vector<double>(input, input + size) {}
+    : std::vector<double, AlignedAllocator<double>>(input, input + size) {}
 
 DataVector::DataVector(std::vector<double> input)
-    : std::vector<double>(input) {}
+    : std::vector<double, AlignedAllocator<double>>(input.begin(), input.end()) {}
+
+DataVector::DataVector(ConstDataVectorView view) : DataVector(view.getSize()) {
+  for (size_t i = 0; i < view.getSize(); i++) {
+    (*this)[i] = view[i];
+  }
+}
 
 DataVector::DataVector(std::initializer_list<double> input)
-    : std::vector<double>(input) {}
+    : std::vector<double, AlignedAllocator<double>>(input) {}
 
 DataVector::DataVector(std::vector<int> input) {
   // copy data
@@ -172,8 +183,12 @@ void DataVector::insert(size_t index, double value) {
 }
 
 void DataVector::setAll(double value) {
-  for (size_t i = 0; i < this->size(); ++i) {
-    (*this)[i] = value;
+  const size_t n = this->size();
+  double* data = this->data();
+
+#pragma omp parallel for simd schedule(static) if (n >= MIN_PARALLEL_SIZE)
+  for (size_t i = 0; i < n; ++i) {
+    data[i] = value;
   }
 }
 
@@ -193,8 +208,13 @@ void DataVector::add(const DataVector& vec) {
         "DataVector::add : Dimensions do not match");
   }
 
-  for (size_t i = 0; i < this->size(); ++i) {
-    (*this)[i] += vec[i];
+  const size_t n = this->size();
+  double* data = this->data();
+  const double* vecData = vec.data();
+
+#pragma omp parallel for simd schedule(static) if (n >= MIN_PARALLEL_SIZE)
+  for (size_t i = 0; i < n; ++i) {
+    data[i] += vecData[i];
   }
 }
 
@@ -219,8 +239,13 @@ void DataVector::sub(const DataVector& vec) {
         "DataVector::sub : Dimensions do not match");
   }
 
-  for (size_t i = 0; i < this->size(); ++i) {
-    (*this)[i] -= vec[i];
+  const size_t n = this->size();
+  double* data = this->data();
+  const double* vecData = vec.data();
+
+#pragma omp parallel for simd schedule(static) if (n >= MIN_PARALLEL_SIZE)
+  for (size_t i = 0; i < n; ++i) {
+    data[i] -= vecData[i];
   }
 }
 
@@ -230,8 +255,13 @@ void DataVector::componentwise_mult(const DataVector& vec) {
         "DataVector::componentwise_mult : Dimensions do not match");
   }
 
-  for (size_t i = 0; i < this->size(); ++i) {
-    (*this)[i] *= vec[i];
+  const size_t n = this->size();
+  double* data = this->data();
+  const double* vecData = vec.data();
+
+#pragma omp parallel for simd schedule(static) if (n >= MIN_PARALLEL_SIZE)
+  for (size_t i = 0; i < n; ++i) {
+    data[i] *= vecData[i];
   }
 }
 
@@ -247,18 +277,61 @@ void DataVector::componentwise_div(const DataVector& vec) {
 }
 
 double DataVector::dotProduct(const DataVector& vec) const {
+  const size_t n = this->size();
+  const double* data = this->data();
+  const double* vecData = vec.data();
   double sum = 0.0;
 
-  for (size_t i = 0; i < this->size(); ++i) {
-    sum += (*this)[i] * vec[i];
+  if (n < MIN_PARALLEL_SIZE) {
+    for (size_t i = 0; i < n; ++i) {
+      sum += data[i] * vecData[i];
+    }
+  } else {
+#pragma omp parallel for simd schedule(static) reduction(+ : sum)
+    for (size_t i = 0; i < n; ++i) {
+      sum += data[i] * vecData[i];
+    }
+  }
+
+  return sum;
+}
+
+double DataVector::dotProductWithNorm(const DataVector& vec, double& squaredNorm) const {
+  if (this->size() != vec.size()) {
+    throw sgpp::base::data_exception(
+        "DataVector::dotProductWithNorm : Dimensions do not match");
   }
 
+  const size_t n = this->size();
+  const double* data = this->data();
+  const double* vecData = vec.data();
+  double sum = 0.0;
+  double squaredSum = 0.0;
+
+  if (n < MIN_PARALLEL_SIZE) {
+    for (size_t i = 0; i < n; ++i) {
+      sum += data[i] * vecData[i];
+      squaredSum += data[i] * data[i];
+    }
+  } else {
+#pragma omp parallel for simd schedule(static) reduction(+ : sum, squaredSum)
+    for (size_t i = 0; i < n; ++i) {
+      sum += data[i] * vecData[i];
+      squaredSum += data[i] * data[i];
+    }
+  }
+
+  squaredNorm = squaredSum;
   return sum;
 }
 
 void DataVector::mult(double scalar) {
-  for (size_t i = 0; i < this->size(); ++i) {
-    (*this)[i] *= scalar;
+  const size_t n = this->size();
+  double* data = this->data();
+
+#pragma omp parallel for simd schedule(static) if (n >= MIN_PARALLEL_SIZE)
+  for (size_t i = 0; i < n; ++i) {
+    data[i] *= scalar;
   }
 }
 
@@ -281,10 +354,19 @@ void DataVector::abs() {
 }
 
 double DataVector::sum() const {
+  const size_t n = this->size();
+  const double* data = this->data();
   double result = 0.0;
 
-  for (size_t i = 0; i < this->size(); ++i) {
-    result += (*this)[i];
+  if (n < MIN_PARALLEL_SIZE) {
+    for (size_t i = 0; i < n; ++i) {
+      result += data[i];
+    }
+  } else {
+#pragma omp parallel for simd schedule(static) reduction(+ : result)
+    for (size_t i = 0; i < n; ++i) {
+      result += data[i];
+    }
   }
 
   return result;
@@ -303,27 +385,10 @@ double DataVector::maxNorm() const {
 }
 
 double DataVector::RMSNorm() const {
-  double rmsNorm;
-  DataVector temp(*this);
-
-  temp.sqr();
-  rmsNorm = temp.sum();
-  rmsNorm /= static_cast<double>(temp.getSize());
-  rmsNorm = std::sqrt(rmsNorm);
-
-  return rmsNorm;
+  return std::sqrt(this->dotProduct(*this) / static_cast<double>(this->size()));
 }
 
-double DataVector::l2Norm() const {
-  double l2Norm;
-  DataVector temp(*this);
-
-  temp.componentwise_mult(temp);
-  l2Norm = temp.sum();
-  l2Norm = std::sqrt(l2Norm);
-
-  return l2Norm;
-}
+double DataVector::l2Norm() const { return std::sqrt(this->dotProduct(*this)); }
 
 double DataVector::min() const {
   double min = std::numeric_limits<double>::infinity();
@@ -372,8 +437,73 @@ void DataVector::axpy(double a, DataVector& x) {
     return;
   }
 
-  for (size_t i = 0; i < this->size(); ++i) {
-    (*this)[i] += a * x[i];
+  const size_t n = this->size();
+  double* data = this->data();
+  const double* xData = x.data();
+
+#pragma omp parallel for simd schedule(static) if (n >= MIN_PARALLEL_SIZE)
+  for (size_t i = 0; i < n; ++i) {
+    data[i] += a * xData[i];
+  }
+}
+
+void DataVector::axpy(double a, const DataVector& x, double b, const DataVector& y) {
+  if ((this->size() != x.size()) || (this->size() != y.size())) {
+    throw sgpp::base::data_exception(
+        "DataVector::axpy : Dimensions do not match");
+  }
+
+  const size_t n = this->size();
+  double* data = this->data();
+  const double* xData = x.data();
+  const double* yData = y.data();
+
+#pragma omp parallel for simd schedule(static) if (n >= MIN_PARALLEL_SIZE)
+  for (size_t i = 0; i < n; ++i) {
+    data[i] += a * xData[i] + b * yData[i];
+  }
+}
+
+double DataVector::axpyDot(double a, const DataVector& x) {
+  if (this->size() != x.size()) {
+    throw sgpp::base::data_exception(
+        "DataVector::axpyDot : Dimensions do not match");
+  }
+
+  const size_t n = this->size();
+  double* data = this->data();
+  const double* xData = x.data();
+  double sum = 0.0;
+
+  if (n < MIN_PARALLEL_SIZE) {
+    for (size_t i = 0; i < n; ++i) {
+      data[i] += a * xData[i];
+      sum += data[i] * data[i];
+    }
+  } else {
+#pragma omp parallel for simd schedule(static) reduction(+ : sum)
+    for (size_t i = 0; i < n; ++i) {
+      data[i] += a * xData[i];
+      sum += data[i] * data[i];
+    }
+  }
+
+  return sum;
+}
+
+void DataVector::xpay(double a, const DataVector& x) {
+  if (this->size() != x.size()) {
+    throw sgpp::base::data_exception(
+        "DataVector::xpay : Dimensions do not match");
+  }
+
+  const size_t n = this->size();
+  double* data = this->data();
+  const double* xData = x.data();
+
+#pragma omp parallel for simd schedule(static) if (n >= MIN_PARALLEL_SIZE)
+  for (size_t i = 0; i < n; ++i) {
+    data[i] = xData[i] + a * data[i];
   }
 }
 
@@ -6,6 +6,8 @@
 #ifndef DATAVECTOR_HPP
 #define DATAVECTOR_HPP
 
+#include <sgpp/base/datatypes/AlignedAllocator.hpp>
+#include <sgpp/base/datatypes/DataVectorView.hpp>
 #include <sgpp/globaldef.hpp>
 
 #include <initializer_list>
@@ -21,8 +23,11 @@ namespace base {
  * of (hierarchical) coefficients (or surplusses), or the coordinates
  * of a data point at which a sparse grid function should be
  * evaluated.
+ * The arithmetic operations of long vectors are vectorized and parallelized
+ * with OpenMP.
+ * The data is aligned to 64 bytes (see AlignedAllocator).
  */
-class DataVector : public std::vector<double> {
+class DataVector : public std::vector<double, AlignedAllocator<double>> {
  public:
   /**
    * Create an empty DataVector.
@@ -99,6 +104,13 @@ class DataVector : public std::vector<double> {
    */
   explicit DataVector(std::vector<int> input);
 
+  /**
+   * Create a new DataVector from a (possibly strided) view by copying its elements.
+   *
+   * @param view view that contains the data
+   */
+  explicit DataVector(ConstDataVectorView view);
+
   static DataVector fromFile(const std::string& fileName);
 
   static DataVector fromString(const std::string& serializedVector);
@@ -256,6 +268,17 @@ class DataVector : public std::vector<double> {
    */
   double dotProduct(const DataVector& vec) const;
 
+  /**
+   * Returns the dot product of the two vectors and computes the squared
+   * @f$l^2@f$-norm of the current vector in the same pass over the data.
+   *
+   * @param vec Reference to another vector
+   * @param[out] squaredNorm The dot product of the current vector with itself
+   *
+   * @return The dot-product
+   */
+  double dotProductWithNorm(const DataVector& vec, double& squaredNorm) const;
+
   /**
    * multiplies all elements by a constant factor
    *
@@ -342,6 +365,35 @@ class DataVector : public std::vector<double> {
    */
   void axpy(double a, DataVector& x);
 
+  /**
+   * Adds a*x + b*y to current vector in one pass over the data.
+   *
+   * @param a A scalar
+   * @param x Reference to the first DataVector
+   * @param b A scalar
+   * @param y Reference to the second DataVector
+   */
+  void axpy(double a, const DataVector& x, double b, const DataVector& y);
+
+  /**
+   * Adds a*x to current vector and returns the dot product of the
+   * updated vector with itself, in one pass over the data.
+   *
+   * @param a A scalar
+   * @param x Reference to the DataVector
+   *
+   * @return The squared @f$l^2@f$-norm of the updated vector
+   */
+  double axpyDot(double a, const DataVector& x);
+
+  /**
+   * Replaces the current vector y by x + a*y.
+   *
+   * @param a A scalar
+   * @param x Reference to the DataVector
+   */
+  void xpay(double a, const DataVector& x);
+
   /**
    * gets a pointer to the data array
    *
@@ -356,6 +408,35 @@ class DataVector : public std::vector<double> {
    */
   const double* getPointer() const;
 
+  /**
+   * Returns a view of the whole DataVector. The view is invalidated if the DataVector is resized.
+   *
+   * @return View of the data
+   */
+  inline DataVectorView getView() { return DataVectorView(this->data(), this->size()); }
+
+  /**
+   * Returns a read-only view of the whole DataVector.
+   * The view is invalidated if the DataVector is resized.
+   *
+   * @return Read-only view of the data
+   */
+  inline ConstDataVectorView getView() const {
+    return ConstDataVectorView(this->data(), this->size());
+  }
+
+  /**
+   * Implicit conversion to a view, such that DataVectors can be passed to functions
+   * taking views.
+   */
+  inline operator DataVectorView() { return getView(); }  // NOLINT(runtime/explicit)
+
+  /**
+   * Implicit conversion to a read-only view, such that DataVectors can be passed to functions
+   * taking read-only views.
+   */
+  inline operator ConstDataVectorView() const { return getView(); }  // NOLINT(runtime/explicit)
+
   /**
    * gets the elements stored in the vector
    * \deprecated in favour of the equivalent size() method
@@ -408,7 +489,7 @@ class DataVector : public std::vector<double> {
   void toFile(const std::string& fileName) const;
 
  private:
-  using std::vector<double>::insert;
+  using std::vector<double, AlignedAllocator<double>>::insert;
   /// Corrections for Kahan's summation in accumulate()
   std::vector<double> correction;
 };
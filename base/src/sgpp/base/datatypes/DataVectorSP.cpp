@@ -24,6 +24,11 @@
 namespace sgpp {
 namespace base {
 
+namespace {
+/// minimal number of entries for which the operations are parallelized with OpenMP
+const size_t MIN_PARALLEL_SIZE = 16384;
+}  // namespace
+
 DataVectorSP::DataVectorSP() : DataVectorSP(0) {}
 
 DataVectorSP::DataVectorSP(size_t size) : DataVectorSP(size, 0.0) {}
@@ -159,8 +164,12 @@ void DataVectorSP::insert(size_t index, float value) {
 }
 
 void DataVectorSP::setAll(float value) {
-  for (size_t i = 0; i < this->size(); ++i) {
-    (*this)[i] = value;
+  const size_t n = this->size();
+  float* data = this->data();
+
+#pragma omp parallel for simd schedule(static) if (n >= MIN_PARALLEL_SIZE)
+  for (size_t i = 0; i < n; ++i) {
+    data[i] = value;
   }
 }
 
@@ -178,8 +187,13 @@ void DataVectorSP::add(const DataVectorSP& vec) {
     throw sgpp::base::data_exception("DataVectorSP::add : Dimensions do not match");
   }
 
-  for (size_t i = 0; i < this->size(); ++i) {
-    (*this)[i] += vec[i];
+  const size_t n = this->size();
+  float* data = this->data();
+  const float* vecData = vec.data();
+
+#pragma omp parallel for simd schedule(static) if (n >= MIN_PARALLEL_SIZE)
+  for (size_t i = 0; i < n; ++i) {
+    data[i] += vecData[i];
   }
 }
 
@@ -203,8 +217,13 @@ void DataVectorSP::sub(const DataVectorSP& vec) {
     throw sgpp::base::data_exception("DataVectorSP::sub : Dimensions do not match");
   }
 
-  for (size_t i = 0; i < this->size(); ++i) {
-    (*this)[i] -= vec[i];
+  const size_t n = this->size();
+  float* data = this->data();
+  const float* vecData = vec.data();
+
+#pragma omp parallel for simd schedule(static) if (n >= MIN_PARALLEL_SIZE)
+  for (size_t i = 0; i < n; ++i) {
+    data[i] -= vecData[i];
   }
 }
 
@@ -213,8 +232,13 @@ void DataVectorSP::componentwise_mult(const DataVectorSP& vec) {
     throw sgpp::base::data_exception("DataVectorSP::componentwise_mult : Dimensions do not match");
   }
 
-  for (size_t i = 0; i < this->size(); ++i) {
-    (*this)[i] *= vec[i];
+  const size_t n = this->size();
+  float* data = this->data();
+  const float* vecData = vec.data();
+
+#pragma omp parallel for simd schedule(static) if (n >= MIN_PARALLEL_SIZE)
+  for (size_t i = 0; i < n; ++i) {
+    data[i] *= vecData[i];
   }
 }
 
@@ -229,18 +253,60 @@ void DataVectorSP::componentwise_div(const DataVectorSP& vec) {
 }
 
 float DataVectorSP::dotProduct(const DataVectorSP& vec) const {
+  const size_t n = this->size();
+  const float* data = this->data();
+  const float* vecData = vec.data();
   float sum = 0.0f;
 
-  for (size_t i = 0; i < this->size(); ++i) {
-    sum += (*this)[i] * vec[i];
+  if (n < MIN_PARALLEL_SIZE) {
+    for (size_t i = 0; i < n; ++i) {
+      sum += data[i] * vecData[i];
+    }
+  } else {
+#pragma omp parallel for simd schedule(static) reduction(+ : sum)
+    for (size_t i = 0; i < n; ++i) {
+      sum += data[i] * vecData[i];
+    }
   }
 
   return sum;
 }
 
+float DataVectorSP::dotProductWithNorm(const DataVectorSP& vec, float& squaredNorm) const {
+  if (this->size() != vec.size()) {
+    throw sgpp::base::data_exception("DataVectorSP::dotProductWithNorm : Dimensions do not match");
+  }
+
+  const size_t n = this->size();
+  const float* data = this->data();
+  const float* vecData = vec.data();
+  float sum = 0.0f;
+  float squaredSum = 0.0f;
+
+  if (n < MIN_PARALLEL_SIZE) {
+    for (size_t i = 0; i < n; ++i) {
+      sum += data[i] * vecData[i];
+      squaredSum += data[i] * data[i];
+    }
+  } else {
+#pragma omp parallel for simd schedule(static) reduction(+ : sum, squaredSum)
+    for (size_t i = 0; i < n; ++i) {
+      sum += data[i] * vecData[i];
+      squaredSum += data[i] * data[i];
+    }
+  }
+
+  squaredNorm = squaredSum;
+  return sum;
+}
+
 void DataVectorSP::mult(float scalar) {
-  for (size_t i = 0; i < this->size(); ++i) {
-    (*this)[i] *= scalar;
+  const size_t n = this->size();
+  float* data = this->data();
+
+#pragma omp parallel for simd schedule(static) if (n >= MIN_PARALLEL_SIZE)
+  for (size_t i = 0; i < n; ++i) {
+    data[i] *= scalar;
   }
 }
 
@@ -263,10 +329,19 @@ void DataVectorSP::abs() {
 }
 
 float DataVectorSP::sum() const {
+  const size_t n = this->size();
+  const float* data = this->data();
   float result = 0.0f;
 
-  for (size_t i = 0; i < this->size(); ++i) {
-    result += (*this)[i];
+  if (n < MIN_PARALLEL_SIZE) {
+    for (size_t i = 0; i < n; ++i) {
+      result += data[i];
+    }
+  } else {
+#pragma omp parallel for simd schedule(static) reduction(+ : result)
+    for (size_t i = 0; i < n; ++i) {
+      result += data[i];
+    }
   }
 
   return result;
@@ -285,27 +360,10 @@ float DataVectorSP::maxNorm() const {
 }
 
 float DataVectorSP::RMSNorm() const {
-  float rmsNorm;
-  DataVectorSP temp(*this);
-
-  temp.sqr();
-  rmsNorm = temp.sum();
-  rmsNorm /= static_cast<float>(temp.getSize());
-  rmsNorm = std::sqrt(rmsNorm);
-
-  return rmsNorm;
+  return std::sqrt(this->dotProduct(*this) / static_cast<float>(this->size()));
 }
 
-float DataVectorSP::l2Norm() const {
-  float l2Norm;
-  DataVectorSP temp(*this);
-
-  temp.componentwise_mult(temp);
-  l2Norm = temp.sum();
-  l2Norm = std::sqrt(l2Norm);
-
-  return l2Norm;
-}
+float DataVectorSP::l2Norm() const { return std::sqrt(this->dotProduct(*this)); }
 
 float DataVectorSP::min() const {
   float min = std::numeric_limits<float>::infinity();
@@ -354,8 +412,70 @@ void DataVectorSP::axpy(float a, DataVectorSP& x) {
     return;
   }
 
-  for (size_t i = 0; i < this->size(); ++i) {
-    (*this)[i] += a * x[i];
+  const size_t n = this->size();
+  float* data = this->data();
+  const float* xData = x.data();
+
+#pragma omp parallel for simd schedule(static) if (n >= MIN_PARALLEL_SIZE)
+  for (size_t i = 0; i < n; ++i) {
+    data[i] += a * xData[i];
+  }
+}
+
+void DataVectorSP::axpy(float a, const DataVectorSP& x, float b, const DataVectorSP& y) {
+  if ((this->size() != x.size()) || (this->size() != y.size())) {
+    throw sgpp::base::data_exception("DataVectorSP::axpy : Dimensions do not match");
+  }
+
+  const size_t n = this->size();
+  float* data = this->data();
+  const float* xData = x.data();
+  const float* yData = y.data();
+
+#pragma omp parallel for simd schedule(static) if (n >= MIN_PARALLEL_SIZE)
+  for (size_t i = 0; i < n; ++i) {
+    data[i] += a * xData[i] + b * yData[i];
+  }
+}
+
+float DataVectorSP::axpyDot(float a, const DataVectorSP& x) {
+  if (this->size() != x.size()) {
+    throw sgpp::base::data_exception("DataVectorSP::axpyDot : Dimensions do not match");
+  }
+
+  const size_t n = this->size();
+  float* data = this->data();
+  const float* xData = x.data();
+  float sum = 0.0f;
+
+  if (n < MIN_PARALLEL_SIZE) {
+    for (size_t i = 0; i < n; ++i) {
+      data[i] += a * xData[i];
+      sum += data[i] * data[i];
+    }
+  } else {
+#pragma omp parallel for simd schedule(static) reduction(+ : sum)
+    for (size_t i = 0; i < n; ++i) {
+      data[i] += a * xData[i];
+      sum += data[i] * data[i];
+    }
+  }
+
+  return sum;
+}
+
+void DataVectorSP::xpay(float a, const DataVectorSP& x) {
+  if (this->size() != x.size()) {
+    throw sgpp::base::data_exception("DataVectorSP::xpay : Dimensions do not match");
+  }
+
+  const size_t n = this->size();
+  float* data = this->data();
+  const float* xData = x.data();
+
+#pragma omp parallel for simd schedule(static) if (n >= MIN_PARALLEL_SIZE)
+  for (size_t i = 0; i < n; ++i) {
+    data[i] = xData[i] + a * data[i];
   }
 }
 
@@ -21,6 +21,8 @@ namespace base {
  * of (hierarchical) coefficients (or surplusses), or the coordinates
  * of a data point at which a sparse grid function should be
  * evaluated.
+ * The arithmetic operations of long vectors are vectorized and parallelized
+ * with OpenMP.
  *
  * This is an re-implementation of the standard DataVector
  * for single precision floating point numbers in order to
@@ -253,6 +255,17 @@ class DataVectorSP : public std::vector<float> {
    */
   float dotProduct(const DataVectorSP& vec) const;
 
+  /**
+   * Returns the dot product of the two vectors and computes the squared
+   * @f$l^2@f$-norm of the current vector in the same pass over the data.
+   *
+   * @param vec Reference to another vector
+   * @param[out] squaredNorm The dot product of the current vector with itself
+   *
+   * @return The dot-product
+   */
+  float dotProductWithNorm(const DataVectorSP& vec, float& squaredNorm) const;
+
   /**
    * multiplies all elements by a constant factor
    *
@@ -339,6 +352,35 @@ class DataVectorSP : public std::vector<float> {
    */
   void axpy(float a, DataVectorSP& x);
 
+  /**
+   * Adds a*x + b*y to current vector in one pass over the data.
+   *
+   * @param a A scalar
+   * @param x Reference to the first DataVectorSP
+   * @param b A scalar
+   * @param y Reference to the second DataVectorSP
+   */
+  void axpy(float a, const DataVectorSP& x, float b, const DataVectorSP& y);
+
+  /**
+   * Adds a*x to current vector and returns the dot product of the
+   * updated vector with itself, in one pass over the data.
+   *
+   * @param a A scalar
+   * @param x Reference to the DataVectorSP
+   *
+   * @return The squared @f$l^2@f$-norm of the updated vector
+   */
+  float axpyDot(float a, const DataVectorSP& x);
+
+  /**
+   * Replaces the current vector y by x + a*y.
+   *
+   * @param a A scalar
+   * @param x Reference to the DataVectorSP
+   */
+  void xpay(float a, const DataVectorSP& x);
+
   /**
    * gets a pointer to the data array
    *
@@ -0,0 +1,186 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef DATAVECTORVIEW_HPP
+#define DATAVECTORVIEW_HPP
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Non-owning view of one-dimensional data, e.g., of a DataVector, of a row or a column
+ * of a DataMatrix, or of an external buffer.
+ * The elements are located at data[0], data[stride], ..., data[(size-1)*stride].
+ * The view does not copy the data, so the data has to outlive the view, and
+ * resizing the viewed DataVector or DataMatrix invalidates the view.
+ *
+ * Use the typedefs DataVectorView (mutable elements) and ConstDataVectorView
+ * (read-only elements). A DataVectorView converts implicitly to a ConstDataVectorView
+ * and DataVector converts implicitly to both, so functions taking a ConstDataVectorView
+ * also accept DataVectors.
+ *
+ * @tparam T double or const double
+ */
+template <class T>
+class BasicDataVectorView {
+ public:
+  /**
+   * Creates an empty view.
+   */
+  BasicDataVectorView() : data(nullptr), size(0), stride(1) {}
+
+  /**
+   * Creates a view of an array.
+   *
+   * @param data   pointer to the first element
+   * @param size   number of elements
+   * @param stride distance between two consecutive elements (in elements)
+   */
+  BasicDataVectorView(T* data, size_t size, size_t stride = 1)
+      : data(data), size(size), stride(stride) {}
+
+  /**
+   * Converts a mutable view to a read-only view.
+   *
+   * @param other view to convert
+   */
+  template <class U, class = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+  BasicDataVectorView(const BasicDataVectorView<U>& other)  // NOLINT(runtime/explicit)
+      : data(other.getPointer()), size(other.getSize()), stride(other.getStride()) {}
+
+  /**
+   * @param i index of the element
+   * @return reference to the element
+   */
+  inline T& operator[](size_t i) const { return data[i * stride]; }
+
+  /**
+   * @param i index of the element
+   * @return value of the element
+   */
+  inline double get(size_t i) const { return data[i * stride]; }
+
+  /**
+   * Sets the element with index i (only for mutable views).
+   *
+   * @param i     index of the element
+   * @param value new value of the element
+   */
+  inline void set(size_t i, double value) const { data[i * stride] = value; }
+
+  /**
+   * Sets all elements to the same value (only for mutable views).
+   *
+   * @param value new value of all elements
+   */
+  void setAll(double value) const {
+    for (size_t i = 0; i < size; i++) {
+      data[i * stride] = value;
+    }
+  }
+
+  /**
+   * Copies the elements of another view of the same size (only for mutable views).
+   *
+   * @param other view whose elements are copied
+   */
+  void copyFrom(const BasicDataVectorView<const double>& other) const {
+    if (other.getSize() != size) {
+      throw data_exception("DataVectorView::copyFrom : Dimensions do not match");
+    }
+
+    for (size_t i = 0; i < size; i++) {
+      data[i * stride] = other[i];
+    }
+  }
+
+  /**
+   * @param other view of the same size
+   * @return scalar product of the two views
+   */
+  double dotProduct(const BasicDataVectorView<const double>& other) const {
+    if (other.getSize() != size) {
+      throw data_exception("DataVectorView::dotProduct : Dimensions do not match");
+    }
+
+    double result = 0.0;
+
+    for (size_t i = 0; i < size; i++) {
+      result += data[i * stride] * other[i];
+    }
+
+    return result;
+  }
+
+  /**
+   * @return sum of all elements
+   */
+  double sum() const {
+    double result = 0.0;
+
+    for (size_t i = 0; i < size; i++) {
+      result += data[i * stride];
+    }
+
+    return result;
+  }
+
+  /**
+   * @param start  index of the first element of the slice
+   * @param length number of elements of the slice
+   * @return view of the elements start, ..., start+length-1
+   */
+  BasicDataVectorView getSlice(size_t start, size_t length) const {
+    if (start + length > size) {
+      throw data_exception("DataVectorView::getSlice : Slice out of bounds");
+    }
+
+    return BasicDataVectorView(data + start * stride, length, stride);
+  }
+
+  /**
+   * @return pointer to the first element
+   */
+  inline T* getPointer() const { return data; }
+
+  /**
+   * @return number of elements
+   */
+  inline size_t getSize() const { return size; }
+
+  /**
+   * @return distance between two consecutive elements (in elements)
+   */
+  inline size_t getStride() const { return stride; }
+
+  /**
+   * @return whether the elements are stored consecutively in memory
+   */
+  inline bool isContiguous() const { return (stride == 1) || (size <= 1); }
+
+ private:
+  /// pointer to the first element
+  T* data;
+  /// number of elements
+  size_t size;
+  /// distance between two consecutive elements
+  size_t stride;
+};
+
+/// view of one-dimensional data with mutable elements
+typedef BasicDataVectorView<double> DataVectorView;
+/// view of one-dimensional data with read-only elements
+typedef BasicDataVectorView<const double> ConstDataVectorView;
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* DATAVECTORVIEW_HPP */
@@ -0,0 +1,126 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/MemoryArena.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace sgpp {
+namespace base {
+
+namespace {
+
+/// arena for large allocations (nullptr if there is none)
+MemoryArena* largeAllocationArena = nullptr;
+/// minimal size of large allocations in bytes
+size_t largeAllocationThreshold = 0;
+
+}  // namespace
+
+const size_t MemoryArena::alignment;
+const size_t HugePageMemoryArena::hugePageSize;
+
+MemoryArena::~MemoryArena() {}
+
+MemoryArena& MemoryArena::getAlignedArena() {
+  static AlignedMemoryArena arena;
+  return arena;
+}
+
+MemoryArena& MemoryArena::getArena(size_t bytes) {
+  if ((largeAllocationArena != nullptr) && (bytes >= largeAllocationThreshold)) {
+    return *largeAllocationArena;
+  } else {
+    return getAlignedArena();
+  }
+}
+
+void MemoryArena::setLargeAllocationArena(MemoryArena* arena, size_t threshold) {
+  largeAllocationArena = arena;
+  largeAllocationThreshold = threshold;
+}
+
+void* AlignedMemoryArena::allocate(size_t bytes) {
+  void* p = nullptr;
+
+#ifdef _WIN32
+  p = _aligned_malloc(bytes, alignment);
+#else
+  if (posix_memalign(&p, alignment, bytes) != 0) {
+    p = nullptr;
+  }
+#endif
+
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+
+  return p;
+}
+
+void AlignedMemoryArena::deallocate(void* p, size_t bytes) {
+#ifdef _WIN32
+  _aligned_free(p);
+#else
+  free(p);
+#endif
+}
+
+HugePageMemoryArena::HugePageMemoryArena(bool firstTouch) : firstTouch(firstTouch) {}
+
+void* HugePageMemoryArena::allocate(size_t bytes) {
+#if defined(__linux__)
+  const size_t size = (bytes + hugePageSize - 1) / hugePageSize * hugePageSize;
+  void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+  if (p == MAP_FAILED) {
+    throw std::bad_alloc();
+  }
+
+#ifdef MADV_HUGEPAGE
+  // only a hint, the kernel falls back to normal pages if it can't provide huge pages
+  madvise(p, size, MADV_HUGEPAGE);
+#endif
+
+  if (firstTouch) {
+    char* bytePointer = static_cast<char*>(p);
+    const size_t pageSize = 4096;
+    const int64_t numPages = static_cast<int64_t>(size / pageSize);
+
+    #pragma omp parallel for schedule(static)
+    for (int64_t page = 0; page < numPages; page++) {
+      bytePointer[page * pageSize] = 0;
+    }
+  }
+
+  return p;
+#else
+  return getAlignedArena().allocate(bytes);
+#endif
+}
+
+void HugePageMemoryArena::deallocate(void* p, size_t bytes) {
+#if defined(__linux__)
+  const size_t size = (bytes + hugePageSize - 1) / hugePageSize * hugePageSize;
+  munmap(p, size);
+#else
+  getAlignedArena().deallocate(p, bytes);
+#endif
+}
+
+}  // namespace base
+}  // namespace sgpp
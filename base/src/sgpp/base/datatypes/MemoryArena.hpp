@@ -0,0 +1,108 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef MEMORYARENA_HPP
+#define MEMORYARENA_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Source of the memory of DataVector and DataMatrix (see AlignedAllocator).
+ *
+ * By default, all data is allocated by the aligned arena (64-byte aligned heap memory).
+ * Allocations of at least a given size can be redirected to another arena,
+ * e.g., a HugePageMemoryArena for matrices of many gigabytes.
+ * Every allocation remembers its arena, so the large allocation arena may be changed at any
+ * time, as long as the arenas outlive the memory they have handed out.
+ */
+class MemoryArena {
+ public:
+  /// alignment of all allocations in bytes (size of a cache line and of an AVX-512 register)
+  static const size_t alignment = 64;
+
+  /**
+   * Destructor
+   */
+  virtual ~MemoryArena();
+
+  /**
+   * @param bytes number of bytes
+   * @return memory of the given size aligned to alignment bytes (throws std::bad_alloc on failure)
+   */
+  virtual void* allocate(size_t bytes) = 0;
+
+  /**
+   * @param p     memory returned by allocate
+   * @param bytes size that was passed to allocate
+   */
+  virtual void deallocate(void* p, size_t bytes) = 0;
+
+  /**
+   * @return the arena for 64-byte aligned heap memory
+   */
+  static MemoryArena& getAlignedArena();
+
+  /**
+   * @param bytes size of an allocation
+   * @return arena which should serve an allocation of the given size
+   */
+  static MemoryArena& getArena(size_t bytes);
+
+  /**
+   * Redirects all allocations of at least threshold bytes to the given arena.
+   * Not thread-safe, should be called before the data is allocated.
+   *
+   * @param arena     arena for large allocations (nullptr to use the aligned arena for everything)
+   * @param threshold minimal size of large allocations in bytes
+   */
+  static void setLargeAllocationArena(MemoryArena* arena, size_t threshold);
+};
+
+/**
+ * Arena for 64-byte aligned heap memory.
+ */
+class AlignedMemoryArena : public MemoryArena {
+ public:
+  void* allocate(size_t bytes) override;
+  void deallocate(void* p, size_t bytes) override;
+};
+
+/**
+ * Arena for large allocations that are backed by huge pages where the operating system
+ * supports it (on Linux, by transparent huge pages via madvise), which saves TLB misses
+ * when streaming through large data sets.
+ * Optionally, the pages are touched first by the OpenMP threads in the same static schedule
+ * that the row loops of the streaming kernels use. Then, on NUMA systems, the pages
+ * are placed on the memory node of the thread that works on them.
+ * On other systems, the arena falls back to aligned heap memory.
+ */
+class HugePageMemoryArena : public MemoryArena {
+ public:
+  /**
+   * Constructor
+   *
+   * @param firstTouch whether to touch the pages in parallel after allocation
+   */
+  explicit HugePageMemoryArena(bool firstTouch = true);
+
+  void* allocate(size_t bytes) override;
+  void deallocate(void* p, size_t bytes) override;
+
+ private:
+  /// size of huge pages in bytes
+  static const size_t hugePageSize = static_cast<size_t>(2) << 20;
+  /// whether to touch the pages in parallel after allocation
+  bool firstTouch;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* MEMORYARENA_HPP */
@@ -0,0 +1,438 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/CompiledGridModel.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/exception/generation_exception.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/hash/common/basis/Basis.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+namespace {
+
+const char modelMagic[8] = {'S', 'G', 'P', 'P', 'M', 'O', 'D', 'L'};
+const uint32_t modelVersion = 1;
+const uint32_t byteOrderMark = 0x01020304;
+/// alignment of the sections (cache line)
+const size_t modelAlignment = 64;
+
+/**
+ * Header of a compiled model. All offsets are relative to the beginning of the file.
+ */
+struct ModelHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrderMark;
+  uint64_t dimension;
+  uint64_t numberOfPoints;
+  uint64_t numberOfSubspaces;
+  uint64_t descriptionSize;
+  uint64_t descriptionOffset;
+  uint64_t subspaceLevelsOffset;
+  uint64_t subspaceStartOffset;
+  uint64_t keysOffset;
+  uint64_t gridPointSeqOffset;
+  uint64_t coefficientsOffset;
+  uint64_t fileSize;
+  /// checksum of everything after the header
+  uint64_t payloadChecksum;
+  uint64_t reserved;
+  /// checksum of all preceding fields
+  uint64_t headerChecksum;
+};
+
+static_assert(sizeof(ModelHeader) == 128, "ModelHeader must not contain padding");
+
+uint64_t computeHeaderChecksum(const ModelHeader& header) {
+  return MemoryMappedFile::computeChecksum(&header, offsetof(ModelHeader, headerChecksum));
+}
+
+/**
+ * Appends a section to the payload of a compiled model.
+ *
+ * @param payload   payload (starting at the end of the header)
+ * @param data      data of the section
+ * @param size      size of the section in bytes
+ * @return          offset of the section relative to the beginning of the file
+ */
+uint64_t appendSection(std::vector<char>& payload, const void* data, size_t size) {
+  const size_t offset = sizeof(ModelHeader) + payload.size();
+  const size_t paddedSize = (size + modelAlignment - 1) / modelAlignment * modelAlignment;
+  payload.resize(payload.size() + paddedSize, 0);
+  std::memcpy(payload.data() + offset - sizeof(ModelHeader), data, size);
+  return offset;
+}
+
+bool isSupportedGridType(GridType type) {
+  return (type == GridType::Linear) || (type == GridType::ModLinear) ||
+         (type == GridType::Poly) || (type == GridType::ModPoly);
+}
+
+}  // namespace
+
+void CompiledGridModel::compile(Grid& grid, const DataVector& alpha, const std::string& fileName) {
+  GridStorage& storage = grid.getStorage();
+  const size_t dimension = storage.getDimension();
+  const size_t numberOfPoints = storage.getSize();
+
+  if (!isSupportedGridType(grid.getType()) || (storage.getStretching() != nullptr)) {
+    throw factory_exception("CompiledGridModel::compile: grid type is not supported");
+  }
+
+  if (alpha.getSize() != numberOfPoints) {
+    throw operation_exception("CompiledGridModel::compile: alpha has the wrong size");
+  }
+
+  // group the grid points by subspace, key = position of the grid point in the subspace
+  std::map<std::vector<uint32_t>, std::vector<std::pair<uint64_t, uint64_t>>> subspaces;
+  std::vector<uint32_t> levels(dimension);
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    const GridPoint& point = storage.getPoint(i);
+    uint64_t key = 0;
+    size_t shift = 0;
+
+    for (size_t d = 0; d < dimension; d++) {
+      levels[d] = point.getLevel(d);
+
+      if (levels[d] == 0) {
+        throw factory_exception("CompiledGridModel::compile: grid must not have boundary points");
+      }
+
+      key |= static_cast<uint64_t>((point.getIndex(d) - 1) / 2) << shift;
+      shift += levels[d] - 1;
+
+      if (shift >= 64) {
+        throw generation_exception("CompiledGridModel::compile: subspace is too fine");
+      }
+    }
+
+    subspaces[levels].emplace_back(key, i);
+  }
+
+  std::vector<uint32_t> subspaceLevels;
+  std::vector<uint64_t> subspaceStart;
+  std::vector<uint64_t> keys;
+  std::vector<uint64_t> gridPointSeq;
+  std::vector<double> coefficients;
+  subspaceLevels.reserve(subspaces.size() * dimension);
+  subspaceStart.reserve(subspaces.size() + 1);
+  keys.reserve(numberOfPoints);
+  gridPointSeq.reserve(numberOfPoints);
+  coefficients.reserve(numberOfPoints);
+
+  for (auto& subspace : subspaces) {
+    std::sort(subspace.second.begin(), subspace.second.end());
+    subspaceLevels.insert(subspaceLevels.end(), subspace.first.begin(), subspace.first.end());
+    subspaceStart.push_back(keys.size());
+
+    for (const std::pair<uint64_t, uint64_t>& point : subspace.second) {
+      keys.push_back(point.first);
+      gridPointSeq.push_back(point.second);
+      coefficients.push_back(alpha[point.second]);
+    }
+  }
+
+  subspaceStart.push_back(keys.size());
+
+  // grid without grid points (type, degree, and bounding box)
+  std::unique_ptr<Grid> emptyGrid(grid.clone());
+  emptyGrid->getStorage().clear();
+  const std::string description = emptyGrid->serialize();
+
+  ModelHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, modelMagic, sizeof(modelMagic));
+  header.version = modelVersion;
+  header.byteOrderMark = byteOrderMark;
+  header.dimension = dimension;
+  header.numberOfPoints = numberOfPoints;
+  header.numberOfSubspaces = subspaces.size();
+  header.descriptionSize = description.size();
+
+  std::vector<char> payload;
+  header.descriptionOffset = appendSection(payload, description.data(), description.size());
+  header.subspaceLevelsOffset = appendSection(payload, subspaceLevels.data(),
+                                              subspaceLevels.size() * sizeof(uint32_t));
+  header.subspaceStartOffset =
+      appendSection(payload, subspaceStart.data(), subspaceStart.size() * sizeof(uint64_t));
+  header.keysOffset = appendSection(payload, keys.data(), keys.size() * sizeof(uint64_t));
+  header.gridPointSeqOffset =
+      appendSection(payload, gridPointSeq.data(), gridPointSeq.size() * sizeof(uint64_t));
+  header.coefficientsOffset =
+      appendSection(payload, coefficients.data(), coefficients.size() * sizeof(double));
+  header.fileSize = sizeof(ModelHeader) + payload.size();
+  header.payloadChecksum = MemoryMappedFile::computeChecksum(payload.data(), payload.size());
+  header.headerChecksum = computeHeaderChecksum(header);
+
+  std::ofstream ostream(fileName, std::ios::binary);
+
+  if (!ostream) {
+    throw file_exception("CompiledGridModel::compile: cannot open file");
+  }
+
+  ostream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  ostream.write(payload.data(), payload.size());
+
+  if (!ostream) {
+    throw file_exception("CompiledGridModel::compile: cannot write file");
+  }
+}
+
+CompiledGridModel::CompiledGridModel(const std::string& fileName, bool verifyChecksum)
+    : file(new MemoryMappedFile(fileName)) {
+  const char* data = file->getData();
+  ModelHeader header;
+
+  if (file->getSize() < sizeof(header)) {
+    throw generation_exception("CompiledGridModel: not a compiled model");
+  }
+
+  std::memcpy(&header, data, sizeof(header));
+
+  if (std::memcmp(header.magic, modelMagic, sizeof(modelMagic)) != 0) {
+    throw generation_exception("CompiledGridModel: not a compiled model");
+  }
+
+  if (header.byteOrderMark != byteOrderMark) {
+    throw generation_exception("CompiledGridModel: compiled model has a different byte order");
+  }
+
+  if (header.version != modelVersion) {
+    throw generation_exception("CompiledGridModel: unsupported version of the compiled model");
+  }
+
+  if (header.headerChecksum != computeHeaderChecksum(header)) {
+    throw generation_exception("CompiledGridModel: header checksum mismatch");
+  }
+
+  if (file->getSize() < header.fileSize) {
+    throw generation_exception("CompiledGridModel: compiled model is truncated");
+  }
+
+  if (verifyChecksum &&
+      (MemoryMappedFile::computeChecksum(data + sizeof(header),
+                                         header.fileSize - sizeof(header)) !=
+       header.payloadChecksum)) {
+    throw generation_exception("CompiledGridModel: checksum mismatch");
+  }
+
+  dimension = header.dimension;
+  numberOfPoints = header.numberOfPoints;
+  numberOfSubspaces = header.numberOfSubspaces;
+  subspaceLevels = reinterpret_cast<const uint32_t*>(data + header.subspaceLevelsOffset);
+  subspaceStart = reinterpret_cast<const uint64_t*>(data + header.subspaceStartOffset);
+  keys = reinterpret_cast<const uint64_t*>(data + header.keysOffset);
+  gridPointSeq = reinterpret_cast<const uint64_t*>(data + header.gridPointSeqOffset);
+  coefficients = reinterpret_cast<const double*>(data + header.coefficientsOffset);
+
+  gridDescription.reset(
+      Grid::unserialize(std::string(data + header.descriptionOffset, header.descriptionSize)));
+
+  BoundingBox* boundingBox = gridDescription->getStorage().getBoundingBox();
+
+  for (size_t d = 0; d < dimension; d++) {
+    intervalOffset.push_back(boundingBox->getIntervalOffset(d));
+    intervalWidth.push_back(boundingBox->getIntervalWidth(d));
+  }
+}
+
+CompiledGridModel::~CompiledGridModel() {}
+
+void CompiledGridModel::transformPointToUnitCube(const double* point, double* unitPoint) const {
+  for (size_t d = 0; d < dimension; d++) {
+    unitPoint[d] = (point[d] - intervalOffset[d]) / intervalWidth[d];
+  }
+}
+
+bool CompiledGridModel::evalSubspace(size_t subspace, const double* unitPoint, size_t& position,
+                                     double& value) const {
+  const uint32_t* levels = subspaceLevels + subspace * dimension;
+  uint64_t key = 0;
+  size_t shift = 0;
+
+  // position of the hierarchical cell that contains the point
+  for (size_t d = 0; d < dimension; d++) {
+    const uint64_t cells = static_cast<uint64_t>(1) << (levels[d] - 1);
+    const double cell = std::floor(unitPoint[d] * static_cast<double>(cells));
+    const uint64_t k = (cell <= 0.0) ? 0 : std::min(static_cast<uint64_t>(cell), cells - 1);
+    key |= k << shift;
+    shift += levels[d] - 1;
+  }
+
+  const uint64_t first = subspaceStart[subspace];
+  const uint64_t last = subspaceStart[subspace + 1];
+
+  if (last - first == (static_cast<uint64_t>(1) << shift)) {
+    // full subspace
+    position = first + key;
+  } else {
+    const uint64_t* found = std::lower_bound(keys + first, keys + last, key);
+
+    if ((found == keys + last) || (*found != key)) {
+      return false;
+    }
+
+    position = found - keys;
+  }
+
+  SBasis& basis = gridDescription->getBasis();
+  value = 1.0;
+  shift = 0;
+
+  for (size_t d = 0; (d < dimension) && (value != 0.0); d++) {
+    const uint64_t k = (key >> shift) & ((static_cast<uint64_t>(1) << (levels[d] - 1)) - 1);
+    value *= basis.eval(levels[d], static_cast<unsigned int>(2 * k + 1), unitPoint[d]);
+    shift += levels[d] - 1;
+  }
+
+  return (value != 0.0);
+}
+
+double CompiledGridModel::eval(const DataVector& point) const {
+  std::vector<double> unitPoint(dimension);
+  transformPointToUnitCube(point.getPointer(), unitPoint.data());
+  double result = 0.0;
+  size_t position;
+  double value;
+
+  for (size_t s = 0; s < numberOfSubspaces; s++) {
+    if (evalSubspace(s, unitPoint.data(), position, value)) {
+      result += coefficients[position] * value;
+    }
+  }
+
+  return result;
+}
+
+double CompiledGridModel::eval(const DataVector& alpha, const DataVector& point) const {
+  if (alpha.getSize() != numberOfPoints) {
+    throw operation_exception("CompiledGridModel::eval: alpha has the wrong size");
+  }
+
+  std::vector<double> unitPoint(dimension);
+  transformPointToUnitCube(point.getPointer(), unitPoint.data());
+  double result = 0.0;
+  size_t position;
+  double value;
+
+  for (size_t s = 0; s < numberOfSubspaces; s++) {
+    if (evalSubspace(s, unitPoint.data(), position, value)) {
+      result += alpha[gridPointSeq[position]] * value;
+    }
+  }
+
+  return result;
+}
+
+void CompiledGridModel::mult(const DataVector& alpha, const DataMatrix& points,
+                             DataVector& result) const {
+  const bool useModel = (alpha.getSize() == 0);
+
+  if (!useModel && (alpha.getSize() != numberOfPoints)) {
+    throw operation_exception("CompiledGridModel::mult: alpha has the wrong size");
+  }
+
+  if (points.getNcols() != dimension) {
+    throw operation_exception("CompiledGridModel::mult: points have the wrong dimension");
+  }
+
+  const size_t numberOfEvalPoints = points.getNrows();
+  result.resize(numberOfEvalPoints);
+
+#pragma omp parallel
+  {
+    std::vector<double> unitPoint(dimension);
+    size_t position;
+    double value;
+
+#pragma omp for schedule(static)
+    for (size_t i = 0; i < numberOfEvalPoints; i++) {
+      transformPointToUnitCube(points.getPointer() + i * dimension, unitPoint.data());
+      double sum = 0.0;
+
+      for (size_t s = 0; s < numberOfSubspaces; s++) {
+        if (evalSubspace(s, unitPoint.data(), position, value)) {
+          sum += (useModel ? coefficients[position] : alpha[gridPointSeq[position]]) * value;
+        }
+      }
+
+      result[i] = sum;
+    }
+  }
+}
+
+void CompiledGridModel::multTranspose(const DataVector& source, const DataMatrix& points,
+                                      DataVector& result) const {
+  const size_t numberOfEvalPoints = points.getNrows();
+
+  if (source.getSize() != numberOfEvalPoints) {
+    throw operation_exception("CompiledGridModel::multTranspose: source has the wrong size");
+  }
+
+  if (points.getNcols() != dimension) {
+    throw operation_exception("CompiledGridModel::multTranspose: points have the wrong dimension");
+  }
+
+  DataMatrix unitPoints(numberOfEvalPoints, dimension);
+
+  for (size_t i = 0; i < numberOfEvalPoints; i++) {
+    transformPointToUnitCube(points.getPointer() + i * dimension,
+                             unitPoints.getPointer() + i * dimension);
+  }
+
+  result.resize(numberOfPoints);
+  result.setAll(0.0);
+
+  // the subspaces have disjoint grid points, hence the threads write to disjoint entries
+#pragma omp parallel for schedule(dynamic)
+  for (size_t s = 0; s < numberOfSubspaces; s++) {
+    size_t position;
+    double value;
+
+    for (size_t i = 0; i < numberOfEvalPoints; i++) {
+      if (evalSubspace(s, unitPoints.getPointer() + i * dimension, position, value)) {
+        result[gridPointSeq[position]] += source[i] * value;
+      }
+    }
+  }
+}
+
+DataVector CompiledGridModel::getCoefficients() const {
+  DataVector alpha(numberOfPoints);
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    alpha[gridPointSeq[i]] = coefficients[i];
+  }
+
+  return alpha;
+}
+
+Grid& CompiledGridModel::getGridDescription() const { return *gridDescription; }
+
+size_t CompiledGridModel::getDimension() const { return dimension; }
+
+size_t CompiledGridModel::getSize() const { return numberOfPoints; }
+
+size_t CompiledGridModel::getNumberOfSubspaces() const { return numberOfSubspaces; }
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,165 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMPILEDGRIDMODEL_HPP
+#define COMPILEDGRIDMODEL_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Read-only sparse grid function (grid and coefficients) for serving, stored in a
+ * memory-mapped file.
+ *
+ * The file is written by compile and contains the grid description (type, degree,
+ * bounding box) and an evaluation layout: the grid points are grouped by subspace and sorted
+ * by their position in the subspace, and the coefficients are stored in this order.
+ * Loading a model only maps the file and checks the header, i.e., its cost does not depend
+ * on the size of the grid. The file is mapped read-only and shared, such that all processes
+ * that serve the same model use the same physical memory.
+ *
+ * A point is evaluated subspace by subspace: the only grid point of the subspace whose
+ * support can contain the point is found by index calculations (and a binary search in
+ * subspaces that are not full). Therefore, only grid types whose basis functions are
+ * supported on the hierarchical cell of the grid point are supported (Linear, ModLinear,
+ * Poly, ModPoly). The evaluation points are given in the bounding box of the grid.
+ *
+ * The model can be evaluated with OperationEvalCompiledModel and
+ * OperationMultipleEvalCompiledModel.
+ */
+class CompiledGridModel {
+ public:
+  /**
+   * Writes a compiled model.
+   * Throws a factory_exception if the grid type is not supported.
+   *
+   * @param grid      grid
+   * @param alpha     coefficients of the grid points
+   * @param fileName  name of the file
+   */
+  static void compile(Grid& grid, const DataVector& alpha, const std::string& fileName);
+
+  /**
+   * Constructor. Maps a compiled model.
+   * Throws a generation_exception if the file is not a valid compiled model.
+   *
+   * @param fileName        name of the file
+   * @param verifyChecksum  whether to verify the checksum of the whole file
+   *                        (the header is always verified)
+   */
+  explicit CompiledGridModel(const std::string& fileName, bool verifyChecksum = false);
+
+  /**
+   * Destructor.
+   */
+  ~CompiledGridModel();
+
+  /**
+   * @param point   evaluation point
+   * @return        value of the model at the point
+   */
+  double eval(const DataVector& point) const;
+
+  /**
+   * @param alpha   coefficients in the order of the grid points of the compiled grid
+   * @param point   evaluation point
+   * @return        value of the grid function with the coefficients at the point
+   */
+  double eval(const DataVector& alpha, const DataVector& point) const;
+
+  /**
+   * Evaluates the grid function at many points (in parallel).
+   *
+   * @param      alpha    coefficients in the order of the grid points of the compiled grid,
+   *                      or an empty vector to evaluate the model
+   * @param      points   evaluation points (one per row)
+   * @param[out] result   values at the points
+   */
+  void mult(const DataVector& alpha, const DataMatrix& points, DataVector& result) const;
+
+  /**
+   * Evaluates the transposed evaluation matrix (in parallel).
+   *
+   * @param      source   values at the points
+   * @param      points   evaluation points (one per row)
+   * @param[out] result   result in the order of the grid points of the compiled grid
+   */
+  void multTranspose(const DataVector& source, const DataMatrix& points,
+                     DataVector& result) const;
+
+  /**
+   * @return coefficients in the order of the grid points of the compiled grid
+   */
+  DataVector getCoefficients() const;
+
+  /**
+   * @return grid with the type, the degree, and the bounding box of the compiled grid,
+   *         but without grid points
+   */
+  Grid& getGridDescription() const;
+
+  /**
+   * @return dimension
+   */
+  size_t getDimension() const;
+
+  /**
+   * @return number of grid points
+   */
+  size_t getSize() const;
+
+  /**
+   * @return number of subspaces
+   */
+  size_t getNumberOfSubspaces() const;
+
+ private:
+  /// mapped file
+  std::unique_ptr<MemoryMappedFile> file;
+  /// grid without grid points
+  std::unique_ptr<Grid> gridDescription;
+  /// dimension
+  size_t dimension;
+  /// number of grid points
+  size_t numberOfPoints;
+  /// number of subspaces
+  size_t numberOfSubspaces;
+  /// levels of the subspaces (numberOfSubspaces x dimension)
+  const uint32_t* subspaceLevels;
+  /// index of the first grid point of each subspace (numberOfSubspaces + 1 entries)
+  const uint64_t* subspaceStart;
+  /// position of the grid points in their subspace
+  const uint64_t* keys;
+  /// sequence numbers of the grid points in the compiled grid
+  const uint64_t* gridPointSeq;
+  /// coefficients of the grid points
+  const double* coefficients;
+  /// offsets of the bounding box
+  std::vector<double> intervalOffset;
+  /// widths of the bounding box
+  std::vector<double> intervalWidth;
+
+  void transformPointToUnitCube(const double* point, double* unitPoint) const;
+
+  bool evalSubspace(size_t subspace, const double* unitPoint, size_t& position,
+                    double& value) const;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* COMPILEDGRIDMODEL_HPP */
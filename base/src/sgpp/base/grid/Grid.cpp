@@ -585,7 +585,8 @@ GridType Grid::getZeroBoundaryType() {
 std::string Grid::getTypeAsString() { return typeVerboseMap()[getType()]; }
 
 Grid* Grid::unserializeFromFile(std::string filename) {
-  std::ifstream istr(filename);
+  // binary mode, as the file may contain a grid in the binary format
+  std::ifstream istr(filename, std::ios::binary);
   return Grid::unserialize(istr);
 }
 
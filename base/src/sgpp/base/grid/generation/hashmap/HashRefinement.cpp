@@ -11,11 +11,50 @@
 #include <vector>
 #include <algorithm>
 #include <memory>
+#include <utility>
 
 
 namespace sgpp {
 namespace base {
 
+namespace {
+
+/**
+ * Checks whether a grid point can be refined, i.e., whether not all of its children exist yet.
+ * Only reads the storage, so it can be called concurrently.
+ *
+ * @param storage hashmap that stores the grid points
+ * @param point grid point (modified during the check, restored afterwards)
+ * @return whether at least one child of the grid point is missing
+ */
+bool hasMissingChild(const GridStorage& storage, GridPoint& point) {
+  for (size_t d = 0; d < storage.getDimension(); d++) {
+    index_t source_index;
+    level_t source_level;
+    point.get(d, source_level, source_index);
+
+    // test existence of the left and the right child
+    point.set(d, source_level + 1, 2 * source_index - 1);
+    bool missing = !storage.isContaining(point);
+
+    if (!missing) {
+      point.set(d, source_level + 1, 2 * source_index + 1);
+      missing = !storage.isContaining(point);
+    }
+
+    // reset current grid point in dimension d
+    point.set(d, source_level, source_index);
+
+    if (missing) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace
+
 void HashRefinement::addElementToCollection(
   const GridStorage::grid_map_iterator& iter,
   AbstractRefinement::refinement_list_type current_value_list,
@@ -42,55 +81,74 @@ void HashRefinement::addElementToCollection(
 void HashRefinement::collectRefinablePoints(GridStorage& storage,
     RefinementFunctor& functor,
     AbstractRefinement::refinement_container_type& collection) {
-  size_t refinements_num = functor.getRefinementsNum();
-
-  // max value equals min value
-
-  GridPoint point;
-  GridStorage::grid_map_iterator end_iter = storage.end();
-
-  // start iterating over whole grid
-  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter;
-       iter++) {
-    point = *(iter->first);
-
-    GridStorage::grid_map_iterator child_iter;
-
-    // check for each grid point whether it can be refined
-    // (i.e., whether not all kids exist yet)
-    // if yes, check whether it belongs to the refinements_num largest ones
-    for (size_t d = 0; d < storage.getDimension(); d++) {
-      index_t source_index;
-      level_t source_level;
-      point.get(d, source_level, source_index);
-
-      // test existence of left child
-      point.set(d, source_level + 1, 2 * source_index - 1);
-      child_iter = storage.find(&point);
-
-      // if there no more grid points --> test if we should refine the grid
-      if (child_iter == end_iter) {
-        AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter, functor);
-        addElementToCollection(iter, current_value_list, refinements_num,
-                               collection);
-        break;
-      }
+  const size_t refinements_num = functor.getRefinementsNum();
+  const size_t numberOfPoints = storage.getSize();
 
-      // test existence of right child
-      point.set(d, source_level + 1, 2 * source_index + 1);
-      child_iter = storage.find(&point);
-
-      if (child_iter == end_iter) {
-        AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter, functor);
-        addElementToCollection(iter, current_value_list, refinements_num,
-                               collection);
-        break;
+  // check and score the grid points in parallel
+  // (the functor is only evaluated for grid points that can be refined)
+  std::vector<char> refinable(numberOfPoints);
+  std::vector<AbstractRefinement::refinement_value_type> values(numberOfPoints);
+
+#pragma omp parallel
+  {
+    GridPoint point;
+
+#pragma omp for schedule(static)
+    for (size_t seq = 0; seq < numberOfPoints; seq++) {
+      point = storage[seq];
+      refinable[seq] = hasMissingChild(storage, point);
+
+      if (refinable[seq]) {
+        values[seq] = functor(storage, seq);
       }
+    }
+  }
 
-      // reset current grid point in dimension d
-      point.set(d, source_level, source_index);
+  // select the refinements_num largest values serially with the same heap operations as
+  // addElementToCollection, such that the result (including the order of the collection
+  // and thus of the new grid points) does not depend on the number of threads;
+  // candidates are identified by their sequence numbers (or numberOfPoints + position for
+  // elements that are already in the collection), keys are only created for the winners
+  typedef std::pair<size_t, AbstractRefinement::refinement_value_type> candidate_type;
+  auto compareCandidates = [](const candidate_type& lhs, const candidate_type& rhs) {
+    return (lhs.second > rhs.second);
+  };
+
+  AbstractRefinement::refinement_container_type oldCollection;
+  oldCollection.swap(collection);
+  std::vector<candidate_type> heap;
+  heap.reserve(std::max(oldCollection.size(), std::min(refinements_num, numberOfPoints)) + 1);
+
+  for (size_t i = 0; i < oldCollection.size(); i++) {
+    heap.emplace_back(numberOfPoints + i, oldCollection[i].second);
+  }
+
+  // the map visits the grid points in the order of their sequence numbers
+  for (size_t seq = 0; seq < numberOfPoints; seq++) {
+    if (!refinable[seq]) {
+      continue;
+    }
+
+    heap.emplace_back(seq, values[seq]);
+    std::push_heap(heap.begin(), heap.end(), compareCandidates);
+
+    if (heap.size() > refinements_num) {
+      // remove the top (smallest) element
+      std::pop_heap(heap.begin(), heap.end(), compareCandidates);
+      heap.pop_back();
+    }
+  }
+
+  collection.reserve(heap.size());
+
+  for (const candidate_type& candidate : heap) {
+    if (candidate.first < numberOfPoints) {
+      collection.emplace_back(
+        std::make_shared<AbstractRefinement::refinement_key_type>(
+          storage[candidate.first], candidate.first),
+        candidate.second);
+    } else {
+      collection.push_back(oldCollection[candidate.first - numberOfPoints]);
     }
   }
 }
@@ -147,50 +205,24 @@ void HashRefinement::free_refine(GridStorage& storage,
 }
 
 size_t HashRefinement::getNumberOfRefinablePoints(GridStorage& storage) {
-  size_t counter = 0;
-
   if (storage.getSize() == 0) {
     throw generation_exception("storage empty");
   }
 
-  GridPoint point;
-  GridStorage::grid_map_iterator end_iter = storage.end();
-
-  // start iterating over whole grid
-  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter;
-       iter++) {
-    point = *(iter->first);
-
-    GridStorage::grid_map_iterator child_iter;
-
-    // check for each grid point whether it can be refined
-    // (i.e., whether not all children exist yet)
-    for (size_t d = 0; d < storage.getDimension(); d++) {
-      index_t source_index;
-      level_t source_level;
-      point.get(d, source_level, source_index);
-
-      // test existence of the left child
-      point.set(d, source_level + 1, 2 * source_index - 1);
-      child_iter = storage.find(&point);
+  const size_t numberOfPoints = storage.getSize();
+  size_t counter = 0;
 
-      // if there no more grid points --> test if we should refine the grid
-      if (child_iter == end_iter) {
-        counter++;
-        break;
-      }
+#pragma omp parallel reduction(+ : counter)
+  {
+    GridPoint point;
 
-      // test existence of the right child
-      point.set(d, source_level + 1, 2 * source_index + 1);
-      child_iter = storage.find(&point);
+#pragma omp for schedule(static)
+    for (size_t seq = 0; seq < numberOfPoints; seq++) {
+      point = storage[seq];
 
-      if (child_iter == end_iter) {
+      if (hasMissingChild(storage, point)) {
         counter++;
-        break;
       }
-
-      // reset current grid point in dimension d
-      point.set(d, source_level, source_index);
     }
   }
 
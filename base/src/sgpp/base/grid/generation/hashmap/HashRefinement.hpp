@@ -43,6 +43,7 @@ class HashRefinement: public AbstractRefinement {
   /**
    * Computes and returns the number of grid points, which can be refined.
    * This is the number of grid points that have at least one child missing.
+   * The grid points are checked in parallel (OpenMP).
    *
    * @param storage hashmap that stores the grid points
    * @return The number of grid points that can be refined
@@ -83,6 +84,11 @@ class HashRefinement: public AbstractRefinement {
   /**
   * Examines the grid points and stores the indices those that can be refined
   * and have maximal indicator values.
+  * The grid points are checked and the functor is evaluated in parallel (OpenMP),
+  * so the functor has to be safe to call concurrently. The selection is serial and
+  * yields the same collection (in the same order) as addElementToCollection applied
+  * to the grid points in the order of their sequence numbers, independent of the
+  * number of threads. getIndicator is not used.
   *
   * @param storage hashmap that stores the grid points
   * @param functor a PredictiveRefinementIndicator specifying the refinement criteria
@@ -8,6 +8,7 @@
 
 #include <sys/types.h>
 
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -21,44 +22,36 @@ namespace sgpp {
 namespace base {
 
 HashGridPoint::HashGridPoint(size_t dimension)
-    : dimension(dimension), level(nullptr), index(nullptr), hInv(nullptr), hash(0) {
-  level = new level_type[dimension];
-  index = new index_type[dimension];
-  hInv = new index_type[dimension];
-  leaf = false;
+    : dimension(dimension), level(nullptr), index(nullptr), leaf(false), ownsMemory(true),
+      hash(0) {
+  level = new level_type[2 * dimension];
+  index = level + dimension;
+  // the hash is updated incrementally by set, so it has to match the initial levels and indices
+  std::fill(level, level + 2 * dimension, 0);
+  rehash();
 }
 
 HashGridPoint::HashGridPoint()
-    : dimension(0), level(nullptr), index(nullptr), hInv(nullptr), hash(0) {
-  leaf = false;
-}
+    : dimension(0), level(nullptr), index(nullptr), leaf(false), ownsMemory(true), hash(0) {}
 
 HashGridPoint::HashGridPoint(const HashGridPoint& o)
-    : dimension(o.dimension), level(nullptr), index(nullptr), hInv(nullptr), hash(0) {
-  level = new level_type[dimension];
-  index = new index_type[dimension];
-  hInv = new index_type[dimension];
-  leaf = false;
-
-  for (size_t d = 0; d < dimension; d++) {
-    level[d] = o.level[d];
-    index[d] = o.index[d];
-  }
-
+    : dimension(o.dimension), level(nullptr), index(nullptr), leaf(false), ownsMemory(true),
+      hash(0) {
+  level = new level_type[2 * dimension];
+  index = level + dimension;
+  std::copy(o.level, o.level + 2 * dimension, level);
   leaf = o.leaf;
-  rehash();
+  hash = o.hash;
 }
 
 HashGridPoint::HashGridPoint(std::istream& istream, int version)
-    : dimension(0), level(nullptr), index(nullptr), hInv(nullptr), hash(0) {
+    : dimension(0), level(nullptr), index(nullptr), leaf(false), ownsMemory(true), hash(0) {
   size_t temp_leaf;
 
   istream >> dimension;
 
-  level = new level_type[dimension];
-  index = new index_type[dimension];
-  hInv = new index_type[dimension];
-  leaf = false;
+  level = new level_type[2 * dimension];
+  index = level + dimension;
 
   for (size_t d = 0; d < dimension; d++) {
     istream >> level[d];
@@ -92,17 +85,20 @@ HashGridPoint::HashGridPoint(std::istream& istream, int version)
  * Destructor
  */
 HashGridPoint::~HashGridPoint() {
-  if (level) {
+  if (ownsMemory && level) {
     delete[] level;
   }
+}
 
-  if (index) {
-    delete[] index;
+void HashGridPoint::attach(size_t dimension, level_type* buffer) {
+  if (ownsMemory && level) {
+    delete[] level;
   }
 
-  if (hInv) {
-    delete[] hInv;
-  }
+  this->dimension = dimension;
+  level = buffer;
+  index = buffer + dimension;
+  ownsMemory = false;
 }
 
 void HashGridPoint::serialize(std::ostream& ostream, int version) {
@@ -152,8 +148,7 @@ void HashGridPoint::rehash() {
   size_t hash = 0xdeadbeef;
 
   for (size_t d = 0; d < dimension; d++) {
-    hInv[d] = static_cast<index_type>(1) << level[d];
-    hash = hInv[d] + index[d] + hash * 65599;
+    hash = (static_cast<index_type>(1) << level[d]) + index[d] + hash * 65599;
   }
 
   this->hash = hash;
@@ -162,19 +157,10 @@ void HashGridPoint::rehash() {
 size_t HashGridPoint::getHash() const { return hash; }
 
 bool HashGridPoint::equals(const HashGridPoint& rhs) const {
-  for (size_t d = 0; d < dimension; d++) {
-    if (level[d] != rhs.level[d]) {
-      return false;
-    }
-  }
-
-  for (size_t d = 0; d < dimension; d++) {
-    if (index[d] != rhs.index[d]) {
-      return false;
-    }
-  }
-
-  return true;
+  // levels and indices are stored in one block, so compare them as a whole
+  // (memcmp compares whole machine words instead of single entries)
+  return (dimension == rhs.dimension) &&
+         (std::memcmp(level, rhs.level, 2 * dimension * sizeof(level_type)) == 0);
 }
 
 HashGridPoint& HashGridPoint::assign(const HashGridPoint& rhs) { return this->operator=(rhs); }
@@ -185,33 +171,22 @@ HashGridPoint& HashGridPoint::operator=(const HashGridPoint& rhs) {
   }
 
   if (dimension != rhs.dimension) {
-    if (level) {
+    if (ownsMemory && level) {
       delete[] level;
     }
 
-    if (index) {
-      delete[] index;
-    }
-
-    if (hInv) {
-      delete[] hInv;
-    }
-
+    // a gridpoint living in an external buffer can't grow in place,
+    // so it gets its own memory from now on
     dimension = rhs.dimension;
-
-    level = new level_type[dimension];
-    index = new index_type[dimension];
-    hInv = new index_type[dimension];
-  }
-
-  for (size_t d = 0; d < dimension; d++) {
-    level[d] = rhs.level[d];
-    index[d] = rhs.index[d];
+    level = new level_type[2 * dimension];
+    index = level + dimension;
+    ownsMemory = true;
   }
 
+  // levels and indices are stored in one block
+  std::copy(rhs.level, rhs.level + 2 * dimension, level);
   leaf = rhs.leaf;
-
-  rehash();
+  hash = rhs.hash;
   return *this;
 }
 
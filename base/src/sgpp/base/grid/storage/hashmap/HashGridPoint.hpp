@@ -17,11 +17,14 @@
 #include <cmath>
 #include <algorithm>
 #include <map>
+#include <type_traits>
 #include <vector>
 
 namespace sgpp {
 namespace base {
 
+class HashGridPointPool;
+
 /**
  * This Class represents one Gridpoint.
  *
@@ -37,6 +40,9 @@ class HashGridPoint {
   /// index type
   typedef uint32_t index_type;
 
+  static_assert(std::is_same<level_type, index_type>::value,
+                "levels and indices share one contiguous buffer");
+
   /**
    * Constructor of a n-Dim gridpoint
    *
@@ -85,22 +91,22 @@ class HashGridPoint {
   size_t getDimension() const;
 
   /**
-   * Sets level <i>l</i> and index <i>i</i> in dimension <i>d</i> and rehashs the HashGridPoint
-   * object
+   * Sets level <i>l</i> and index <i>i</i> in dimension <i>d</i> and updates the hash of the
+   * HashGridPoint object
    *
    * @param d the dimension in which the ansatzfunction is set
    * @param l the level of the ansatzfunction
    * @param i the index of the ansatzfunction
    */
   inline void set(size_t d, level_type l, index_type i) {
+    updateHash(d, l, i);
     level[d] = l;
     index[d] = i;
-    rehash();
   }
 
   /**
-   * Sets level <i>l</i> and index <i>i</i> in dimension <i>d</i> and the Leaf property and rehashs
-   * the HashGridPoint object
+   * Sets level <i>l</i> and index <i>i</i> in dimension <i>d</i> and the Leaf property and updates
+   * the hash of the HashGridPoint object
    *
    * @param d the dimension in which the ansatzfunction is set
    * @param l the level of the ansatzfunction
@@ -108,28 +114,29 @@ class HashGridPoint {
    * @param isLeaf specifies if this gridpoint has any childrens in any dimension
    */
   inline void set(size_t d, level_type l, index_type i, bool isLeaf) {
+    updateHash(d, l, i);
     level[d] = l;
     index[d] = i;
     leaf = isLeaf;
-    rehash();
   }
 
   /**
-   * Sets level <i>l</i> and index <i>i</i> in dimension <i>d</i> and doesn't rehash the
-   * HashGridPoint object
+   * Sets level <i>l</i> and index <i>i</i> in dimension <i>d</i>.
+   * As the hash is updated incrementally, this is the same as set() nowadays.
    *
    * @param d the dimension in which the ansatzfunction is set
    * @param l the level of the ansatzfunction
    * @param i the index of the ansatzfunction
    */
   inline void push(size_t d, level_type l, index_type i) {
+    updateHash(d, l, i);
     level[d] = l;
     index[d] = i;
   }
 
   /**
-   * Sets level <i>l</i> and index <i>i</i> in dimension <i>d</i> and the Leaf property and doesn't
-   * rehash the HashGridPoint object
+   * Sets level <i>l</i> and index <i>i</i> in dimension <i>d</i> and the Leaf property.
+   * As the hash is updated incrementally, this is the same as set() nowadays.
    *
    * @param d the dimension in which the ansatzfunction is set
    * @param l the level of the ansatzfunction
@@ -137,6 +144,7 @@ class HashGridPoint {
    * @param isLeaf specifies if this gridpoint has any childrens in any dimension
    */
   inline void push(size_t d, level_type l, index_type i, bool isLeaf) {
+    updateHash(d, l, i);
     level[d] = l;
     index[d] = i;
     leaf = isLeaf;
@@ -195,7 +203,8 @@ class HashGridPoint {
    */
   inline double getStandardCoordinate(size_t d) const {
     // cast 1 to index_type to ensure that 1 << level[d] doesn't overflow
-    return static_cast<double>(index[d]) / static_cast<double>(hInv[d]);
+    return static_cast<double>(index[d]) /
+           static_cast<double>(static_cast<index_type>(1) << level[d]);
   }
 
   /**
@@ -216,7 +225,7 @@ class HashGridPoint {
   bool isInnerPoint() const;
 
   /**
-   * rehashs the current gridpoint and sets hInv
+   * rehashs the current gridpoint
    */
   void rehash();
 
@@ -448,16 +457,57 @@ class HashGridPoint {
   bool isHierarchicalAncestor(HashGridPoint& gpj, size_t dim);
 
  private:
+  /**
+   * Lets the gridpoint use an externally managed buffer of 2 * dimension entries
+   * (levels followed by indices) instead of its own memory.
+   * Used by HashGridPointPool to place the gridpoints of a storage contiguously.
+   *
+   * @param dimension the dimension of the gridpoint
+   * @param buffer    buffer for the levels and indices, has to outlive the gridpoint
+   */
+  void attach(size_t dimension, level_type* buffer);
+
+  /**
+   * The hash is a polynomial in the per-dimension keys (2^l + i), so changing
+   * one dimension only changes one term. Updating the hash this way takes
+   * O(log(dimension)) instead of the O(dimension) of rehash().
+   * Has to be called before the new level and index are stored.
+   *
+   * @param d the dimension that changes
+   * @param l the new level in dimension d
+   * @param i the new index in dimension d
+   */
+  inline void updateHash(size_t d, level_type l, index_type i) {
+    // the keys are summed up in index_type arithmetic in rehash(), too
+    const size_t oldKey = static_cast<index_type>((static_cast<index_type>(1) << level[d]) +
+                                                  index[d]);
+    const size_t newKey = static_cast<index_type>((static_cast<index_type>(1) << l) + i);
+
+    // factor of the term of dimension d is 65599^(dimension - 1 - d)
+    size_t factor = 1;
+    size_t base = 65599;
+
+    for (size_t k = dimension - 1 - d; k > 0; k >>= 1) {
+      if ((k & 1) != 0) {
+        factor *= base;
+      }
+
+      base *= base;
+    }
+
+    hash += (newKey - oldKey) * factor;
+  }
+
   /// the dimension of the gridpoint
   size_t dimension;
   /// pointer to array that stores the ansatzfunctions' level
   level_type* level;
-  /// pointer to array that stores the ansatzfunctions' indices
+  /// pointer to array that stores the ansatzfunctions' indices (directly follows level)
   index_type* index;
-  /// pointer to array that stores the mesh widths (1 << level[d] for each dimension)
-  index_type* hInv;
   /// stores if this gridpoint is a leaf
   bool leaf;
+  /// true if level and index have been allocated by this gridpoint and have to be freed
+  bool ownsMemory;
   /// stores the hashvalue of the gridpoint
   size_t hash;
 
@@ -469,6 +519,7 @@ class HashGridPoint {
   friend struct HashGridPointPointerEqualityFunctor;
   friend struct HashGridPointHashFunctor;
   friend struct HashGridPointEqualityFunctor;
+  friend class HashGridPointPool;
 };
 
 struct HashGridPointPointerHashFunctor {
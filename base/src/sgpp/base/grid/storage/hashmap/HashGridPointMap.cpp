@@ -0,0 +1,269 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/storage/hashmap/HashGridPointMap.hpp>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+const size_t HashGridPointMap::npos;
+const size_t HashGridPointMap::groupWidth;
+const int8_t HashGridPointMap::ctrlEmpty;
+const int8_t HashGridPointMap::ctrlDeleted;
+
+namespace {
+
+/**
+ * @param group control bytes of a group (16 bytes)
+ * @param tag   control byte to search for
+ * @return bit mask of the slots in the group whose control byte equals tag
+ */
+inline uint32_t matchGroup(const int8_t* group, int8_t tag) {
+#if defined(__SSE2__)
+  __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+  return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(tag))));
+#else
+  uint32_t mask = 0;
+
+  for (uint32_t k = 0; k < 16; k++) {
+    if (group[k] == tag) {
+      mask |= (1u << k);
+    }
+  }
+
+  return mask;
+#endif
+}
+
+/**
+ * @param group control bytes of a group (16 bytes)
+ * @return bit mask of the slots in the group that are empty or deleted (sign bit set)
+ */
+inline uint32_t matchEmptyOrDeleted(const int8_t* group) {
+#if defined(__SSE2__)
+  __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+  return static_cast<uint32_t>(_mm_movemask_epi8(ctrl));
+#else
+  uint32_t mask = 0;
+
+  for (uint32_t k = 0; k < 16; k++) {
+    if (group[k] < 0) {
+      mask |= (1u << k);
+    }
+  }
+
+  return mask;
+#endif
+}
+
+/**
+ * @param mask non-zero bit mask
+ * @return position of the lowest set bit
+ */
+inline uint32_t lowestBit(uint32_t mask) {
+#if defined(__GNUC__)
+  return static_cast<uint32_t>(__builtin_ctz(mask));
+#else
+  uint32_t k = 0;
+
+  while ((mask & 1u) == 0) {
+    mask >>= 1;
+    k++;
+  }
+
+  return k;
+#endif
+}
+
+}  // namespace
+
+HashGridPointMap::HashGridPointMap(const point_list& points)
+    : points(points), ctrl(), slots(), groupMask(0), numFull(0), numDeleted(0) {
+  resize(1);
+}
+
+HashGridPointMap::~HashGridPointMap() {}
+
+size_t HashGridPointMap::findSlot(const HashGridPoint& point, uint64_t h) const {
+  const int8_t tag = static_cast<int8_t>(h & 0x7F);
+  size_t group = static_cast<size_t>(h >> 7) & groupMask;
+
+  // triangular probing visits every group once, as the number of groups is a power of two
+  for (size_t step = 1; step <= groupMask + 1; step++) {
+    const size_t offset = group * groupWidth;
+    uint32_t mask = matchGroup(&ctrl[offset], tag);
+
+    while (mask != 0) {
+      const size_t slot = offset + lowestBit(mask);
+      const HashGridPoint& candidate = *points[slots[slot]];
+
+      if ((candidate.getHash() == point.getHash()) && candidate.equals(point)) {
+        return slot;
+      }
+
+      mask &= mask - 1;
+    }
+
+    // an empty slot terminates the probe sequence
+    if (matchGroup(&ctrl[offset], ctrlEmpty) != 0) {
+      return npos;
+    }
+
+    group = (group + step) & groupMask;
+  }
+
+  return npos;
+}
+
+size_t HashGridPointMap::find(const HashGridPoint& point) const {
+  const size_t slot = findSlot(point, mixHash(point));
+  return (slot == npos) ? npos : slots[slot];
+}
+
+void HashGridPointMap::find(const HashGridPoint* const* points, size_t count,
+                            size_t* seqs) const {
+  const size_t blockSize = 16;
+  uint64_t hashes[blockSize];
+
+  for (size_t start = 0; start < count; start += blockSize) {
+    const size_t end = std::min(start + blockSize, count);
+
+    // first pass: compute the hashes and prefetch the first group of each probe sequence
+    for (size_t k = start; k < end; k++) {
+      hashes[k - start] = mixHash(*points[k]);
+#if defined(__GNUC__)
+      const size_t group = static_cast<size_t>(hashes[k - start] >> 7) & groupMask;
+      __builtin_prefetch(&ctrl[group * groupWidth]);
+      __builtin_prefetch(&slots[group * groupWidth]);
+#endif
+    }
+
+    // second pass: probe
+    for (size_t k = start; k < end; k++) {
+      const size_t slot = findSlot(*points[k], hashes[k - start]);
+      seqs[k] = (slot == npos) ? npos : slots[slot];
+    }
+  }
+}
+
+void HashGridPointMap::insertNew(uint64_t h, size_t seq) {
+  size_t group = static_cast<size_t>(h >> 7) & groupMask;
+
+  for (size_t step = 1;; step++) {
+    const size_t offset = group * groupWidth;
+    const uint32_t mask = matchEmptyOrDeleted(&ctrl[offset]);
+
+    if (mask != 0) {
+      const size_t slot = offset + lowestBit(mask);
+
+      if (ctrl[slot] == ctrlDeleted) {
+        numDeleted--;
+      }
+
+      ctrl[slot] = static_cast<int8_t>(h & 0x7F);
+      slots[slot] = seq;
+      numFull++;
+      return;
+    }
+
+    group = (group + step) & groupMask;
+  }
+}
+
+void HashGridPointMap::insert(const HashGridPoint& point, size_t seq) {
+  const uint64_t h = mixHash(point);
+  const size_t slot = findSlot(point, h);
+
+  if (slot != npos) {
+    slots[slot] = seq;
+    return;
+  }
+
+  // keep the load factor (including deleted slots) below 7/8
+  const size_t capacity = (groupMask + 1) * groupWidth;
+
+  if (8 * (numFull + numDeleted + 1) > 7 * capacity) {
+    // only grow if the map is really full, otherwise just clean up the deleted slots
+    resize((2 * (numFull + 1) > capacity) ? 2 * (groupMask + 1) : groupMask + 1);
+  }
+
+  insertNew(h, seq);
+}
+
+bool HashGridPointMap::erase(const HashGridPoint& point) {
+  const size_t slot = findSlot(point, mixHash(point));
+
+  if (slot == npos) {
+    return false;
+  }
+
+  ctrl[slot] = ctrlDeleted;
+  numFull--;
+  numDeleted++;
+  return true;
+}
+
+void HashGridPointMap::clear() {
+  std::fill(ctrl.begin(), ctrl.end(), ctrlEmpty);
+  numFull = 0;
+  numDeleted = 0;
+}
+
+void HashGridPointMap::rebuild() {
+  // choose the number of groups such that the load factor is at most 1/2
+  size_t numGroups = 1;
+
+  while (numGroups * groupWidth < 2 * points.size()) {
+    numGroups *= 2;
+  }
+
+  ctrl.assign(numGroups * groupWidth, ctrlEmpty);
+  slots.assign(numGroups * groupWidth, 0);
+  groupMask = numGroups - 1;
+  numFull = 0;
+  numDeleted = 0;
+
+  for (size_t seq = 0; seq < points.size(); seq++) {
+    insert(*points[seq], seq);
+  }
+}
+
+void HashGridPointMap::resize(size_t numGroups) {
+  std::vector<int8_t> oldCtrl(numGroups * groupWidth, ctrlEmpty);
+  std::vector<size_t> oldSlots(numGroups * groupWidth, 0);
+  oldCtrl.swap(ctrl);
+  oldSlots.swap(slots);
+  groupMask = numGroups - 1;
+  numFull = 0;
+  numDeleted = 0;
+
+  for (size_t slot = 0; slot < oldCtrl.size(); slot++) {
+    if (oldCtrl[slot] >= 0) {
+      insertNew(mixHash(*points[oldSlots[slot]]), oldSlots[slot]);
+    }
+  }
+}
+
+size_t HashGridPointMap::size() const { return numFull; }
+
+HashGridPointMap::iterator HashGridPointMap::begin() const {
+  return iteratorAt(points.empty() ? npos : 0);
+}
+
+HashGridPointMap::iterator HashGridPointMap::end() const { return iteratorAt(npos); }
+
+HashGridPointMap::iterator HashGridPointMap::iteratorAt(size_t seq) const {
+  return iterator(&points, seq);
+}
+
+}  // namespace base
+}  // namespace sgpp
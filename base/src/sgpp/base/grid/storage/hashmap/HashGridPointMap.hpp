@@ -0,0 +1,232 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef HASHGRIDPOINTMAP_HPP
+#define HASHGRIDPOINTMAP_HPP
+
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Open addressing hash map from grid points to their sequence numbers.
+ *
+ * The map stores only the sequence numbers; the grid points themselves are
+ * looked up in the point list of the HashGridStorage the map belongs to.
+ * The layout follows the "Swiss table" design: the slots are divided into groups of
+ * 16 slots, and for every slot a control byte stores whether the slot is empty,
+ * deleted, or full, and in the latter case 7 bits of the hash of the point.
+ * A lookup compares the control bytes of a whole group with one SSE2 instruction
+ * and only compares grid points for slots with matching hash bits.
+ *
+ * Iterating over the map visits the grid points in the order of their
+ * sequence numbers, which is deterministic (as opposed to std::unordered_map).
+ */
+class HashGridPointMap {
+ public:
+  /// pointer to grid points
+  typedef HashGridPoint* point_pointer;
+  /// list of grid points, indexed by sequence number
+  typedef std::vector<point_pointer> point_list;
+  /// value type of the iterators, (grid point, sequence number)
+  typedef std::pair<point_pointer, size_t> value_type;
+
+  /// sequence number returned by find if the grid point is not contained
+  static const size_t npos = std::numeric_limits<size_t>::max();
+
+  /**
+   * Iterator over the (grid point, sequence number) pairs of the map,
+   * in the order of the sequence numbers.
+   * The end iterator stays valid when grid points are inserted.
+   */
+  class iterator {
+   public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef HashGridPointMap::value_type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const value_type* pointer;
+    typedef const value_type& reference;
+
+    iterator() : points(nullptr), entry(nullptr, npos) {}
+
+    iterator(const point_list* points, size_t seq)
+        : points(points), entry((seq == npos) ? nullptr : (*points)[seq], seq) {}
+
+    reference operator*() const { return entry; }
+
+    pointer operator->() const { return &entry; }
+
+    iterator& operator++() {
+      size_t seq = entry.second + 1;
+      *this = (seq < points->size()) ? iterator(points, seq) : iterator(points, npos);
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator result(*this);
+      ++(*this);
+      return result;
+    }
+
+    bool operator==(const iterator& other) const { return entry.second == other.entry.second; }
+
+    bool operator!=(const iterator& other) const { return entry.second != other.entry.second; }
+
+   private:
+    /// list of grid points
+    const point_list* points;
+    /// current (grid point, sequence number) pair
+    value_type entry;
+  };
+
+  /// iterators and constant iterators coincide, as the map only stores sequence numbers
+  typedef iterator const_iterator;
+
+  /**
+   * Constructor
+   *
+   * @param points list of grid points the stored sequence numbers refer to
+   */
+  explicit HashGridPointMap(const point_list& points);
+
+  /**
+   * Destructor
+   */
+  ~HashGridPointMap();
+
+  /**
+   * @param point grid point
+   * @return sequence number of the grid point, or npos if the point is not contained
+   */
+  size_t find(const HashGridPoint& point) const;
+
+  /**
+   * Looks up several grid points at once. The hash groups of all points are
+   * prefetched before probing, such that the memory accesses overlap.
+   *
+   * @param      points array of count pointers to grid points
+   * @param      count  number of grid points
+   * @param[out] seqs   array of count sequence numbers (npos for points not contained)
+   */
+  void find(const HashGridPoint* const* points, size_t count, size_t* seqs) const;
+
+  /**
+   * Inserts a grid point or updates the sequence number of a contained grid point.
+   * The point list has to contain the point at position seq.
+   *
+   * @param point grid point
+   * @param seq   sequence number of the grid point
+   */
+  void insert(const HashGridPoint& point, size_t seq);
+
+  /**
+   * Removes a grid point from the map.
+   *
+   * @param point grid point
+   * @return whether the point was contained
+   */
+  bool erase(const HashGridPoint& point);
+
+  /**
+   * Removes all grid points from the map.
+   */
+  void clear();
+
+  /**
+   * Clears the map and inserts all points of the point list with their positions
+   * as sequence numbers.
+   */
+  void rebuild();
+
+  /**
+   * @return number of grid points in the map
+   */
+  size_t size() const;
+
+  /**
+   * @return iterator pointing to the grid point with sequence number 0
+   */
+  iterator begin() const;
+
+  /**
+   * @return iterator pointing past the last grid point
+   */
+  iterator end() const;
+
+  /**
+   * @param seq sequence number
+   * @return iterator pointing to the grid point with the given sequence number
+   *         (or end() if seq is npos)
+   */
+  iterator iteratorAt(size_t seq) const;
+
+ private:
+  /// number of slots per group
+  static const size_t groupWidth = 16;
+  /// control byte of an empty slot
+  static const int8_t ctrlEmpty = -128;
+  /// control byte of a deleted slot
+  static const int8_t ctrlDeleted = -2;
+
+  /**
+   * @param point grid point
+   * @return mixed hash of the grid point, the lower 7 bits are stored in the control bytes
+   */
+  static inline uint64_t mixHash(const HashGridPoint& point) {
+    // the hash of HashGridPoint has weak lower bits, so scramble it
+    uint64_t h = static_cast<uint64_t>(point.getHash()) * 0x9E3779B97F4A7C15ULL;
+    return h ^ (h >> 32);
+  }
+
+  /**
+   * @param point grid point
+   * @param h     mixed hash of the grid point
+   * @return slot containing the point or npos
+   */
+  size_t findSlot(const HashGridPoint& point, uint64_t h) const;
+
+  /**
+   * Resizes the slot arrays and reinserts all points.
+   *
+   * @param numGroups new number of groups (power of two)
+   */
+  void resize(size_t numGroups);
+
+  /**
+   * Inserts a point that is known not to be contained in the map.
+   *
+   * @param h   mixed hash of the point
+   * @param seq sequence number of the point
+   */
+  void insertNew(uint64_t h, size_t seq);
+
+  /// list of grid points the stored sequence numbers refer to
+  const point_list& points;
+  /// control bytes of the slots
+  std::vector<int8_t> ctrl;
+  /// sequence numbers stored in the slots
+  std::vector<size_t> slots;
+  /// number of groups - 1 (the number of groups is a power of two)
+  size_t groupMask;
+  /// number of full slots
+  size_t numFull;
+  /// number of deleted slots
+  size_t numDeleted;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* HASHGRIDPOINTMAP_HPP */
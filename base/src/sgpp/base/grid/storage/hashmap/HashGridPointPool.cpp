@@ -0,0 +1,120 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/storage/hashmap/HashGridPointPool.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+HashGridPointPool::HashGridPointPool(size_t dimension)
+    : dimension(dimension), chunks(), usedInLastChunk(0), freePoints() {}
+
+HashGridPointPool::~HashGridPointPool() {}
+
+HashGridPoint* HashGridPointPool::allocate(const HashGridPoint& point) {
+  if (point.getDimension() != dimension) {
+    return new HashGridPoint(point);
+  }
+
+  HashGridPoint* result;
+
+  if (!freePoints.empty()) {
+    result = freePoints.back();
+    freePoints.pop_back();
+  } else {
+    if (chunks.empty() || (usedInLastChunk == chunks.back().size)) {
+      // grow geometrically, such that small grids stay small
+      // and large grids need only few chunks
+      Chunk chunk;
+      chunk.size = chunks.empty() ? initialChunkSize
+                                  : std::min(2 * chunks.back().size, maxChunkSize);
+      chunk.points.reset(new HashGridPoint[chunk.size]);
+      chunk.levelIndex.reset(new HashGridPoint::level_type[2 * dimension * chunk.size],
+                             std::default_delete<HashGridPoint::level_type[]>());
+      chunks.push_back(std::move(chunk));
+      usedInLastChunk = 0;
+    }
+
+    Chunk& chunk = chunks.back();
+    result = &chunk.points[usedInLastChunk];
+    result->attach(dimension, chunk.levelIndex.get() + 2 * dimension * usedInLastChunk);
+    usedInLastChunk++;
+  }
+
+  *result = point;
+  return result;
+}
+
+HashGridPoint* HashGridPointPool::allocate(
+    size_t count, std::shared_ptr<HashGridPoint::level_type> levelIndex) {
+  if (count == 0) {
+    return nullptr;
+  }
+
+  Chunk chunk;
+  chunk.size = count;
+  chunk.points.reset(new HashGridPoint[count]);
+  chunk.levelIndex = std::move(levelIndex);
+
+  for (size_t i = 0; i < count; i++) {
+    chunk.points[i].attach(dimension, chunk.levelIndex.get() + 2 * dimension * i);
+  }
+
+  HashGridPoint* result = chunk.points.get();
+  chunks.push_back(std::move(chunk));
+  // the chunk is full, the next allocation starts a new one
+  usedInLastChunk = count;
+  return result;
+}
+
+void HashGridPointPool::release(HashGridPoint* point) {
+  if (isPooled(point)) {
+    freePoints.push_back(point);
+  } else {
+    delete point;
+  }
+}
+
+void HashGridPointPool::reset(size_t dimension) {
+  this->dimension = dimension;
+  chunks.clear();
+  usedInLastChunk = 0;
+  freePoints.clear();
+}
+
+size_t HashGridPointPool::getDimension() const { return dimension; }
+
+size_t HashGridPointPool::getCapacity() const {
+  size_t capacity = 0;
+
+  for (const Chunk& chunk : chunks) {
+    capacity += chunk.size;
+  }
+
+  return capacity;
+}
+
+bool HashGridPointPool::isPooled(const HashGridPoint* point) const {
+  // there are only few chunks, as they grow geometrically up to maxChunkSize
+  for (const Chunk& chunk : chunks) {
+    const HashGridPoint* first = chunk.points.get();
+    std::less<const HashGridPoint*> less;
+
+    if (!less(point, first) && less(point, first + chunk.size)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace base
+}  // namespace sgpp
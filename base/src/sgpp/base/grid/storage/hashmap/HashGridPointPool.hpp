@@ -0,0 +1,130 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef HASHGRIDPOINTPOOL_HPP
+#define HASHGRIDPOINTPOOL_HPP
+
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Chunked memory pool for the grid points of a HashGridStorage.
+ *
+ * Instead of allocating every HashGridPoint and its level and index arrays separately
+ * on the heap, the pool hands out grid points from large chunks. Each chunk consists of
+ * one array of HashGridPoint objects and one array holding the levels and indices of
+ * all points of the chunk (point by point, levels followed by indices).
+ * Points that are inserted one after another thus lie next to each other in memory,
+ * which saves millions of small allocations and keeps iterations over the grid
+ * cache-friendly. Addresses of allocated points stay valid until they are released.
+ */
+class HashGridPointPool {
+ public:
+  /**
+   * Constructor
+   *
+   * @param dimension dimension of the grid points managed by the pool
+   */
+  explicit HashGridPointPool(size_t dimension);
+
+  /**
+   * Destructor, frees all chunks
+   */
+  ~HashGridPointPool();
+
+  /**
+   * Creates a copy of a grid point in the pool.
+   * If the dimension of the point doesn't match the pool's dimension,
+   * the copy is allocated separately on the heap.
+   *
+   * @param point grid point to copy
+   * @return pointer to the copy, valid until it is released
+   */
+  HashGridPoint* allocate(const HashGridPoint& point);
+
+  /**
+   * Creates grid points whose levels and indices are already stored in an array with the
+   * same layout as in the chunks (2 * dimension entries per point, first the levels, then the
+   * indices). The array is used in place (it may, e.g., be memory-mapped from a file), so
+   * nothing is copied. The points have to be rehashed by the caller. Points allocated later
+   * are placed in new chunks.
+   *
+   * @param count       number of grid points
+   * @param levelIndex  levels and indices of the grid points (kept alive by the pool)
+   * @return pointer to the first of count consecutive grid points
+   */
+  HashGridPoint* allocate(size_t count, std::shared_ptr<HashGridPoint::level_type> levelIndex);
+
+  /**
+   * Releases a grid point obtained by allocate, its memory will be reused by the
+   * next call of allocate.
+   *
+   * @param point pointer to the grid point
+   */
+  void release(HashGridPoint* point);
+
+  /**
+   * Frees all chunks, invalidating all allocated grid points.
+   * Separately allocated grid points have to be released before.
+   *
+   * @param dimension new dimension of the grid points managed by the pool
+   */
+  void reset(size_t dimension);
+
+  /**
+   * @return dimension of the grid points managed by the pool
+   */
+  size_t getDimension() const;
+
+  /**
+   * @return number of grid points that fit into the currently allocated chunks
+   */
+  size_t getCapacity() const;
+
+ private:
+  /// one contiguous block of grid points and their levels and indices
+  struct Chunk {
+    /// grid point objects
+    std::unique_ptr<HashGridPoint[]> points;
+    /// levels and indices of the grid points (2 * dimension entries per point),
+    /// owned by the chunk or shared with external memory
+    std::shared_ptr<HashGridPoint::level_type> levelIndex;
+    /// number of grid points in the chunk
+    size_t size;
+  };
+
+  /**
+   * @param point pointer to a grid point
+   * @return whether the point lies in one of the chunks of the pool
+   */
+  bool isPooled(const HashGridPoint* point) const;
+
+  /// number of grid points in the first chunk
+  static const size_t initialChunkSize = 64;
+  /// maximal number of grid points per chunk
+  static const size_t maxChunkSize = 65536;
+
+  /// dimension of the grid points
+  size_t dimension;
+  /// chunks allocated so far
+  std::vector<Chunk> chunks;
+  /// number of used grid points in the last chunk
+  size_t usedInLastChunk;
+  /// released grid points that can be reused
+  std::vector<HashGridPoint*> freePoints;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* HASHGRIDPOINTPOOL_HPP */
@@ -6,23 +6,265 @@
 #include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
 
 #include <sgpp/base/exception/generation_exception.hpp>
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <exception>
+#include <limits>
 #include <list>
 #include <memory>
 #include <string>
 #include <typeinfo>
-#include <unordered_map>
 #include <vector>
 
 namespace sgpp {
 namespace base {
 
+namespace {
+
+/// magic number at the beginning of the binary format
+const char binaryMagic[8] = {'S', 'G', 'P', 'P', 'G', 'R', 'I', 'D'};
+/// stored to detect files written on machines with a different byte order
+const uint32_t binaryByteOrderMark = 0x01020304;
+/// the sections of the binary format are padded to multiples of this number of bytes
+const size_t binaryAlignment = 8;
+
+/**
+ * Header of the binary format (see HashGridStorage::serializeBinary)
+ */
+struct BinaryHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrderMark;
+  /// number of bytes per level (1, 2, or 4)
+  uint32_t levelWidth;
+  /// number of bytes per index (1, 2, or 4)
+  uint32_t indexWidth;
+  uint64_t dimension;
+  uint64_t numberOfPoints;
+  uint64_t numberOfCoefficientVectors;
+  /// size of the description of the bounding box or stretching in bytes
+  uint64_t descriptionSize;
+  uint64_t descriptionChecksum;
+  /// checksum of the levels and indices, continued with the leaf properties
+  uint64_t pointsChecksum;
+  /// checksum of all coefficient vectors
+  uint64_t coefficientsChecksum;
+  /// checksum of all preceding fields
+  uint64_t headerChecksum;
+};
+
+static_assert(sizeof(BinaryHeader) == 88, "BinaryHeader must not contain padding");
+
+uint64_t computeChecksum(const void* data, size_t size,
+                         uint64_t checksum = MemoryMappedFile::CHECKSUM_SEED) {
+  return MemoryMappedFile::computeChecksum(data, size, checksum);
+}
+
+/**
+ * @return a + b, throws if the sum cannot be represented
+ */
+size_t addSizes(size_t a, size_t b) {
+  if (b > std::numeric_limits<size_t>::max() - a) {
+    throw generation_exception("HashGridStorage: binary grid is too large");
+  }
+
+  return a + b;
+}
+
+/**
+ * @return a * b, throws if the product cannot be represented
+ */
+size_t multiplySizes(size_t a, size_t b) {
+  if ((a != 0) && (b > std::numeric_limits<size_t>::max() / a)) {
+    throw generation_exception("HashGridStorage: binary grid is too large");
+  }
+
+  return a * b;
+}
+
+/**
+ * @param size  size of a section in bytes
+ * @return      size of the section including padding
+ */
+size_t getPaddedSize(size_t size) {
+  return addSizes(size, binaryAlignment - 1) / binaryAlignment * binaryAlignment;
+}
+
+/**
+ * @param maxValue  largest level or index
+ * @return          smallest number of bytes (1, 2, or 4) that can store the value
+ */
+uint32_t getMinimalWidth(HashGridPoint::level_type maxValue) {
+  if (maxValue <= std::numeric_limits<uint8_t>::max()) {
+    return 1;
+  } else if (maxValue <= std::numeric_limits<uint16_t>::max()) {
+    return 2;
+  } else {
+    return 4;
+  }
+}
+
+inline void storeValue(char* destination, HashGridPoint::level_type value, uint32_t width) {
+  if (width == 1) {
+    const uint8_t narrowValue = static_cast<uint8_t>(value);
+    std::memcpy(destination, &narrowValue, 1);
+  } else if (width == 2) {
+    const uint16_t narrowValue = static_cast<uint16_t>(value);
+    std::memcpy(destination, &narrowValue, 2);
+  } else {
+    const uint32_t narrowValue = static_cast<uint32_t>(value);
+    std::memcpy(destination, &narrowValue, 4);
+  }
+}
+
+inline HashGridPoint::level_type loadValue(const char* source, uint32_t width) {
+  if (width == 1) {
+    uint8_t value;
+    std::memcpy(&value, source, 1);
+    return value;
+  } else if (width == 2) {
+    uint16_t value;
+    std::memcpy(&value, source, 2);
+    return value;
+  } else {
+    uint32_t value;
+    std::memcpy(&value, source, 4);
+    return value;
+  }
+}
+
+uint64_t computeHeaderChecksum(const BinaryHeader& header) {
+  return computeChecksum(&header, offsetof(BinaryHeader, headerChecksum));
+}
+
+void checkHeader(const BinaryHeader& header) {
+  if (std::memcmp(header.magic, binaryMagic, sizeof(binaryMagic)) != 0) {
+    throw generation_exception("HashGridStorage: not a binary grid");
+  }
+
+  if (header.byteOrderMark != binaryByteOrderMark) {
+    throw generation_exception("HashGridStorage: binary grid was written with another byte order");
+  }
+
+  if (header.version != SERIALIZATION_VERSION_BINARY) {
+    throw generation_exception("HashGridStorage: unknown version of the binary grid");
+  }
+
+  if (header.headerChecksum != computeHeaderChecksum(header)) {
+    throw generation_exception("HashGridStorage: corrupt header of the binary grid");
+  }
+
+  if (((header.levelWidth != 1) && (header.levelWidth != 2) && (header.levelWidth != 4)) ||
+      ((header.indexWidth != 1) && (header.indexWidth != 2) && (header.indexWidth != 4)) ||
+      (header.dimension > std::numeric_limits<size_t>::max()) ||
+      (header.numberOfPoints > std::numeric_limits<size_t>::max()) ||
+      (header.numberOfCoefficientVectors > std::numeric_limits<size_t>::max()) ||
+      (header.descriptionSize > std::numeric_limits<size_t>::max())) {
+    throw generation_exception("HashGridStorage: invalid header of the binary grid");
+  }
+}
+
+/**
+ * Sizes and offsets (relative to the header) of the sections of the binary format,
+ * computed from the header without overflows.
+ */
+struct BinaryLayout {
+  explicit BinaryLayout(const BinaryHeader& header) {
+    const size_t dimension = header.dimension;
+    const size_t numberOfPoints = header.numberOfPoints;
+
+    recordSize = multiplySizes(dimension, header.levelWidth + header.indexWidth);
+    pointsSize = multiplySizes(numberOfPoints, recordSize);
+    levelIndexSize =
+        multiplySizes(multiplySizes(2 * sizeof(HashGridPoint::level_type), dimension),
+                      numberOfPoints);
+    coefficientsSize = multiplySizes(
+        multiplySizes(header.numberOfCoefficientVectors, numberOfPoints), sizeof(double));
+    descriptionOffset = sizeof(BinaryHeader);
+    pointsOffset = addSizes(descriptionOffset, getPaddedSize(header.descriptionSize));
+    leavesOffset = addSizes(pointsOffset, getPaddedSize(pointsSize));
+    coefficientsOffset = addSizes(leavesOffset, getPaddedSize(numberOfPoints));
+    totalSize = addSizes(coefficientsOffset, coefficientsSize);
+  }
+
+  /// size of the levels and indices of one grid point in the file
+  size_t recordSize;
+  /// size of the levels and indices of all grid points in the file
+  size_t pointsSize;
+  /// size of the levels and indices of all grid points in memory (HashGridPointPool layout)
+  size_t levelIndexSize;
+  /// size of all coefficient vectors
+  size_t coefficientsSize;
+  size_t descriptionOffset;
+  size_t pointsOffset;
+  size_t leavesOffset;
+  size_t coefficientsOffset;
+  /// size of the binary grid including the header
+  size_t totalSize;
+};
+
+/**
+ * Converts the levels and indices of the grid points from the file to the layout of
+ * HashGridPointPool (2 * dimension entries per grid point, first the levels, then the indices).
+ */
+void unpackPoints(const char* points, const BinaryHeader& header,
+                  HashGridPoint::level_type* levelIndex) {
+  const size_t dimension = header.dimension;
+  const size_t numberOfPoints = header.numberOfPoints;
+  const uint32_t levelWidth = header.levelWidth;
+  const uint32_t indexWidth = header.indexWidth;
+  const size_t recordSize = dimension * (levelWidth + indexWidth);
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    const char* record = points + i * recordSize;
+    HashGridPoint::level_type* point = levelIndex + 2 * dimension * i;
+
+    for (size_t d = 0; d < dimension; d++) {
+      point[d] = loadValue(record + d * levelWidth, levelWidth);
+      point[dimension + d] =
+          loadValue(record + dimension * levelWidth + d * indexWidth, indexWidth);
+    }
+  }
+}
+
+/**
+ * Reads a section of a binary grid block by block, such that a corrupt header can only
+ * cause allocations of the size of the data actually present in the stream.
+ */
+void readSection(std::istream& istream, size_t size, std::vector<char>& buffer) {
+  const size_t blockSize = static_cast<size_t>(1) << 20;
+  buffer.clear();
+
+  while (buffer.size() < size) {
+    const size_t oldSize = buffer.size();
+    const size_t count = std::min(blockSize, size - oldSize);
+    buffer.resize(oldSize + count);
+    istream.read(&buffer[oldSize], count);
+
+    if (!istream) {
+      throw generation_exception("HashGridStorage: binary grid is truncated");
+    }
+  }
+}
+
+void writePadding(std::ostream& ostream, size_t size) {
+  const char zeros[binaryAlignment] = {};
+  ostream.write(zeros, getPaddedSize(size) - size);
+}
+
+}  // namespace
+
 HashGridStorage::HashGridStorage(size_t dimension)
     :  //  GridStorage(dim),
       dimension(dimension),
+      pool(dimension),
       list(),
-      map(),
+      map(list),
       algoDims(),
       boundingBox(new BoundingBox(dimension)),
       stretching(nullptr),
@@ -35,8 +277,9 @@ HashGridStorage::HashGridStorage(size_t dimension)
 HashGridStorage::HashGridStorage(BoundingBox& creationBoundingBox)
     :  //  GridStorage(creationBoundingBox, creationBoundingBox.getDimensions()),
       dimension(creationBoundingBox.getDimension()),
+      pool(dimension),
       list(),
-      map(),
+      map(list),
       algoDims(),
       boundingBox(new BoundingBox(creationBoundingBox)),
       stretching(nullptr),
@@ -50,8 +293,9 @@ HashGridStorage::HashGridStorage(BoundingBox& creationBoundingBox)
 HashGridStorage::HashGridStorage(Stretching& creationStretching)
     :  //  : GridStorage(creationStretching, creationStretching.getDimensions()),
       dimension(creationStretching.getDimension()),
+      pool(dimension),
       list(),
-      map(),
+      map(list),
       algoDims(),
       boundingBox(nullptr),
       stretching(new Stretching(creationStretching)),
@@ -65,8 +309,9 @@ HashGridStorage::HashGridStorage(Stretching& creationStretching)
 HashGridStorage::HashGridStorage(std::string& istr)
     :  //  : GridStorage(istr),
       dimension(0lu),
+      pool(0),
       list(),
-      map(),
+      map(list),
       algoDims() {
   std::istringstream istream;
   istream.str(istr);
@@ -81,8 +326,9 @@ HashGridStorage::HashGridStorage(std::string& istr)
 HashGridStorage::HashGridStorage(std::istream& istream)
     :  // GridStorage(istream),
       dimension(0lu),
+      pool(0),
       list(),
-      map(),
+      map(list),
       algoDims() {
   parseGridDescription(istream);
 
@@ -94,8 +340,9 @@ HashGridStorage::HashGridStorage(std::istream& istream)
 HashGridStorage::HashGridStorage(HashGridStorage& copyFrom)
     :  // GridStorage(copyFrom),
       dimension(copyFrom.dimension),
+      pool(dimension),
       list(),
-      map(),
+      map(list),
       algoDims(copyFrom.algoDims),
       boundingBox(copyFrom.bUseStretching ? nullptr : new BoundingBox(*copyFrom.boundingBox)),
       stretching(copyFrom.bUseStretching ? new Stretching(*copyFrom.stretching) : nullptr),
@@ -116,6 +363,7 @@ void HashGridStorage::operator=(const HashGridStorage& other) {
   }
 
   dimension = other.dimension;
+  pool.reset(dimension);
   algoDims = other.algoDims;
   bUseStretching = other.bUseStretching;
 
@@ -139,61 +387,51 @@ HashGridStorage::~HashGridStorage() {
   }
 
   for (grid_list_iterator iter = list.begin(); iter != list.end(); iter++) {
-    delete *iter;
+    pool.release(*iter);
   }
 }
 
 void HashGridStorage::clear() {
   // delete all grid points
   for (grid_list_iterator iter = list.begin(); iter != list.end(); iter++) {
-    delete *iter;
+    pool.release(*iter);
   }
 
   // remove all elements from hashmap
   map.clear();
   // remove all list entries
   list.clear();
+  // free the memory of the grid points
+  pool.reset(dimension);
 }
 
 std::vector<size_t> HashGridStorage::deletePoints(std::list<size_t>& removePoints) {
-  point_pointer curPoint;
   std::vector<size_t> remainingPoints;
-  size_t delCounter = 0;
-
-  // sort list
-  removePoints.sort();
+  std::vector<bool> isRemoved(list.size(), false);
 
-  // DEBUG : print list points to delete, sorted
-  // std::cout << std::endl << "List of points to delete, sorted" << std::endl;
-  // for(std::list<size_t>::iterator iter = removePoints.begin();
-  // iter != removePoints.end(); iter++)
-  // {
-  //   std::cout << " " << *iter << " ";
-  // }
-  // std::cout << std::endl;
-
-  // Remove points with given indices for index vector and hashmap
   for (std::list<size_t>::iterator iter = removePoints.begin(); iter != removePoints.end();
        iter++) {
-    size_t tmpIndex = *iter;
-    size_t curPos = tmpIndex - delCounter;
-
-    // GridPoint
-    curPoint = list[curPos];
-
-    // erase point
-    delCounter++;
-    map.erase(curPoint);
-    list.erase(list.begin() + curPos);
+    isRemoved[*iter] = true;
   }
 
-  // reset all entries in hash map and build list of remaining
+  // compact the list of grid points in one pass and build list of remaining
+  size_t newSize = 0;
+
   for (size_t i = 0; i < list.size(); i++) {
-    curPoint = list[i];
-    remainingPoints.push_back(map[curPoint]);
-    map[curPoint] = i;
+    if (isRemoved[i]) {
+      pool.release(list[i]);
+    } else {
+      list[newSize] = list[i];
+      remainingPoints.push_back(i);
+      newSize++;
+    }
   }
 
+  list.resize(newSize);
+
+  // reset all entries in hash map
+  map.rebuild();
+
   // reset the whole grid's leaf property in order
   // to guarantee a consistent grid
   recalcLeafProperty();
@@ -221,11 +459,25 @@ std::string HashGridStorage::serialize(int version) const {
 }
 
 void HashGridStorage::serialize(std::ostream& ostream, int version) const {
+  if (version == SERIALIZATION_VERSION_BINARY) {
+    serializeBinary(ostream);
+    return;
+  }
+
   // Print version, dimensions and number of gridpoints
   ostream << version << " ";
   ostream << dimension << " ";
   ostream << list.size() << std::endl;
 
+  serializeDomainDescription(ostream, version);
+
+  // print the coordinates of the grid points
+  for (grid_list_const_iterator iter = list.begin(); iter != list.end(); iter++) {
+    (*iter)->serialize(ostream, version);
+  }
+}
+
+void HashGridStorage::serializeDomainDescription(std::ostream& ostream, int version) const {
   // If BoundingBox used, write zero
   if (!bUseStretching) {
     ostream << std::scientific << 0 << std::endl;
@@ -241,10 +493,323 @@ void HashGridStorage::serialize(std::ostream& ostream, int version) const {
 
     stretching->serialize(ostream, version);
   }
+}
 
-  // print the coordinates of the grid points
-  for (grid_list_const_iterator iter = list.begin(); iter != list.end(); iter++) {
-    (*iter)->serialize(ostream, version);
+void HashGridStorage::serializeBinary(std::ostream& ostream,
+                                      const std::vector<DataVector>& coefficients,
+                                      bool compact) const {
+  const size_t numberOfPoints = list.size();
+
+  for (const DataVector& vector : coefficients) {
+    if (vector.getSize() != numberOfPoints) {
+      throw generation_exception(
+          "HashGridStorage::serializeBinary: coefficient vector has the wrong size");
+    }
+  }
+
+  // the domain is small, so it is stored as text (without loss of precision)
+  std::ostringstream descriptionStream;
+  descriptionStream.precision(17);
+  serializeDomainDescription(descriptionStream, SERIALIZATION_VERSION);
+  const std::string description = descriptionStream.str();
+
+  // levels and indices are stored with the smallest sufficient number of bytes
+  HashGridPoint::level_type maxLevel = 0;
+  HashGridPoint::index_type maxIndex = 0;
+
+  if (compact) {
+    for (size_t i = 0; i < numberOfPoints; i++) {
+      for (size_t d = 0; d < dimension; d++) {
+        maxLevel = std::max(maxLevel, list[i]->getLevel(d));
+        maxIndex = std::max(maxIndex, list[i]->getIndex(d));
+      }
+    }
+  }
+
+  BinaryHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, binaryMagic, sizeof(binaryMagic));
+  header.version = SERIALIZATION_VERSION_BINARY;
+  header.byteOrderMark = binaryByteOrderMark;
+  header.levelWidth = compact ? getMinimalWidth(maxLevel) : sizeof(HashGridPoint::level_type);
+  header.indexWidth = compact ? getMinimalWidth(maxIndex) : sizeof(HashGridPoint::index_type);
+  header.dimension = dimension;
+  header.numberOfPoints = numberOfPoints;
+  header.numberOfCoefficientVectors = coefficients.size();
+  header.descriptionSize = description.size();
+  header.descriptionChecksum = computeChecksum(description.data(), description.size());
+
+  const BinaryLayout layout(header);
+
+  // the grid points are packed blockwise, once for the checksum and once for writing
+  const size_t blockSize = 4096;
+  std::vector<char> points(layout.recordSize * blockSize);
+  std::vector<uint8_t> leaves(numberOfPoints);
+
+  auto packBlock = [&](size_t first, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+      const HashGridPoint& point = *list[first + i];
+      char* const record = &points[layout.recordSize * i];
+
+      for (size_t d = 0; d < dimension; d++) {
+        storeValue(record + d * header.levelWidth, point.getLevel(d), header.levelWidth);
+        storeValue(record + dimension * header.levelWidth + d * header.indexWidth,
+                   point.getIndex(d), header.indexWidth);
+      }
+    }
+  };
+
+  uint64_t checksum = MemoryMappedFile::CHECKSUM_SEED;
+
+  for (size_t first = 0; first < numberOfPoints; first += blockSize) {
+    const size_t count = std::min(blockSize, numberOfPoints - first);
+    packBlock(first, count);
+    checksum = computeChecksum(points.data(), layout.recordSize * count, checksum);
+  }
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    leaves[i] = list[i]->isLeaf() ? 1 : 0;
+  }
+
+  header.pointsChecksum = computeChecksum(leaves.data(), leaves.size(), checksum);
+  checksum = MemoryMappedFile::CHECKSUM_SEED;
+
+  for (const DataVector& vector : coefficients) {
+    checksum = computeChecksum(vector.getPointer(), numberOfPoints * sizeof(double), checksum);
+  }
+
+  header.coefficientsChecksum = checksum;
+  header.headerChecksum = computeHeaderChecksum(header);
+
+  ostream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  ostream.write(description.data(), description.size());
+  writePadding(ostream, description.size());
+
+  for (size_t first = 0; first < numberOfPoints; first += blockSize) {
+    const size_t count = std::min(blockSize, numberOfPoints - first);
+    packBlock(first, count);
+    ostream.write(points.data(), layout.recordSize * count);
+  }
+
+  writePadding(ostream, layout.pointsSize);
+  ostream.write(reinterpret_cast<const char*>(leaves.data()), leaves.size());
+  writePadding(ostream, leaves.size());
+
+  for (const DataVector& vector : coefficients) {
+    ostream.write(reinterpret_cast<const char*>(vector.getPointer()),
+                  numberOfPoints * sizeof(double));
+  }
+}
+
+void HashGridStorage::mapBinaryFile(const std::string& fileName,
+                                    std::vector<DataVector>* coefficients,
+                                    bool verifyChecksums) {
+  // copy-on-write, such that the grid points can be modified without changing the file
+  std::shared_ptr<MemoryMappedFile> file = std::make_shared<MemoryMappedFile>(fileName, true);
+  const size_t fileSize = file->getSize();
+  std::shared_ptr<char> mapping(file, file->getData());
+
+  // skip the grid type line written by Grid::serialize
+  size_t offset = 0;
+
+  if ((fileSize < sizeof(binaryMagic)) ||
+      (std::memcmp(mapping.get(), binaryMagic, sizeof(binaryMagic)) != 0)) {
+    const char* lineEnd =
+        static_cast<const char*>(std::memchr(mapping.get(), '\n', fileSize));
+    offset = (lineEnd == nullptr) ? fileSize : (lineEnd - mapping.get() + 1);
+  }
+
+  BinaryHeader header;
+
+  if (fileSize - offset < sizeof(header)) {
+    throw generation_exception("HashGridStorage::mapBinaryFile: not a binary grid");
+  }
+
+  std::memcpy(&header, mapping.get() + offset, sizeof(header));
+  checkHeader(header);
+
+  // the sizes are validated against the file before anything is allocated
+  const BinaryLayout layout(header);
+
+  if (fileSize - offset < layout.totalSize) {
+    throw generation_exception("HashGridStorage::mapBinaryFile: binary grid is truncated");
+  }
+
+  const size_t numberOfPoints = header.numberOfPoints;
+  const size_t newDimension = header.dimension;
+  const char* base = mapping.get() + offset;
+  const char* description = base + layout.descriptionOffset;
+  const char* points = base + layout.pointsOffset;
+  const uint8_t* leaves = reinterpret_cast<const uint8_t*>(base + layout.leavesOffset);
+  const char* coefficientsData = base + layout.coefficientsOffset;
+
+  if (verifyChecksums) {
+    const uint64_t coefficientsChecksum =
+        computeChecksum(coefficientsData, layout.coefficientsSize);
+
+    if ((computeChecksum(description, header.descriptionSize) != header.descriptionChecksum) ||
+        (computeChecksum(leaves, numberOfPoints, computeChecksum(points, layout.pointsSize)) !=
+         header.pointsChecksum) ||
+        (coefficientsChecksum != header.coefficientsChecksum)) {
+      throw generation_exception("HashGridStorage::mapBinaryFile: checksum mismatch");
+    }
+  }
+
+  std::shared_ptr<HashGridPoint::level_type> levelIndexArray;
+
+  if ((header.levelWidth == sizeof(HashGridPoint::level_type)) &&
+      (header.indexWidth == sizeof(HashGridPoint::index_type)) &&
+      (reinterpret_cast<uintptr_t>(points) % alignof(HashGridPoint::level_type) == 0)) {
+    // use the levels and indices in place, the aliasing pointer keeps the mapping alive
+    levelIndexArray = std::shared_ptr<HashGridPoint::level_type>(
+        mapping, reinterpret_cast<HashGridPoint::level_type*>(const_cast<char*>(points)));
+  } else {
+    // compact widths or a grid type line of unsuitable length
+    levelIndexArray.reset(new HashGridPoint::level_type[2 * newDimension * numberOfPoints],
+                          std::default_delete<HashGridPoint::level_type[]>());
+    unpackPoints(points, header, levelIndexArray.get());
+  }
+
+  if (coefficients != nullptr) {
+    coefficients->clear();
+
+    for (size_t k = 0; k < header.numberOfCoefficientVectors; k++) {
+      DataVector vector(numberOfPoints);
+      std::memcpy(vector.getPointer(), coefficientsData + k * numberOfPoints * sizeof(double),
+                  numberOfPoints * sizeof(double));
+      coefficients->push_back(vector);
+    }
+  }
+
+  clear();
+
+  if (bUseStretching) {
+    delete stretching;
+  } else {
+    delete boundingBox;
+  }
+
+  dimension = newDimension;
+  std::istringstream descriptionStream(std::string(description, header.descriptionSize));
+  parseDomainDescription(descriptionStream, SERIALIZATION_VERSION);
+  setPackedPoints(numberOfPoints, levelIndexArray, leaves);
+
+  algoDims.clear();
+
+  for (size_t i = 0; i < dimension; i++) {
+    algoDims.push_back(i);
+  }
+}
+
+void HashGridStorage::parseBinaryGridDescription(std::istream& istream,
+                                                 std::vector<DataVector>* coefficients,
+                                                 bool verifyChecksums) {
+  BinaryHeader header;
+  istream.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+  if (!istream) {
+    throw generation_exception("HashGridStorage: binary grid is truncated");
+  }
+
+  checkHeader(header);
+  const BinaryLayout layout(header);
+  const size_t numberOfPoints = header.numberOfPoints;
+
+  // if the stream is seekable, its size is validated before anything is allocated
+  const std::streampos position = istream.tellg();
+
+  if (position != std::streampos(-1)) {
+    istream.seekg(0, std::ios::end);
+    const std::streampos end = istream.tellg();
+    istream.seekg(position);
+
+    if ((end != std::streampos(-1)) &&
+        (static_cast<uint64_t>(end - position) < layout.totalSize - sizeof(header))) {
+      throw generation_exception("HashGridStorage: binary grid is truncated");
+    }
+  }
+
+  // otherwise, the sections are read block by block
+  std::vector<char> description;
+  readSection(istream, layout.pointsOffset - layout.descriptionOffset, description);
+  description.resize(header.descriptionSize);
+
+  std::vector<char> points;
+  readSection(istream, layout.leavesOffset - layout.pointsOffset, points);
+
+  std::vector<char> leaves;
+  readSection(istream, layout.coefficientsOffset - layout.leavesOffset, leaves);
+
+  uint64_t coefficientsChecksum = MemoryMappedFile::CHECKSUM_SEED;
+  std::vector<DataVector> readCoefficients;
+
+  for (size_t k = 0; k < header.numberOfCoefficientVectors; k++) {
+    DataVector vector(numberOfPoints);
+    istream.read(reinterpret_cast<char*>(vector.getPointer()), numberOfPoints * sizeof(double));
+
+    if (!istream) {
+      throw generation_exception("HashGridStorage: binary grid is truncated");
+    }
+
+    coefficientsChecksum = computeChecksum(vector.getPointer(), numberOfPoints * sizeof(double),
+                                           coefficientsChecksum);
+
+    if (coefficients != nullptr) {
+      readCoefficients.push_back(vector);
+    }
+  }
+
+  if (verifyChecksums &&
+      ((computeChecksum(description.data(), description.size()) != header.descriptionChecksum) ||
+       (computeChecksum(leaves.data(), numberOfPoints,
+                        computeChecksum(points.data(), layout.pointsSize)) !=
+        header.pointsChecksum) ||
+       (coefficientsChecksum != header.coefficientsChecksum))) {
+    throw generation_exception("HashGridStorage: checksum mismatch in binary grid");
+  }
+
+  if (coefficients != nullptr) {
+    coefficients->swap(readCoefficients);
+  }
+
+  // the levels and indices are unpacked directly into the array used by the storage
+  std::shared_ptr<HashGridPoint::level_type> levelIndex(
+      new HashGridPoint::level_type[2 * header.dimension * numberOfPoints],
+      std::default_delete<HashGridPoint::level_type[]>());
+  unpackPoints(points.data(), header, levelIndex.get());
+  std::vector<char>().swap(points);
+
+  dimension = header.dimension;
+  std::istringstream descriptionStream(std::string(description.begin(), description.end()));
+  parseDomainDescription(descriptionStream, SERIALIZATION_VERSION);
+  setPackedPoints(numberOfPoints, levelIndex, reinterpret_cast<const uint8_t*>(leaves.data()));
+}
+
+void HashGridStorage::setPackedPoints(size_t numberOfPoints,
+                                      std::shared_ptr<HashGridPoint::level_type> levelIndex,
+                                      const uint8_t* leaves) {
+  for (grid_list_iterator iter = list.begin(); iter != list.end(); iter++) {
+    pool.release(*iter);
+  }
+
+  map.clear();
+  list.clear();
+  pool.reset(dimension);
+
+  HashGridPoint* points = pool.allocate(numberOfPoints, levelIndex);
+  list.resize(numberOfPoints);
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    points[i].setLeaf(leaves[i] != 0);
+    points[i].rehash();
+    list[i] = &points[i];
+  }
+
+  map.rebuild();
+
+  if (map.size() != numberOfPoints) {
+    throw generation_exception("HashGridStorage: binary grid contains duplicate grid points");
   }
 }
 
@@ -286,9 +851,10 @@ size_t HashGridStorage::getNumberOfInnerPoints() const {
 size_t HashGridStorage::getDimension() const { return dimension; }
 
 size_t HashGridStorage::insert(const point_type& index) {
-  point_pointer insert = new HashGridPoint(index);
+  point_pointer insert = pool.allocate(index);
   list.push_back(insert);
-  return (map[insert] = list.size() - 1);
+  map.insert(*insert, list.size() - 1);
+  return list.size() - 1;
 }
 
 void HashGridStorage::insert(point_type& index, std::vector<size_t>& insertedPoints) {
@@ -326,20 +892,20 @@ void HashGridStorage::update(point_type& index, size_t pos) {
   if (pos < list.size()) {
     // Remove old element at pos
     point_pointer del = list[pos];
-    map.erase(del);
-    delete del;
+    map.erase(*del);
+    pool.release(del);
     // Insert update
-    point_pointer insert = new HashGridPoint(index);
+    point_pointer insert = pool.allocate(index);
     list[pos] = insert;
-    map[insert] = pos;
+    map.insert(*insert, pos);
   }
 }
 
 void HashGridStorage::deleteLast() {
   point_pointer del = list.back();
-  map.erase(del);
+  map.erase(*del);
   list.pop_back();
-  delete del;
+  pool.release(del);
 }
 
 void HashGridStorage::setAlgorithmicDimensions(std::vector<size_t> newAlgoDims) {
@@ -356,44 +922,85 @@ void HashGridStorage::setAlgorithmicDimensions(std::vector<size_t> newAlgoDims)
 }
 
 void HashGridStorage::recalcLeafProperty() {
-  point_pointer point;
-  grid_map_iterator iter;
-  size_t current_dim;
-  point_type::level_type l;
-  point_type::level_type i;
-  bool isLeaf = true;
-
-  // iterate through the grid
-  for (iter = map.begin(); iter != map.end(); iter++) {
-    point = iter->first;
-    isLeaf = true;
-
-    // iterate through the dimensions
-    for (current_dim = 0; current_dim < dimension; current_dim++) {
-      point->get(current_dim, l, i);
-
-      if (l > 0) {
-        // Test left child
-        point->getLeftChild(current_dim);
-        isLeaf = isLeaf && !isContaining(*point);
-
-        // restore value for dimension
-        point->set(current_dim, l, i);
-
-        // Test right child
-        point->getRightChild(current_dim);
-        isLeaf = isLeaf && !isContaining(*point);
-      } else {
-        // Test level 0
-        point->set(current_dim, 1, 1);
-        isLeaf = isLeaf && !isContaining(*point);
-      }
+  std::vector<size_t> seqs(list.size());
+  std::vector<size_t> leftChildren, rightChildren;
+  std::vector<bool> isLeaf(list.size(), true);
 
-      // restore value for dimension
-      point->set(current_dim, l, i);
+  for (size_t i = 0; i < list.size(); i++) {
+    seqs[i] = i;
+  }
+
+  // iterate through the dimensions and look up the children of all points at once;
+  // the child of a level 0 point is (1, 1), which is either its left or right child
+  for (size_t current_dim = 0; current_dim < dimension; current_dim++) {
+    getChildSequenceNumbers(seqs, current_dim, leftChildren, rightChildren);
+
+    for (size_t i = 0; i < list.size(); i++) {
+      isLeaf[i] = isLeaf[i] && isInvalidSequenceNumber(leftChildren[i]) &&
+                  isInvalidSequenceNumber(rightChildren[i]);
     }
+  }
 
-    point->setLeaf(isLeaf);
+  for (size_t i = 0; i < list.size(); i++) {
+    list[i]->setLeaf(isLeaf[i]);
+  }
+}
+
+void HashGridStorage::getSequenceNumbers(const std::vector<const HashGridPoint*>& points,
+                                         std::vector<size_t>& seqs) const {
+  seqs.resize(points.size());
+
+  if (points.empty()) {
+    return;
+  }
+
+  map.find(points.data(), points.size(), seqs.data());
+
+  for (size_t k = 0; k < seqs.size(); k++) {
+    if (seqs[k] == grid_map::npos) {
+      seqs[k] = map.size() + 1;
+    }
+  }
+}
+
+void HashGridStorage::getChildSequenceNumbers(const std::vector<size_t>& seqs, size_t d,
+                                              std::vector<size_t>& leftChildren,
+                                              std::vector<size_t>& rightChildren) const {
+  // the children are generated and looked up in blocks to limit the memory
+  const size_t blockSize = 64;
+  std::vector<HashGridPoint> children(2 * std::min(blockSize, seqs.size()),
+                                      HashGridPoint(dimension));
+  std::vector<const HashGridPoint*> childPointers(children.size());
+  std::vector<size_t> childSeqs;
+
+  for (size_t k = 0; k < children.size(); k++) {
+    childPointers[k] = &children[k];
+  }
+
+  leftChildren.resize(seqs.size());
+  rightChildren.resize(seqs.size());
+
+  for (size_t start = 0; start < seqs.size(); start += blockSize) {
+    const size_t count = std::min(blockSize, seqs.size() - start);
+
+    for (size_t k = 0; k < count; k++) {
+      const HashGridPoint& point = *list[seqs[start + k]];
+      const point_type::level_type l = point.getLevel(d);
+      const point_type::index_type i = point.getIndex(d);
+
+      children[2 * k] = point;
+      children[2 * k].set(d, l + 1, 2 * i - 1);
+      children[2 * k + 1] = point;
+      children[2 * k + 1].set(d, l + 1, 2 * i + 1);
+    }
+
+    childPointers.resize(2 * count);
+    getSequenceNumbers(childPointers, childSeqs);
+
+    for (size_t k = 0; k < count; k++) {
+      leftChildren[start + k] = childSeqs[2 * k];
+      rightChildren[start + k] = childSeqs[2 * k + 1];
+    }
   }
 }
 
@@ -603,6 +1210,13 @@ void HashGridStorage::getLevelIndexMaskArraysForModEval(DataMatrixSP& level, Dat
 }
 
 void HashGridStorage::parseGridDescription(std::istream& istream) {
+  istream >> std::ws;
+
+  if (istream.peek() == binaryMagic[0]) {
+    parseBinaryGridDescription(istream, nullptr, true);
+    return;
+  }
+
   int version;
   istream >> version;
   istream >> dimension;
@@ -610,6 +1224,10 @@ void HashGridStorage::parseGridDescription(std::istream& istream) {
   size_t num;
   istream >> num;
 
+  if (list.empty()) {
+    pool.reset(dimension);
+  }
+
   // check whether grid was created with a version that is too new
   if (version > SERIALIZATION_VERSION) {
     if (version != 4) {
@@ -642,38 +1260,14 @@ void HashGridStorage::parseGridDescription(std::istream& istream) {
       boundingBox->setBoundary(i, tempBound);
     }
   } else if (version >= 5) {
-    //      std::cout<<"Version 5 parse starts\n";
-    int useStretching;
-    BoundingBox1D tempBound;
-    istream >> useStretching;
-
-    if (useStretching == 0) {
-      // BoundingBox
-      boundingBox = new BoundingBox(dimension);
-      stretching = nullptr;
-      bUseStretching = false;
-      boundingBox->unserialize(istream, version);
-    } else {
-      boundingBox = nullptr;
-      stretching = new Stretching(dimension);
-      bUseStretching = true;
-
-      if (useStretching == 1) {
-        // Stretching with analytic mode
-        stretching->unserialize(istream, "analytic", version);
-      } else if (useStretching == 2) {
-        // Stretching with discrete Mode
-        stretching->unserialize(istream, "discrete", version);
-      } else {
-        std::cout << "Unknown Container Id Given in parseGridDescription\n";
-      }
-    }
+    parseDomainDescription(istream, version);
   }
 
   for (size_t i = 0; i < num; i++) {
-    point_pointer index = new HashGridPoint(istream, version);
+    HashGridPoint point(istream, version);
+    point_pointer index = pool.allocate(point);
     list.push_back(index);
-    map[index] = i;
+    map.insert(*index, list.size() - 1);
   }
 
   // set's the grid point's leaf information which is not saved in version 1
@@ -682,6 +1276,33 @@ void HashGridStorage::parseGridDescription(std::istream& istream) {
   }
 }
 
+void HashGridStorage::parseDomainDescription(std::istream& istream, int version) {
+  int useStretching;
+  istream >> useStretching;
+
+  if (useStretching == 0) {
+    // BoundingBox
+    boundingBox = new BoundingBox(dimension);
+    stretching = nullptr;
+    bUseStretching = false;
+    boundingBox->unserialize(istream, version);
+  } else {
+    boundingBox = nullptr;
+    stretching = new Stretching(dimension);
+    bUseStretching = true;
+
+    if (useStretching == 1) {
+      // Stretching with analytic mode
+      stretching->unserialize(istream, "analytic", version);
+    } else if (useStretching == 2) {
+      // Stretching with discrete Mode
+      stretching->unserialize(istream, "discrete", version);
+    } else {
+      std::cout << "Unknown Container Id Given in parseGridDescription\n";
+    }
+  }
+}
+
 void HashGridStorage::getCoordinates(const HashGridPoint& point, DataVector& coordinates) const {
   coordinates.resize(dimension);
 
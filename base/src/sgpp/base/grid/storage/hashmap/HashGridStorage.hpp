@@ -9,6 +9,8 @@
 #include <sgpp/base/exception/generation_exception.hpp>
 
 #include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPointMap.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPointPool.hpp>
 #include <sgpp/base/grid/storage/hashmap/SerializationVersion.hpp>
 
 #include <sgpp/base/grid/common/BoundingBox.hpp>
@@ -16,13 +18,12 @@
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataMatrixSP.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <sgpp/globaldef.hpp>
 
 #include <stdint.h>
 
-#include <unordered_map>
-
 #include <exception>
 #include <list>
 #include <memory>
@@ -38,6 +39,10 @@ class HashGridIterator;
 
 /**
  * Generic hash table based storage of grid points.
+ *
+ * The grid points themselves are placed contiguously in a HashGridPointPool
+ * (in the order of insertion), the list holds pointers into the pool,
+ * and the map (a HashGridPointMap) only holds the sequence numbers.
  */
 class HashGridStorage {
  public:
@@ -47,11 +52,9 @@ class HashGridStorage {
   typedef HashGridPoint* point_pointer;
   /// pointer to constant index_type
   typedef const HashGridPoint* index_const_pointer;
-  /// unordered_map of index_pointers
-  typedef std::unordered_map<point_pointer, size_t, HashGridPointPointerHashFunctor,
-                             HashGridPointPointerEqualityFunctor>
-      grid_map;
-  /// iterator of grid_map
+  /// hash map from grid points to sequence numbers
+  typedef HashGridPointMap grid_map;
+  /// iterator of grid_map, visits the grid points in the order of their sequence numbers
   typedef grid_map::iterator grid_map_iterator;
   /// const_iterator of grid_map
   typedef grid_map::const_iterator grid_map_const_iterator;
@@ -159,9 +162,49 @@ class HashGridStorage {
    *
    * @param ostream reference to a stream into that all gridstorage information is written
    * @param version the serialization version of the file
+   *        (SERIALIZATION_VERSION_BINARY for the binary format, see serializeBinary)
    */
   void serialize(std::ostream& ostream, int version = SERIALIZATION_VERSION) const;
 
+  /**
+   * Serializes the gridstorage in the binary format (version SERIALIZATION_VERSION_BINARY).
+   *
+   * The format consists of a header (magic number, version, byte order mark, widths of the
+   * levels and indices, dimension, number of grid points and coefficient vectors, checksums)
+   * followed by sections that are padded to multiples of 8 bytes: the bounding box or
+   * stretching (as text), the levels and indices of the grid points (first all levels, then all
+   * indices of a grid point), the leaf properties (one byte per grid point), and the coefficient
+   * vectors. Levels and indices are stored with 1, 2, or 4 bytes each. The format is recognized
+   * by all constructors and methods that read the text format, and it can be memory-mapped
+   * with mapBinaryFile.
+   *
+   * @param ostream       stream (in binary mode) into which the gridstorage is written
+   * @param coefficients  coefficient vectors (with getSize() entries each) stored with the grid
+   * @param compact       whether to store levels and indices with the smallest sufficient
+   *                      number of bytes; otherwise, they are stored as in the storage,
+   *                      such that mapBinaryFile can use them in place
+   */
+  void serializeBinary(std::ostream& ostream,
+                       const std::vector<DataVector>& coefficients = std::vector<DataVector>(),
+                       bool compact = true) const;
+
+  /**
+   * Replaces the gridstorage by a gridstorage in the binary format read from a file,
+   * which may also start with the grid type line written by Grid::serialize.
+   * The file is memory-mapped (copy-on-write); if the file was written with compact = false,
+   * the levels and indices of the grid points are used in place without parsing or copying,
+   * otherwise they are unpacked in parallel. Only the hash map is built.
+   * The sizes in the header are validated against the size of the file before anything is
+   * allocated. Without mmap support, the file is read.
+   *
+   * @param      fileName         name of the file
+   * @param[out] coefficients     if not nullptr, the coefficient vectors stored in the file
+   * @param      verifyChecksums  whether to verify the checksums of all sections
+   *                              (the header is always verified)
+   */
+  void mapBinaryFile(const std::string& fileName, std::vector<DataVector>* coefficients = nullptr,
+                     bool verifyChecksums = true);
+
   /**
    * serialize the gridstorage's gridpoints into a stream
    *
@@ -300,9 +343,9 @@ class HashGridStorage {
   void destroy(point_pointer index);
 
   /**
-   * stores a given index in the hashmap
+   * stores a given index in the hashmap, the storage takes over the ownership of the index
    *
-   * @param index pointer to index that should be stored
+   * @param index pointer to index that should be stored (e.g., obtained by create)
    *
    * @return sequence number
    */
@@ -346,6 +389,33 @@ class HashGridStorage {
    */
   size_t getSequenceNumber(HashGridPoint& index) const;
 
+  /**
+   * Gets the seq numbers of several grid points at once, which is faster than
+   * calling getSequenceNumber for every point as the hash lookups are interleaved.
+   *
+   * @param      points pointers to the grid points
+   * @param[out] seqs   the seq numbers of the grid points
+   *                    (invalid seq numbers for points not in the storage)
+   */
+  void getSequenceNumbers(const std::vector<const HashGridPoint*>& points,
+                          std::vector<size_t>& seqs) const;
+
+  /**
+   * Gets the seq numbers of the left and right children of several grid points
+   * in a given dimension at once. The children are defined as in
+   * HashGridIterator::leftChild and HashGridIterator::rightChild.
+   *
+   * @param      seqs          seq numbers of the grid points
+   * @param      d             dimension
+   * @param[out] leftChildren  seq numbers of the left children
+   *                           (invalid seq numbers for children not in the storage)
+   * @param[out] rightChildren seq numbers of the right children
+   *                           (invalid seq numbers for children not in the storage)
+   */
+  void getChildSequenceNumbers(const std::vector<size_t>& seqs, size_t d,
+                               std::vector<size_t>& leftChildren,
+                               std::vector<size_t>& rightChildren) const;
+
   /**
    * Tests if seq number does not point to a valid grid point
    *
@@ -594,6 +664,8 @@ class HashGridStorage {
   /// the dimension of the grid
   size_t dimension;
 
+  /// memory pool holding the grid points
+  HashGridPointPool pool;
   /// the grid points
   grid_list list;
   /// the indices of the grid points
@@ -615,6 +687,48 @@ class HashGridStorage {
    * @param istream the string stream that contains the information
    */
   void parseGridDescription(std::istream& istream);
+
+  /**
+   * Parses the bounding box or the stretching (format version 5 and newer)
+   *
+   * @param istream the stream that contains the information
+   * @param version the serialization version
+   */
+  void parseDomainDescription(std::istream& istream, int version);
+
+  /**
+   * Writes the bounding box or the stretching (format version 5 and newer)
+   *
+   * @param ostream the stream into which the information is written
+   * @param version the serialization version
+   */
+  void serializeDomainDescription(std::ostream& ostream, int version) const;
+
+  /**
+   * Reads a gridstorage in the binary format from a stream positioned at the header.
+   * The sizes in the header are validated against the size of the stream if it is seekable;
+   * otherwise, the sections are read block by block, such that a corrupt header cannot cause
+   * allocations beyond the size of the data in the stream. The grid points replace the current
+   * ones; the bounding box or stretching is set without freeing the previous one.
+   *
+   * @param      istream          the stream that contains the information
+   * @param[out] coefficients     if not nullptr, the coefficient vectors
+   * @param      verifyChecksums  whether to verify the checksums of all sections
+   */
+  void parseBinaryGridDescription(std::istream& istream, std::vector<DataVector>* coefficients,
+                                  bool verifyChecksums);
+
+  /**
+   * Replaces the grid points by grid points whose levels and indices are stored in an array
+   * with the layout of HashGridPointPool, which is used in place.
+   *
+   * @param numberOfPoints  number of grid points
+   * @param levelIndex      levels and indices of the grid points
+   * @param leaves          leaf properties of the grid points (one byte per grid point)
+   */
+  void setPackedPoints(size_t numberOfPoints,
+                       std::shared_ptr<HashGridPoint::level_type> levelIndex,
+                       const uint8_t* leaves);
 };
 
 HashGridStorage::point_pointer inline HashGridStorage::create(point_type& index) {
@@ -625,12 +739,17 @@ HashGridStorage::point_pointer inline HashGridStorage::create(point_type& index)
 void inline HashGridStorage::destroy(point_pointer index) { delete index; }
 
 unsigned int inline HashGridStorage::store(point_pointer index) {
+  // move the index into the pool
+  point_pointer pooled = pool.allocate(*index);
+  delete index;
+  index = pooled;
   list.push_back(index);
-  return static_cast<unsigned int>(map[index] = static_cast<unsigned int>(list.size() - 1));
+  map.insert(*index, list.size() - 1);
+  return static_cast<unsigned int>(list.size() - 1);
 }
 
 HashGridStorage::grid_map_iterator inline HashGridStorage::find(point_pointer index) {
-  return map.find(index);
+  return map.iteratorAt(map.find(*index));
 }
 
 HashGridStorage::grid_map_iterator inline HashGridStorage::begin() { return map.begin(); }
@@ -638,14 +757,14 @@ HashGridStorage::grid_map_iterator inline HashGridStorage::begin() { return map.
 HashGridStorage::grid_map_iterator inline HashGridStorage::end() { return map.end(); }
 
 bool inline HashGridStorage::isContaining(HashGridPoint& index) const {
-  return map.find(&index) != map.end();
+  return map.find(index) != grid_map::npos;
 }
 
 size_t inline HashGridStorage::getSequenceNumber(HashGridPoint& index) const {
-  grid_map_const_iterator iter = map.find(&index);
+  size_t seq = map.find(index);
 
-  if (iter != map.end()) {
-    return iter->second;
+  if (seq != grid_map::npos) {
+    return seq;
   } else {
     return map.size() + 1;
   }
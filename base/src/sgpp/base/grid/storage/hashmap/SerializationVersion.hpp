@@ -20,7 +20,16 @@
  * Version 7: PointDistribution changed from enum to enum class
  * Version 8: Add custom boundaryLevel (>= 1) for LinearBoundaryGrid etc.
  * Version 9: Remove PointDistribution again, include Clenshaw-Curtis points in Stretching
+ * Version 10: binary format (see HashGridStorage::serializeBinary) with a header, checksums,
+ *             compactly stored levels and indices, and optional coefficient vectors;
+ *             the text format is still written as version 9
  */
 #define SERIALIZATION_VERSION 9
 
+/**
+ * Version of the binary format; passing it as version to the serialize methods
+ * writes the grid storage in the binary format
+ */
+#define SERIALIZATION_VERSION_BINARY 10
+
 #endif /* SERIALIZATIONVERSION_HPP */
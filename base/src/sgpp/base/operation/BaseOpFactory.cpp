@@ -151,6 +151,7 @@
 
 #include <sgpp/base/operation/hash/OperationMultipleEvalInterModLinear.hpp>
 
+#include <sgpp/base/operation/hash/OperationMultipleEvalBatched.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalBsplineBoundaryNaive.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalBsplineClenshawCurtisNaive.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalBsplineNaive.hpp>
@@ -173,6 +174,10 @@
 #include <sgpp/base/operation/hash/OperationEvalBsplineBoundaryNaive.hpp>
 #include <sgpp/base/operation/hash/OperationEvalBsplineClenshawCurtisNaive.hpp>
 #include <sgpp/base/operation/hash/OperationEvalBsplineNaive.hpp>
+#include <sgpp/base/operation/hash/OperationEvalFixedDimensionNaive.hpp>
+#include <sgpp/base/operation/hash/OperationEvalGradientHierarchicalDescent.hpp>
+#include <sgpp/base/operation/hash/OperationEvalHessianHierarchicalDescent.hpp>
+#include <sgpp/base/operation/hash/OperationEvalHierarchicalDescent.hpp>
 #include <sgpp/base/operation/hash/OperationEvalFundamentalNakSplineNaive.hpp>
 #include <sgpp/base/operation/hash/OperationEvalFundamentalSplineNaive.hpp>
 #include <sgpp/base/operation/hash/OperationEvalWeaklyFundamentalNakSplineBoundaryNaive.hpp>
@@ -268,6 +273,79 @@ namespace sgpp {
 
 namespace op_factory {
 
+namespace {
+
+/**
+ * @param storage storage of the sparse grid
+ * @param basis   1D basis
+ * @return        OperationEvalFixedDimensionNaive for the dimensionality of the grid,
+ *                or nullptr if it is not instantiated for the dimensionality
+ */
+template <class BASIS>
+base::OperationEval* createOperationEvalFixedDimensionNaive(base::GridStorage& storage,
+                                                            const BASIS& basis) {
+  switch (storage.getDimension()) {
+    case 1:
+      return new base::OperationEvalFixedDimensionNaive<1, BASIS>(storage, basis);
+    case 2:
+      return new base::OperationEvalFixedDimensionNaive<2, BASIS>(storage, basis);
+    case 3:
+      return new base::OperationEvalFixedDimensionNaive<3, BASIS>(storage, basis);
+    case 4:
+      return new base::OperationEvalFixedDimensionNaive<4, BASIS>(storage, basis);
+    case 5:
+      return new base::OperationEvalFixedDimensionNaive<5, BASIS>(storage, basis);
+    case 6:
+      return new base::OperationEvalFixedDimensionNaive<6, BASIS>(storage, basis);
+    case 7:
+      return new base::OperationEvalFixedDimensionNaive<7, BASIS>(storage, basis);
+    case 8:
+      return new base::OperationEvalFixedDimensionNaive<8, BASIS>(storage, basis);
+    case 9:
+      return new base::OperationEvalFixedDimensionNaive<9, BASIS>(storage, basis);
+    case 10:
+      return new base::OperationEvalFixedDimensionNaive<10, BASIS>(storage, basis);
+    case 11:
+      return new base::OperationEvalFixedDimensionNaive<11, BASIS>(storage, basis);
+    case 12:
+      return new base::OperationEvalFixedDimensionNaive<12, BASIS>(storage, basis);
+    default:
+      return nullptr;
+  }
+}
+
+/**
+ * @param grid grid
+ * @return     OperationEvalFixedDimensionNaive for the grid,
+ *             or nullptr if the grid type or the dimensionality is not supported
+ */
+base::OperationEval* createOperationEvalFixedDimensionNaiveIfSupported(base::Grid& grid) {
+  base::GridStorage& storage = grid.getStorage();
+
+  if (grid.getType() == base::GridType::Linear) {
+    return createOperationEvalFixedDimensionNaive(storage, base::SLinearBase());
+  } else if (grid.getType() == base::GridType::ModLinear) {
+    return createOperationEvalFixedDimensionNaive(storage, base::SLinearModifiedBase());
+  } else if (grid.getType() == base::GridType::Bspline) {
+    return createOperationEvalFixedDimensionNaive(
+        storage, base::SBsplineBase(dynamic_cast<base::BsplineGrid&>(grid).getDegree()));
+  } else if (grid.getType() == base::GridType::ModBspline) {
+    return createOperationEvalFixedDimensionNaive(
+        storage,
+        base::SBsplineModifiedBase(dynamic_cast<base::ModBsplineGrid&>(grid).getDegree()));
+  } else if (grid.getType() == base::GridType::Poly) {
+    return createOperationEvalFixedDimensionNaive(
+        storage, base::SPolyBase(dynamic_cast<base::PolyGrid&>(grid).getDegree()));
+  } else if (grid.getType() == base::GridType::ModPoly) {
+    return createOperationEvalFixedDimensionNaive(
+        storage, base::SPolyModifiedBase(dynamic_cast<base::ModPolyGrid&>(grid).getDegree()));
+  } else {
+    return nullptr;
+  }
+}
+
+}  // namespace
+
 base::OperationMatrix* createOperationDiagonal(base::Grid& grid, double multiplicationFactor) {
   return new base::OperationDiagonal(&(grid.getStorage()), multiplicationFactor);
 }
@@ -577,6 +655,14 @@ base::OperationEval* createOperationEval(base::Grid& grid) {
   } else if (grid.getType() == base::GridType::ModPoly) {
     return new base::OperationEvalModPoly(grid.getStorage(),
                                           dynamic_cast<base::ModPolyGrid*>(&grid)->getDegree());
+  } else if (grid.getType() == base::GridType::Bspline) {
+    return new base::OperationEvalHierarchicalDescent<base::SBsplineBase>(
+        grid.getStorage(),
+        base::SBsplineBase(dynamic_cast<base::BsplineGrid&>(grid).getDegree()));
+  } else if (grid.getType() == base::GridType::ModBspline) {
+    return new base::OperationEvalHierarchicalDescent<base::SBsplineModifiedBase>(
+        grid.getStorage(),
+        base::SBsplineModifiedBase(dynamic_cast<base::ModBsplineGrid&>(grid).getDegree()));
   } else if (grid.getType() == base::GridType::Prewavelet) {
     return new base::OperationEvalPrewavelet(grid.getStorage());
   } else if (grid.getType() == base::GridType::LinearStretched) {
@@ -618,6 +704,34 @@ base::OperationMultipleEval* createOperationMultipleEval(base::Grid& grid,
     return new base::OperationMultipleEvalLinearStretchedBoundary(grid, dataset);
   } else if (grid.getType() == base::GridType::Periodic) {
     return new base::OperationMultipleEvalPeriodic(grid, dataset);
+  } else if (grid.getType() == base::GridType::Bspline ||
+             grid.getType() == base::GridType::BsplineBoundary ||
+             grid.getType() == base::GridType::ModBspline ||
+             grid.getType() == base::GridType::NakBspline ||
+             grid.getType() == base::GridType::NakBsplineBoundary ||
+             grid.getType() == base::GridType::ModNakBspline ||
+             grid.getType() == base::GridType::NakBsplineExtended ||
+             grid.getType() == base::GridType::NakPBspline ||
+             grid.getType() == base::GridType::NaturalBsplineBoundary ||
+             grid.getType() == base::GridType::FundamentalSpline ||
+             grid.getType() == base::GridType::FundamentalSplineBoundary ||
+             grid.getType() == base::GridType::ModFundamentalSpline ||
+             grid.getType() == base::GridType::FundamentalNakSplineBoundary ||
+             grid.getType() == base::GridType::WeaklyFundamentalSplineBoundary ||
+             grid.getType() == base::GridType::WeaklyFundamentalNakSplineBoundary ||
+             grid.getType() == base::GridType::ModWeaklyFundamentalNakSpline ||
+             grid.getType() == base::GridType::Wavelet ||
+             grid.getType() == base::GridType::WaveletBoundary ||
+             grid.getType() == base::GridType::ModWavelet ||
+             grid.getType() == base::GridType::LinearClenshawCurtis ||
+             grid.getType() == base::GridType::LinearClenshawCurtisBoundary ||
+             grid.getType() == base::GridType::ModLinearClenshawCurtis ||
+             grid.getType() == base::GridType::PolyClenshawCurtis ||
+             grid.getType() == base::GridType::PolyClenshawCurtisBoundary ||
+             grid.getType() == base::GridType::ModPolyClenshawCurtis) {
+    // the B-spline Clenshaw-Curtis bases are excluded, as their eval methods
+    // modify their knot vectors and thus cannot be called by multiple threads
+    return new base::OperationMultipleEvalBatched(grid, dataset);
   } else {
     throw base::factory_exception(
         "createOperationMultipleEval is not implemented for this grid type.");
@@ -693,7 +807,26 @@ base::OperationMultipleEval* createOperationMultipleEvalNaive(base::Grid& grid,
   }
 }
 
+base::OperationEval* createOperationEvalFixedDimensionNaive(base::Grid& grid) {
+  base::OperationEval* op = createOperationEvalFixedDimensionNaiveIfSupported(grid);
+
+  if (op == nullptr) {
+    throw base::factory_exception(
+        "createOperationEvalFixedDimensionNaive is not implemented for this grid type "
+        "or dimensionality.");
+  }
+
+  return op;
+}
+
 base::OperationEval* createOperationEvalNaive(base::Grid& grid) {
+  // prefer the kernels with compile-time dimensionality, if available
+  base::OperationEval* fixedDimensionOp = createOperationEvalFixedDimensionNaiveIfSupported(grid);
+
+  if (fixedDimensionOp != nullptr) {
+    return fixedDimensionOp;
+  }
+
   if (grid.getType() == base::GridType::Linear) {
     return new base::OperationEvalLinearNaive(grid.getStorage());
   } else if (grid.getType() == base::GridType::ModLinear) {
@@ -796,6 +929,38 @@ base::OperationEval* createOperationEvalNaive(base::Grid& grid) {
   }
 }
 
+base::OperationEvalGradient* createOperationEvalGradient(base::Grid& grid) {
+  if (grid.getType() == base::GridType::Bspline) {
+    return new base::OperationEvalGradientHierarchicalDescent<base::SBsplineBase>(
+        grid.getStorage(),
+        base::SBsplineBase(dynamic_cast<base::BsplineGrid&>(grid).getDegree()));
+  } else if (grid.getType() == base::GridType::ModBspline) {
+    return new base::OperationEvalGradientHierarchicalDescent<base::SBsplineModifiedBase>(
+        grid.getStorage(),
+        base::SBsplineModifiedBase(dynamic_cast<base::ModBsplineGrid&>(grid).getDegree()));
+  } else {
+    throw base::factory_exception(
+        "createOperationEvalGradient is not implemented for this grid type. "
+        "Try createOperationEvalGradientNaive instead.");
+  }
+}
+
+base::OperationEvalHessian* createOperationEvalHessian(base::Grid& grid) {
+  if (grid.getType() == base::GridType::Bspline) {
+    return new base::OperationEvalHessianHierarchicalDescent<base::SBsplineBase>(
+        grid.getStorage(),
+        base::SBsplineBase(dynamic_cast<base::BsplineGrid&>(grid).getDegree()));
+  } else if (grid.getType() == base::GridType::ModBspline) {
+    return new base::OperationEvalHessianHierarchicalDescent<base::SBsplineModifiedBase>(
+        grid.getStorage(),
+        base::SBsplineModifiedBase(dynamic_cast<base::ModBsplineGrid&>(grid).getDegree()));
+  } else {
+    throw base::factory_exception(
+        "createOperationEvalHessian is not implemented for this grid type. "
+        "Try createOperationEvalHessianNaive instead.");
+  }
+}
+
 base::OperationEvalGradient* createOperationEvalGradientNaive(base::Grid& grid) {
   if (grid.getType() == base::GridType::Bspline) {
     return new base::OperationEvalGradientBsplineNaive(
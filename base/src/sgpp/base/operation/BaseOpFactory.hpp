@@ -134,6 +134,9 @@ base::OperationMatrix* createOperationIdentity(base::Grid& grid);
 base::OperationEval* createOperationEval(base::Grid& grid);
 /**
  * Factory method, returning an OperationMultipleEval for the grid at hand.
+ * For spline and wavelet grids without a specialized implementation
+ * (e.g., NakBspline, FundamentalSpline, or Wavelet grids),
+ * the batched evaluation OperationMultipleEvalBatched is returned.
  * Note: object has to be freed after use.
  *
  * @param grid Grid which is to be used
@@ -180,6 +183,46 @@ base::OperationMultipleEval* createOperationMultipleEvalNaive(base::Grid& grid,
  * @return Pointer to the new OperationEval object for the Grid grid
  */
 base::OperationEval* createOperationEvalNaive(base::Grid& grid);
+
+/**
+ * Factory method, returning an OperationEvalFixedDimensionNaive for the grid at hand, i.e.,
+ * a brute-force evaluation (as in createOperationEvalNaive) whose dimensionality and 1D basis
+ * are compile-time parameters, which reduces the latency of single-point evaluations.
+ * Supported are Linear, ModLinear, Bspline, ModBspline, Poly, and ModPoly grids
+ * of dimensionalities 1 to 12.
+ * createOperationEvalNaive automatically returns this operation for these grids.
+ * Note: object has to be freed after use.
+ *
+ * @param grid Grid which is to be used
+ * @return Pointer to the new OperationEval object for the Grid grid
+ */
+base::OperationEval* createOperationEvalFixedDimensionNaive(base::Grid& grid);
+/**
+ * Factory method, returning an OperationEvalGradient for the grid at hand.
+ * In contrast to createOperationEvalGradientNaive, the returned operations only evaluate
+ * the basis functions that are non-zero at the evaluation point
+ * (by descending the hierarchy, see AlgorithmHierarchicalDescent).
+ * Supported are Bspline and ModBspline grids.
+ * Note: object has to be freed after use.
+ *
+ * @param grid Grid which is to be used
+ * @return Pointer to the new OperationEvalGradient object for the Grid grid
+ */
+base::OperationEvalGradient* createOperationEvalGradient(base::Grid& grid);
+
+/**
+ * Factory method, returning an OperationEvalHessian for the grid at hand.
+ * In contrast to createOperationEvalHessianNaive, the returned operations only evaluate
+ * the basis functions that are non-zero at the evaluation point
+ * (by descending the hierarchy, see AlgorithmHierarchicalDescent).
+ * Supported are Bspline and ModBspline grids.
+ * Note: object has to be freed after use.
+ *
+ * @param grid Grid which is to be used
+ * @return Pointer to the new OperationEvalHessian object for the Grid grid
+ */
+base::OperationEvalHessian* createOperationEvalHessian(base::Grid& grid);
+
 /**
  * Factory method, returning an OperationEvalGradient for the grid at hand.
  * Implementations of OperationEvalGradientNaive returned by this function should
@@ -0,0 +1,22 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/operation/hash/OperationEvalCompiledModel.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace base {
+
+double OperationEvalCompiledModel::eval(const DataVector& alpha, const DataVector& point) {
+  if (alpha.getSize() == 0) {
+    return model.eval(point);
+  }
+
+  return model.eval(alpha, point);
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,50 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONEVALCOMPILEDMODEL_HPP
+#define OPERATIONEVALCOMPILEDMODEL_HPP
+
+#include <sgpp/base/grid/CompiledGridModel.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * OperationEval for a CompiledGridModel.
+ */
+class OperationEvalCompiledModel : public OperationEval {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param model compiled model (must exist as long as the operation)
+   */
+  explicit OperationEvalCompiledModel(const CompiledGridModel& model) : model(model) {}
+
+  /**
+   * Destructor.
+   */
+  ~OperationEvalCompiledModel() override {}
+
+  /**
+   * @param alpha   coefficients in the order of the grid points of the compiled grid,
+   *                or an empty vector to evaluate the model
+   * @param point   evaluation point
+   * @return        value at the point
+   */
+  double eval(const DataVector& alpha, const DataVector& point) override;
+
+ protected:
+  /// compiled model
+  const CompiledGridModel& model;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* OPERATIONEVALCOMPILEDMODEL_HPP */
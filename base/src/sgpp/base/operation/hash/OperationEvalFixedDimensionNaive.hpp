@@ -0,0 +1,161 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONEVALFIXEDDIMENSIONNAIVE_HPP
+#define OPERATIONEVALFIXEDDIMENSIONNAIVE_HPP
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+
+#include <cstddef>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Product of the 1D basis functions of a grid point in the dimensions T, ..., DIM-1.
+ * The recursion is resolved at compile time, such that the loop over the dimensions
+ * is fully unrolled and the calls to the 1D basis are inlined.
+ * The factors are multiplied in the same order as in the loops of the naive operations,
+ * so the results are identical.
+ *
+ * @tparam T    first dimension
+ * @tparam DIM  dimensionality of the grid
+ */
+template <size_t T, size_t DIM>
+struct FixedDimensionBasisProduct {
+  /**
+   * @param basis  1D basis
+   * @param gp     grid point
+   * @param point  evaluation point in the unit cube
+   * @param value  product of the factors of the dimensions 0, ..., T-1
+   * @return       product of the factors of all dimensions
+   */
+  template <class BASIS>
+  static inline double eval(BASIS& basis, const GridPoint& gp, const double* point,
+                            double value) {
+    const double val1d = basis.eval(gp.getLevel(T), gp.getIndex(T), point[T]);
+
+    if (val1d == 0.0) {
+      return 0.0;
+    }
+
+    return FixedDimensionBasisProduct<T + 1, DIM>::eval(basis, gp, point, value * val1d);
+  }
+};
+
+/**
+ * End of the recursion of FixedDimensionBasisProduct.
+ *
+ * @tparam DIM  dimensionality of the grid
+ */
+template <size_t DIM>
+struct FixedDimensionBasisProduct<DIM, DIM> {
+  template <class BASIS>
+  static inline double eval(BASIS&, const GridPoint&, const double*, double value) {
+    return value;
+  }
+};
+
+/**
+ * Operation for evaluating linear combinations by brute force (like, e.g.,
+ * OperationEvalBsplineNaive), but with the dimensionality and the type of the 1D basis
+ * as compile-time parameters.
+ * The loops over the dimensions are fully unrolled and the 1D basis is called
+ * without virtual dispatch, which reduces the latency of single-point evaluations.
+ * Use op_factory::createOperationEvalNaive, which selects this operation for the
+ * supported grid types and dimensionalities.
+ *
+ * @tparam DIM    dimensionality of the grid
+ * @tparam BASIS  type of the 1D basis (e.g., SBsplineBase)
+ */
+template <size_t DIM, class BASIS>
+class OperationEvalFixedDimensionNaive : public OperationEval {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param storage   storage of the sparse grid (must have dimensionality DIM)
+   * @param base      1D basis
+   */
+  OperationEvalFixedDimensionNaive(GridStorage& storage, const BASIS& base)
+      : storage(storage), base(base) {}
+
+  /**
+   * Destructor.
+   */
+  ~OperationEvalFixedDimensionNaive() override {}
+
+  /**
+   * @param alpha     coefficient vector
+   * @param point     evaluation point
+   * @return          value of the linear combination
+   */
+  double eval(const DataVector& alpha, const DataVector& point) override {
+    const size_t n = storage.getSize();
+    double pointInUnitCube[DIM];
+    double result = 0.0;
+
+    transformPointToUnitCube(point, pointInUnitCube);
+
+    for (size_t i = 0; i < n; i++) {
+      result += alpha[i] * FixedDimensionBasisProduct<0, DIM>::eval(base, storage[i],
+                                                                    pointInUnitCube, 1.0);
+    }
+
+    return result;
+  }
+
+  /**
+   * @param      alpha  coefficient matrix (each column is a coefficient vector)
+   * @param      point  evaluation point
+   * @param[out] value  values of linear combination
+   */
+  void eval(const DataMatrix& alpha, const DataVector& point, DataVector& value) override {
+    const size_t n = storage.getSize();
+    const size_t m = alpha.getNcols();
+    double pointInUnitCube[DIM];
+
+    transformPointToUnitCube(point, pointInUnitCube);
+
+    value.resize(m);
+    value.setAll(0.0);
+
+    for (size_t i = 0; i < n; i++) {
+      const double curValue =
+          FixedDimensionBasisProduct<0, DIM>::eval(base, storage[i], pointInUnitCube, 1.0);
+
+      for (size_t j = 0; j < m; j++) {
+        value[j] += alpha(i, j) * curValue;
+      }
+    }
+  }
+
+ protected:
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// 1D basis
+  BASIS base;
+
+  /**
+   * @param      point            point in the bounding box
+   * @param[out] pointInUnitCube  point transformed to the unit cube
+   */
+  void transformPointToUnitCube(const DataVector& point, double* pointInUnitCube) const {
+    const BoundingBox* boundingBox = storage.getBoundingBox();
+
+    for (size_t t = 0; t < DIM; t++) {
+      pointInUnitCube[t] = boundingBox->transformPointToUnitCube(t, point[t]);
+    }
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* OPERATIONEVALFIXEDDIMENSIONNAIVE_HPP */
@@ -0,0 +1,174 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONEVALGRADIENTHIERARCHICALDESCENT_HPP
+#define OPERATIONEVALGRADIENTHIERARCHICALDESCENT_HPP
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/AlgorithmHierarchicalDescent.hpp>
+#include <sgpp/base/operation/hash/OperationEvalGradient.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Operation for evaluating linear combinations of basis functions with compact support
+ * (e.g., B-splines) and their gradients by descending the hierarchy
+ * (see AlgorithmHierarchicalDescent) instead of looping over all grid points
+ * as, e.g., OperationEvalGradientBsplineNaive does.
+ *
+ * @tparam BASIS 1D basis (HierarchicalDescentSupport has to be specialized for it)
+ */
+template <class BASIS>
+class OperationEvalGradientHierarchicalDescent : public OperationEvalGradient {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param storage   storage of the sparse grid
+   * @param base      1D basis
+   */
+  OperationEvalGradientHierarchicalDescent(GridStorage& storage, const BASIS& base)
+      : storage(storage),
+        base(base),
+        algorithm(storage, this->base),
+        innerDerivative(storage.getDimension()),
+        curGradient(storage.getDimension()) {
+    pointInUnitCube.resize(storage.getDimension());
+  }
+
+  /**
+   * Destructor.
+   */
+  ~OperationEvalGradientHierarchicalDescent() override {}
+
+  /**
+   * @param       alpha     coefficient vector
+   * @param       point     evaluation point
+   * @param[out]  gradient  gradient vector of the linear combination
+   * @return                value of the linear combination
+   */
+  double evalGradient(const DataVector& alpha, const DataVector& point,
+                      DataVector& gradient) override {
+    const size_t d = storage.getDimension();
+    double result = 0.0;
+
+    prepare(point);
+    gradient.resize(d);
+    gradient.setAll(0.0);
+
+    auto visitor = [this, &alpha, &gradient, &result](
+        size_t seq, const std::vector<const Entry*>& factors) {
+      const double curValue = computeGradient(factors, alpha[seq]);
+      result += alpha[seq] * curValue;
+      gradient.add(curGradient);
+    };
+
+    algorithm(pointInUnitCube, 1, visitor);
+    return result;
+  }
+
+  /**
+   * @param       alpha     coefficient matrix (each column is a coefficient vector)
+   * @param       point     evaluation point
+   * @param[out]  value     values of the linear combination
+   * @param[out]  gradient  Jacobian of the linear combination (each row is a gradient vector)
+   */
+  void evalGradient(const DataMatrix& alpha, const DataVector& point, DataVector& value,
+                    DataMatrix& gradient) override {
+    const size_t d = storage.getDimension();
+    const size_t m = alpha.getNcols();
+
+    prepare(point);
+    value.resize(m);
+    value.setAll(0.0);
+    gradient.resize(m, d);
+    gradient.setAll(0.0);
+
+    auto visitor = [this, &alpha, &value, &gradient, d, m](
+        size_t seq, const std::vector<const Entry*>& factors) {
+      const double curValue = computeGradient(factors, 1.0);
+
+      for (size_t j = 0; j < m; j++) {
+        value[j] += alpha(seq, j) * curValue;
+
+        for (size_t t = 0; t < d; t++) {
+          gradient(j, t) += alpha(seq, j) * curGradient[t];
+        }
+      }
+    };
+
+    algorithm(pointInUnitCube, 1, visitor);
+  }
+
+ protected:
+  typedef typename AlgorithmHierarchicalDescent<BASIS>::Entry Entry;
+
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// 1D basis
+  BASIS base;
+  /// descent through the hierarchy
+  AlgorithmHierarchicalDescent<BASIS> algorithm;
+  /// inner derivative (temporary vector)
+  DataVector innerDerivative;
+  /// gradient of the current basis function (temporary vector)
+  DataVector curGradient;
+
+  /**
+   * Transforms the point to the unit cube and computes the inner derivatives.
+   *
+   * @param point evaluation point
+   */
+  void prepare(const DataVector& point) {
+    pointInUnitCube = point;
+    storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
+
+    for (size_t t = 0; t < storage.getDimension(); t++) {
+      innerDerivative[t] = 1.0 / storage.getBoundingBox()->getIntervalWidth(t);
+    }
+  }
+
+  /**
+   * Computes the value and the gradient of a basis function (in the same order of
+   * operations as OperationEvalGradientBsplineNaive).
+   *
+   * @param factors   1D factors of the basis function
+   * @param scaling   factor with which the gradient is initialized
+   * @return          value of the basis function (the gradient is stored in curGradient)
+   */
+  double computeGradient(const std::vector<const Entry*>& factors, double scaling) {
+    const size_t d = factors.size();
+    double curValue = 1.0;
+    curGradient.setAll(scaling);
+
+    for (size_t t = 0; t < d; t++) {
+      const double val1d = factors[t]->value;
+      const double dx1d = factors[t]->dx * innerDerivative[t];
+
+      curValue *= val1d;
+
+      for (size_t t2 = 0; t2 < d; t2++) {
+        if (t2 == t) {
+          curGradient[t2] *= dx1d;
+        } else {
+          curGradient[t2] *= val1d;
+        }
+      }
+    }
+
+    return curValue;
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* OPERATIONEVALGRADIENTHIERARCHICALDESCENT_HPP */
@@ -0,0 +1,213 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONEVALHESSIANHIERARCHICALDESCENT_HPP
+#define OPERATIONEVALHESSIANHIERARCHICALDESCENT_HPP
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/AlgorithmHierarchicalDescent.hpp>
+#include <sgpp/base/operation/hash/OperationEvalHessian.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Operation for evaluating linear combinations of basis functions with compact support
+ * (e.g., B-splines), their gradients and their Hessians by descending the hierarchy
+ * (see AlgorithmHierarchicalDescent) instead of looping over all grid points
+ * as, e.g., OperationEvalHessianBsplineNaive does.
+ *
+ * @tparam BASIS 1D basis (HierarchicalDescentSupport has to be specialized for it)
+ */
+template <class BASIS>
+class OperationEvalHessianHierarchicalDescent : public OperationEvalHessian {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param storage   storage of the sparse grid
+   * @param base      1D basis
+   */
+  OperationEvalHessianHierarchicalDescent(GridStorage& storage, const BASIS& base)
+      : storage(storage),
+        base(base),
+        algorithm(storage, this->base),
+        innerDerivative(storage.getDimension()),
+        curGradient(storage.getDimension()),
+        curHessian(storage.getDimension(), storage.getDimension()) {
+    pointInUnitCube.resize(storage.getDimension());
+  }
+
+  /**
+   * Destructor.
+   */
+  ~OperationEvalHessianHierarchicalDescent() override {}
+
+  /**
+   * @param       alpha     coefficient vector
+   * @param       point     evaluation point
+   * @param[out]  gradient  gradient vector of the linear combination
+   * @param[out]  hessian   Hessian matrix of the linear combination
+   * @return                value of the linear combination
+   */
+  double evalHessian(const DataVector& alpha, const DataVector& point, DataVector& gradient,
+                     DataMatrix& hessian) override {
+    const size_t d = storage.getDimension();
+    double result = 0.0;
+
+    prepare(point);
+    gradient.resize(d);
+    gradient.setAll(0.0);
+    hessian = DataMatrix(d, d);
+
+    auto visitor = [this, &alpha, &gradient, &hessian, &result](
+        size_t seq, const std::vector<const Entry*>& factors) {
+      const double curValue = computeHessian(factors, alpha[seq]);
+      result += alpha[seq] * curValue;
+      gradient.add(curGradient);
+      hessian.add(curHessian);
+    };
+
+    algorithm(pointInUnitCube, 2, visitor);
+    return result;
+  }
+
+  /**
+   * @param       alpha     coefficient matrix (each column is a coefficient vector)
+   * @param       point     evaluation point
+   * @param[out]  value     values of the linear combination
+   * @param[out]  gradient  Jacobian of the linear combination (each row is a gradient vector)
+   * @param[out]  hessian   vector of Hessians of the linear combination
+   */
+  void evalHessian(const DataMatrix& alpha, const DataVector& point, DataVector& value,
+                   DataMatrix& gradient, std::vector<DataMatrix>& hessian) override {
+    const size_t d = storage.getDimension();
+    const size_t m = alpha.getNcols();
+
+    prepare(point);
+    value.resize(m);
+    value.setAll(0.0);
+    gradient.resize(m, d);
+    gradient.setAll(0.0);
+
+    if (hessian.size() != m) {
+      hessian.resize(m);
+    }
+
+    for (size_t j = 0; j < m; j++) {
+      hessian[j].resize(d, d);
+      hessian[j].setAll(0.0);
+    }
+
+    auto visitor = [this, &alpha, &value, &gradient, &hessian, d, m](
+        size_t seq, const std::vector<const Entry*>& factors) {
+      const double curValue = computeHessian(factors, 1.0);
+
+      for (size_t j = 0; j < m; j++) {
+        value[j] += alpha(seq, j) * curValue;
+
+        for (size_t t = 0; t < d; t++) {
+          gradient(j, t) += alpha(seq, j) * curGradient[t];
+
+          for (size_t t2 = 0; t2 < d; t2++) {
+            hessian[j](t, t2) += alpha(seq, j) * curHessian(t, t2);
+          }
+        }
+      }
+    };
+
+    algorithm(pointInUnitCube, 2, visitor);
+  }
+
+ protected:
+  typedef typename AlgorithmHierarchicalDescent<BASIS>::Entry Entry;
+
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// 1D basis
+  BASIS base;
+  /// descent through the hierarchy
+  AlgorithmHierarchicalDescent<BASIS> algorithm;
+  /// inner derivative (temporary vector)
+  DataVector innerDerivative;
+  /// gradient of the current basis function (temporary vector)
+  DataVector curGradient;
+  /// Hessian of the current basis function (temporary matrix)
+  DataMatrix curHessian;
+
+  /**
+   * Transforms the point to the unit cube and computes the inner derivatives.
+   *
+   * @param point evaluation point
+   */
+  void prepare(const DataVector& point) {
+    pointInUnitCube = point;
+    storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
+
+    for (size_t t = 0; t < storage.getDimension(); t++) {
+      innerDerivative[t] = 1.0 / storage.getBoundingBox()->getIntervalWidth(t);
+    }
+  }
+
+  /**
+   * Computes the value, the gradient, and the Hessian of a basis function (in the same
+   * order of operations as OperationEvalHessianBsplineNaive).
+   *
+   * @param factors   1D factors of the basis function
+   * @param scaling   factor with which the gradient and the Hessian are initialized
+   * @return          value of the basis function (the gradient is stored in curGradient,
+   *                  the Hessian in curHessian)
+   */
+  double computeHessian(const std::vector<const Entry*>& factors, double scaling) {
+    const size_t d = factors.size();
+    double curValue = 1.0;
+    curGradient.setAll(scaling);
+    curHessian.setAll(scaling);
+
+    for (size_t t = 0; t < d; t++) {
+      const double val1d = factors[t]->value;
+      const double dx1d = factors[t]->dx * innerDerivative[t];
+      const double dxdx1d = factors[t]->dxdx * innerDerivative[t] * innerDerivative[t];
+
+      curValue *= val1d;
+
+      for (size_t t2 = 0; t2 < d; t2++) {
+        if (t2 == t) {
+          curGradient[t2] *= dx1d;
+
+          for (size_t t3 = 0; t3 < d; t3++) {
+            if (t3 == t) {
+              curHessian(t2, t3) *= dxdx1d;
+            } else {
+              curHessian(t2, t3) *= dx1d;
+            }
+          }
+        } else {
+          curGradient[t2] *= val1d;
+
+          for (size_t t3 = 0; t3 < d; t3++) {
+            if (t3 == t) {
+              curHessian(t2, t3) *= dx1d;
+            } else {
+              curHessian(t2, t3) *= val1d;
+            }
+          }
+        }
+      }
+    }
+
+    return curValue;
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* OPERATIONEVALHESSIANHIERARCHICALDESCENT_HPP */
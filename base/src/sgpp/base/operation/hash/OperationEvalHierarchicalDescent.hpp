@@ -0,0 +1,118 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONEVALHIERARCHICALDESCENT_HPP
+#define OPERATIONEVALHIERARCHICALDESCENT_HPP
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/AlgorithmHierarchicalDescent.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Operation for evaluating linear combinations of basis functions with compact support
+ * (e.g., B-splines) by descending the hierarchy (see AlgorithmHierarchicalDescent)
+ * instead of looping over all grid points as, e.g., OperationEvalBsplineNaive does.
+ *
+ * @tparam BASIS 1D basis (HierarchicalDescentSupport has to be specialized for it)
+ */
+template <class BASIS>
+class OperationEvalHierarchicalDescent : public OperationEval {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param storage   storage of the sparse grid
+   * @param base      1D basis
+   */
+  OperationEvalHierarchicalDescent(GridStorage& storage, const BASIS& base)
+      : storage(storage),
+        base(base),
+        algorithm(storage, this->base),
+        pointInUnitCube(storage.getDimension()) {}
+
+  /**
+   * Destructor.
+   */
+  ~OperationEvalHierarchicalDescent() override {}
+
+  /**
+   * @param alpha     coefficient vector
+   * @param point     evaluation point
+   * @return          value of the linear combination
+   */
+  double eval(const DataVector& alpha, const DataVector& point) override {
+    typedef typename AlgorithmHierarchicalDescent<BASIS>::Entry Entry;
+    double result = 0.0;
+
+    pointInUnitCube = point;
+    storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
+
+    auto visitor = [&alpha, &result](size_t seq, const std::vector<const Entry*>& factors) {
+      double curValue = 1.0;
+
+      for (const Entry* factor : factors) {
+        curValue *= factor->value;
+      }
+
+      result += alpha[seq] * curValue;
+    };
+
+    algorithm(pointInUnitCube, 0, visitor);
+    return result;
+  }
+
+  /**
+   * @param      alpha  coefficient matrix (each column is a coefficient vector)
+   * @param      point  evaluation point
+   * @param[out] value  values of linear combination
+   */
+  void eval(const DataMatrix& alpha, const DataVector& point, DataVector& value) override {
+    typedef typename AlgorithmHierarchicalDescent<BASIS>::Entry Entry;
+    const size_t m = alpha.getNcols();
+
+    pointInUnitCube = point;
+    storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
+
+    value.resize(m);
+    value.setAll(0.0);
+
+    auto visitor = [&alpha, &value, m](size_t seq, const std::vector<const Entry*>& factors) {
+      double curValue = 1.0;
+
+      for (const Entry* factor : factors) {
+        curValue *= factor->value;
+      }
+
+      for (size_t j = 0; j < m; j++) {
+        value[j] += alpha(seq, j) * curValue;
+      }
+    };
+
+    algorithm(pointInUnitCube, 0, visitor);
+  }
+
+ protected:
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// 1D basis
+  BASIS base;
+  /// descent through the hierarchy
+  AlgorithmHierarchicalDescent<BASIS> algorithm;
+  /// untransformed evaluation point (temporary vector)
+  DataVector pointInUnitCube;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* OPERATIONEVALHIERARCHICALDESCENT_HPP */
@@ -0,0 +1,213 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/operation/hash/OperationMultipleEvalBatched.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+OperationMultipleEvalBatched::OperationMultipleEvalBatched(Grid& grid, DataMatrix& dataset,
+                                                           size_t tileSize)
+    : OperationMultipleEval(grid, dataset),
+      storage(grid.getStorage()),
+      basis(grid.getBasis()),
+      tileSize(std::max(tileSize, static_cast<size_t>(1))) {}
+
+void OperationMultipleEvalBatched::mult(DataVector& alpha, DataVector& result) {
+  const size_t n = storage.getSize();
+  const size_t m = dataset.getNrows();
+  const size_t numberOfTiles = (m + tileSize - 1) / tileSize;
+
+  prepareEvaluation();
+  result.setAll(0.0);
+
+#pragma omp parallel
+  {
+    std::vector<double> tilePoints;
+    std::vector<double> table;
+    std::vector<double> curValues(tileSize);
+
+#pragma omp for schedule(dynamic)
+    for (size_t tile = 0; tile < numberOfTiles; tile++) {
+      const size_t start = tile * tileSize;
+      const size_t end = std::min(start + tileSize, m);
+      const size_t tileLength = end - start;
+      double* const curResult = &result[start];
+
+      evalTile(start, end, tilePoints, table);
+
+      for (size_t i = 0; i < n; i++) {
+        const double curAlpha = alpha[i];
+
+        if (curAlpha == 0.0) {
+          continue;
+        }
+
+        evalGridPoint(table, i, tileLength, curValues.data());
+
+#pragma omp simd
+        for (size_t b = 0; b < tileLength; b++) {
+          curResult[b] += curAlpha * curValues[b];
+        }
+      }
+    }
+  }
+}
+
+void OperationMultipleEvalBatched::multTranspose(DataVector& source, DataVector& result) {
+  const size_t n = storage.getSize();
+  const size_t m = dataset.getNrows();
+  const size_t numberOfTiles = (m + tileSize - 1) / tileSize;
+
+  prepareEvaluation();
+  result.setAll(0.0);
+
+#pragma omp parallel
+  {
+    std::vector<double> tilePoints;
+    std::vector<double> table;
+    std::vector<double> curValues(tileSize);
+    // every thread accumulates into its own vector to avoid write conflicts
+    std::vector<double> localResult(n, 0.0);
+
+#pragma omp for schedule(dynamic)
+    for (size_t tile = 0; tile < numberOfTiles; tile++) {
+      const size_t start = tile * tileSize;
+      const size_t end = std::min(start + tileSize, m);
+      const size_t tileLength = end - start;
+      const double* const curSource = &source[start];
+
+      evalTile(start, end, tilePoints, table);
+
+      for (size_t i = 0; i < n; i++) {
+        evalGridPoint(table, i, tileLength, curValues.data());
+        double sum = 0.0;
+
+#pragma omp simd reduction(+ : sum)
+        for (size_t b = 0; b < tileLength; b++) {
+          sum += curValues[b] * curSource[b];
+        }
+
+        localResult[i] += sum;
+      }
+    }
+
+#pragma omp critical
+    {
+      for (size_t i = 0; i < n; i++) {
+        result[i] += localResult[i];
+      }
+    }
+  }
+}
+
+double OperationMultipleEvalBatched::getDuration() { return 0.0; }
+
+std::string OperationMultipleEvalBatched::getImplementationName() { return "BATCHED"; }
+
+void OperationMultipleEvalBatched::prepareEvaluation() {
+  const size_t n = storage.getSize();
+  const size_t d = storage.getDimension();
+
+  levels.assign(d, std::vector<level_t>());
+  indices.assign(d, std::vector<index_t>());
+  dimensionOffsets.assign(d, 0);
+  tableOffsets.resize(n * d);
+
+  // assign consecutive numbers to the distinct (level, index) pairs of every dimension
+  std::vector<std::unordered_map<uint64_t, size_t>> numbers(d);
+
+  for (size_t i = 0; i < n; i++) {
+    const GridPoint& gp = storage[i];
+
+    for (size_t t = 0; t < d; t++) {
+      const level_t l = gp.getLevel(t);
+      const index_t idx = gp.getIndex(t);
+      const uint64_t key = (static_cast<uint64_t>(l) << 32) | static_cast<uint64_t>(idx);
+      auto it = numbers[t].find(key);
+
+      if (it == numbers[t].end()) {
+        it = numbers[t].emplace(key, levels[t].size()).first;
+        levels[t].push_back(l);
+        indices[t].push_back(idx);
+      }
+
+      tableOffsets[i * d + t] = it->second;
+    }
+  }
+
+  size_t numberOfRows = 0;
+
+  for (size_t t = 0; t < d; t++) {
+    dimensionOffsets[t] = numberOfRows;
+    numberOfRows += levels[t].size();
+  }
+
+  // convert the numbers into offsets of the rows in the table of 1D values
+  for (size_t i = 0; i < n; i++) {
+    for (size_t t = 0; t < d; t++) {
+      tableOffsets[i * d + t] = (dimensionOffsets[t] + tableOffsets[i * d + t]) * tileSize;
+    }
+  }
+}
+
+void OperationMultipleEvalBatched::evalTile(size_t start, size_t end,
+                                            std::vector<double>& tilePoints,
+                                            std::vector<double>& table) const {
+  const size_t d = storage.getDimension();
+  const size_t numberOfRows = (d > 0) ? (dimensionOffsets[d - 1] + levels[d - 1].size()) : 0;
+  const BoundingBox& boundingBox = *storage.getBoundingBox();
+
+  tilePoints.resize(d * tileSize);
+  table.resize(numberOfRows * tileSize);
+
+  for (size_t t = 0; t < d; t++) {
+    double* const coordinates = &tilePoints[t * tileSize];
+
+    for (size_t j = start; j < end; j++) {
+      coordinates[j - start] = boundingBox.transformPointToUnitCube(t, dataset(j, t));
+    }
+
+    for (size_t k = 0; k < levels[t].size(); k++) {
+      double* const row = &table[(dimensionOffsets[t] + k) * tileSize];
+
+      for (size_t j = 0; j < end - start; j++) {
+        row[j] = basis.eval(levels[t][k], indices[t][k], coordinates[j]);
+      }
+    }
+  }
+}
+
+void OperationMultipleEvalBatched::evalGridPoint(const std::vector<double>& table, size_t i,
+                                                 size_t tileLength, double* curValues) const {
+  const size_t d = storage.getDimension();
+  const size_t* const offsets = &tableOffsets[i * d];
+  const double* row = &table[offsets[0]];
+
+#pragma omp simd
+  for (size_t b = 0; b < tileLength; b++) {
+    curValues[b] = row[b];
+  }
+
+  for (size_t t = 1; t < d; t++) {
+    row = &table[offsets[t]];
+
+#pragma omp simd
+    for (size_t b = 0; b < tileLength; b++) {
+      curValues[b] *= row[b];
+    }
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,119 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONMULTIPLEEVALBATCHED_HPP
+#define OPERATIONMULTIPLEEVALBATCHED_HPP
+
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/hash/common/basis/Basis.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Batched evaluation of sparse grid functions for arbitrary 1D bases (e.g., B-splines,
+ * not-a-knot B-splines, fundamental splines, or wavelets) at many points.
+ *
+ * The data points are split into tiles of tileSize points, which are processed in parallel
+ * (OpenMP). For every tile, the points are transformed to the unit cube (so that the dataset
+ * is neither copied nor modified), and the 1D basis functions are evaluated once for all
+ * distinct (level, index) pairs of every dimension and all points of the tile. Afterwards, the
+ * values of the d-dimensional basis functions are the products of rows of this table,
+ * which are computed for all points of the tile at once (vectorized innermost loop).
+ * The number of calls to the 1D basis is therefore reduced from
+ * \f$\mathcal{O}(N d m)\f$ to \f$\mathcal{O}(K m)\f$, where K is the total number of
+ * distinct 1D basis functions (usually much smaller than N d).
+ *
+ * The results of mult are identical to the ones of the naive operations
+ * (e.g., OperationMultipleEvalBsplineNaive), as the factors are multiplied in the same order.
+ *
+ * @note The 1D basis of the grid is evaluated by multiple threads simultaneously,
+ *       so its eval method must not modify its state.
+ */
+class OperationMultipleEvalBatched : public OperationMultipleEval {
+ public:
+  /// default number of data points per tile
+  static const size_t DEFAULT_TILE_SIZE = 64;
+
+  /**
+   * Constructor.
+   *
+   * @param grid      grid (its 1D basis is used for the evaluation)
+   * @param dataset   data points (one per row)
+   * @param tileSize  number of data points per tile
+   */
+  OperationMultipleEvalBatched(Grid& grid, DataMatrix& dataset,
+                               size_t tileSize = DEFAULT_TILE_SIZE);
+
+  /**
+   * Destructor.
+   */
+  ~OperationMultipleEvalBatched() override {}
+
+  void mult(DataVector& alpha, DataVector& result) override;
+  void multTranspose(DataVector& source, DataVector& result) override;
+
+  double getDuration() override;
+
+  std::string getImplementationName() override;
+
+ protected:
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// 1D basis of the grid
+  SBasis& basis;
+  /// number of data points per tile
+  size_t tileSize;
+  /// per dimension: distinct levels of the 1D basis functions
+  std::vector<std::vector<level_t>> levels;
+  /// per dimension: distinct indices of the 1D basis functions
+  std::vector<std::vector<index_t>> indices;
+  /// position of the first row of every dimension in the table of 1D values
+  std::vector<size_t> dimensionOffsets;
+  /// per grid point and dimension (row-major): offset of the 1D values in the table
+  std::vector<size_t> tableOffsets;
+
+  /**
+   * Collects the distinct 1D basis functions of the grid.
+   * Called by mult and multTranspose, as the grid may have changed.
+   */
+  void prepareEvaluation();
+
+  /**
+   * Transforms the points of a tile to the unit cube and evaluates all distinct
+   * 1D basis functions at them.
+   *
+   * @param      start       index of the first data point of the tile
+   * @param      end         index after the last data point of the tile
+   * @param[out] tilePoints  coordinates of the points of the tile in the unit cube
+   *                         (one row of tileSize entries per dimension)
+   * @param[out] table       table of 1D values (one row of tileSize entries per
+   *                         1D basis function)
+   */
+  void evalTile(size_t start, size_t end, std::vector<double>& tilePoints,
+                std::vector<double>& table) const;
+
+  /**
+   * Multiplies the rows of the table of 1D values that belong to a grid point.
+   *
+   * @param      table       table of 1D values
+   * @param      i           sequence number of the grid point
+   * @param      tileLength  number of data points in the current tile
+   * @param[out] curValues   values of the basis function of the grid point at the tile's points
+   */
+  void evalGridPoint(const std::vector<double>& table, size_t i, size_t tileLength,
+                     double* curValues) const;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* OPERATIONMULTIPLEEVALBATCHED_HPP */
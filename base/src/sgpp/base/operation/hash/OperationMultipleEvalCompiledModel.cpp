@@ -0,0 +1,24 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/operation/hash/OperationMultipleEvalCompiledModel.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace base {
+
+void OperationMultipleEvalCompiledModel::mult(DataVector& alpha, DataVector& result) {
+  model.mult(alpha, this->dataset, result);
+}
+
+void OperationMultipleEvalCompiledModel::multTranspose(DataVector& source, DataVector& result) {
+  model.multTranspose(source, this->dataset, result);
+}
+
+double OperationMultipleEvalCompiledModel::getDuration() { return 0.0; }
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,56 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONMULTIPLEEVALCOMPILEDMODEL_HPP
+#define OPERATIONMULTIPLEEVALCOMPILEDMODEL_HPP
+
+#include <sgpp/base/grid/CompiledGridModel.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * OperationMultipleEval for a CompiledGridModel.
+ * The grid of the operation is the grid description of the model, which has no grid points;
+ * the vectors of grid point values have CompiledGridModel::getSize entries.
+ */
+class OperationMultipleEvalCompiledModel : public OperationMultipleEval {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param model   compiled model (must exist as long as the operation)
+   * @param dataset the dataset that should be evaluated
+   */
+  OperationMultipleEvalCompiledModel(const CompiledGridModel& model, DataMatrix& dataset)
+      : OperationMultipleEval(model.getGridDescription(), dataset), model(model) {}
+
+  /**
+   * Destructor.
+   */
+  ~OperationMultipleEvalCompiledModel() override {}
+
+  /**
+   * @param      alpha  coefficients in the order of the grid points of the compiled grid,
+   *                    or an empty vector to evaluate the model
+   * @param[out] result values at the data points
+   */
+  void mult(DataVector& alpha, DataVector& result) override;
+  void multTranspose(DataVector& source, DataVector& result) override;
+
+  double getDuration() override;
+
+ protected:
+  /// compiled model
+  const CompiledGridModel& model;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* OPERATIONMULTIPLEEVALCOMPILEDMODEL_HPP */
@@ -4,6 +4,8 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/base/operation/hash/common/algorithm_sweep/DehierarchisationLinear.hpp>
+#include <sgpp/base/operation/hash/common/algorithm_sweep/LinearPoleKernels.hpp>
+#include <sgpp/base/algorithm/PoleBatch.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -25,6 +27,21 @@ void DehierarchisationLinear::operator()(DataVector& source, DataVector& result,
   rec(source, result, index, dim, 0.0, 0.0);
 }
 
+void DehierarchisationLinear::processPoles(DataVector& source, DataVector& result,
+                                           const size_t* poles, size_t numPoles, size_t dim) {
+  PoleBatch batch(storage, dim);
+  batch.gather(poles, numPoles);
+  LinearPoleKernels::dehierarchise(batch, source, result, false);
+
+  // poles that are too deep for the buffers are processed recursively
+  grid_iterator index(storage);
+
+  for (size_t seq : batch.getSkippedPoles()) {
+    index.set(storage.getPoint(seq));
+    (*this)(source, result, index, dim);
+  }
+}
+
 void DehierarchisationLinear::rec(DataVector& source, DataVector& result,
                                   grid_iterator& index, size_t dim,
                                   double fl, double fr) {
@@ -6,6 +6,7 @@
 #ifndef DEHIERARCHISATIONMODLINEAR_HPP
 #define DEHIERARCHISATIONMODLINEAR_HPP
 
+#include <sgpp/base/algorithm/sweep.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
@@ -53,6 +54,19 @@ class DehierarchisationModLinear {
   void operator()(DataVector& source, DataVector& result, grid_iterator& index,
                   size_t dim);
 
+  /**
+   * Processes several poles at once, with the poles gathered into dense buffers (see PoleBatch).
+   * Computes the same as calling operator() for each of the poles.
+   *
+   * @param source this DataVector holds the input coefficients
+   * @param result this DataVector holds the output coefficients
+   * @param poles sequence numbers of the starting points of the poles
+   * @param numPoles number of poles
+   * @param dim current fixed dimension of the 'execution direction'
+   */
+  void processPoles(DataVector& source, DataVector& result, const size_t* poles,
+                    size_t numPoles, size_t dim);
+
  protected:
   /**
    * Recursive dehierarchisaton algorithm, this algorithms works in-place -> source should be equal to result
@@ -68,6 +82,15 @@ class DehierarchisationModLinear {
            size_t dim, double fl, double fr);
 };
 
+/**
+ * The poles are processed in batches by processPoles.
+ */
+template<>
+struct sweep_traits<DehierarchisationModLinear> {
+  static const bool parallel = true;
+  static const bool batched = true;
+};
+
 }  // namespace base
 }  // namespace sgpp
 
@@ -7,6 +7,8 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <sgpp/base/operation/hash/common/algorithm_sweep/HierarchisationLinear.hpp>
+#include <sgpp/base/operation/hash/common/algorithm_sweep/LinearPoleKernels.hpp>
+#include <sgpp/base/algorithm/PoleBatch.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -28,6 +30,21 @@ void HierarchisationLinear::operator()(DataVector& source, DataVector& result,
   rec(source, result, index, dim, 0.0, 0.0);
 }
 
+void HierarchisationLinear::processPoles(DataVector& source, DataVector& result,
+                                         const size_t* poles, size_t numPoles, size_t dim) {
+  PoleBatch batch(storage, dim);
+  batch.gather(poles, numPoles);
+  LinearPoleKernels::hierarchise(batch, source, result, false);
+
+  // poles that are too deep for the buffers are processed recursively
+  grid_iterator index(storage);
+
+  for (size_t seq : batch.getSkippedPoles()) {
+    index.set(storage.getPoint(seq));
+    (*this)(source, result, index, dim);
+  }
+}
+
 void HierarchisationLinear::rec(DataVector& source, DataVector& result,
                                 grid_iterator& index, size_t dim,
                                 double fl, double fr) {
@@ -0,0 +1,147 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/operation/hash/common/algorithm_sweep/LinearPoleKernels.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+namespace {
+
+/// how the values passed on to the children are modified at a heap position
+enum class BoundaryTreatment { none, constant, left, right };
+
+/**
+ * Processes one batch of poles. values contains the input values and is overwritten
+ * with the output values; fl and fr are scratch buffers of the same size.
+ *
+ * @param values        values of the poles (see PoleBatch)
+ * @param fl            scratch buffer for the left values passed on to the points
+ * @param fr            scratch buffer for the right values passed on to the points
+ * @param depth         depth of the batch
+ * @param modified      whether to use the modified linear basis
+ * @param dehierarchise dehierarchise instead of hierarchise
+ */
+void processBatch(double* values, double* fl, double* fr, level_t depth, bool modified,
+                  bool dehierarchise) {
+  const size_t lanes = PoleBatch::lanes;
+  const size_t numPositions = static_cast<size_t>(1) << depth;
+
+  // the root gets zero boundary values
+  std::fill(fl + lanes, fl + 2 * lanes, 0.0);
+  std::fill(fr + lanes, fr + 2 * lanes, 0.0);
+
+  for (size_t p = 1; p < numPositions; p++) {
+    // level and index of heap position p
+    level_t l = 1;
+
+    while ((p >> l) != 0) {
+      l++;
+    }
+
+    const index_t i = static_cast<index_t>(2 * (p - (static_cast<size_t>(1) << (l - 1))) + 1);
+
+    double* fm = values + p * lanes;
+    const double* flm = fl + p * lanes;
+    const double* frm = fr + p * lanes;
+
+    if (dehierarchise) {
+      for (size_t k = 0; k < lanes; k++) {
+        fm[k] += ((flm[k] + frm[k]) / 2.0);
+      }
+    }
+
+    if (2 * p < numPositions) {
+      // pass the values on to the children; for missing points, this just computes garbage
+      // that ends up in the (also missing) children
+      BoundaryTreatment treatment = BoundaryTreatment::none;
+
+      if (modified) {
+        if (l == 1) {
+          treatment = BoundaryTreatment::constant;
+        } else if (i == 1) {
+          treatment = BoundaryTreatment::left;
+        } else if (i == (static_cast<index_t>(1) << l) - 1) {
+          treatment = BoundaryTreatment::right;
+        }
+      }
+
+      double* flLeft = fl + 2 * p * lanes;
+      double* frLeft = fr + 2 * p * lanes;
+      double* flRight = fl + (2 * p + 1) * lanes;
+      double* frRight = fr + (2 * p + 1) * lanes;
+
+      for (size_t k = 0; k < lanes; k++) {
+        flLeft[k] = flm[k];
+        frLeft[k] = fm[k];
+        flRight[k] = fm[k];
+        frRight[k] = frm[k];
+      }
+
+      if (treatment == BoundaryTreatment::constant) {
+        for (size_t k = 0; k < lanes; k++) {
+          flLeft[k] = fm[k];
+          frRight[k] = fm[k];
+        }
+      } else if (treatment == BoundaryTreatment::left) {
+        for (size_t k = 0; k < lanes; k++) {
+          flLeft[k] = fm[k] - (frm[k] - fm[k]);
+        }
+      } else if (treatment == BoundaryTreatment::right) {
+        for (size_t k = 0; k < lanes; k++) {
+          frRight[k] = fm[k] - (flm[k] - fm[k]);
+        }
+      }
+    }
+
+    if (!dehierarchise) {
+      for (size_t k = 0; k < lanes; k++) {
+        fm[k] = fm[k] - ((flm[k] + frm[k]) / 2.0);
+      }
+    }
+  }
+}
+
+/**
+ * Gathers, processes, and scatters all batches of poles.
+ */
+void processBatches(const PoleBatch& poles, DataVector& source, DataVector& result,
+                    bool modified, bool dehierarchise) {
+  std::vector<double> values;
+  std::vector<double> fl;
+  std::vector<double> fr;
+
+  for (size_t batch = 0; batch < poles.getNumberOfBatches(); batch++) {
+    const size_t size = poles.getBufferSize(batch);
+    values.resize(size);
+    fl.resize(size);
+    fr.resize(size);
+
+    poles.load(batch, source, values.data());
+    processBatch(values.data(), fl.data(), fr.data(), poles.getDepth(batch), modified,
+                 dehierarchise);
+    poles.store(batch, values.data(), result);
+  }
+}
+
+}  // namespace
+
+void LinearPoleKernels::hierarchise(const PoleBatch& poles, DataVector& source,
+                                    DataVector& result, bool modified) {
+  processBatches(poles, source, result, modified, false);
+}
+
+void LinearPoleKernels::dehierarchise(const PoleBatch& poles, DataVector& source,
+                                      DataVector& result, bool modified) {
+  processBatches(poles, source, result, modified, true);
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,54 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef LINEARPOLEKERNELS_HPP
+#define LINEARPOLEKERNELS_HPP
+
+#include <sgpp/base/algorithm/PoleBatch.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * 1D (de)hierarchisation kernels for the linear and the modified linear basis,
+ * working on batches of poles gathered by PoleBatch.
+ *
+ * They compute the same as the recursive functors (e.g., HierarchisationLinear), but
+ * traverse the poles level by level in heap order. All poles of a batch have the same
+ * level and index at a heap position, so the (modified) boundary treatment is the same for
+ * all of them and the innermost loop over the poles vectorizes.
+ */
+class LinearPoleKernels {
+ public:
+  /**
+   * Hierarchises all batches of poles.
+   *
+   * @param poles    gathered poles
+   * @param source   nodal values
+   * @param result   hierarchical surpluses (may be the same as source)
+   * @param modified whether to use the modified linear basis
+   */
+  static void hierarchise(const PoleBatch& poles, DataVector& source, DataVector& result,
+                          bool modified);
+
+  /**
+   * Dehierarchises all batches of poles.
+   *
+   * @param poles    gathered poles
+   * @param source   hierarchical surpluses
+   * @param result   nodal values (may be the same as source)
+   * @param modified whether to use the modified linear basis
+   */
+  static void dehierarchise(const PoleBatch& poles, DataVector& source, DataVector& result,
+                            bool modified);
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* LINEARPOLEKERNELS_HPP */
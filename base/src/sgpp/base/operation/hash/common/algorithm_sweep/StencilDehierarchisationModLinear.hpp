@@ -9,6 +9,7 @@
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/hash/OperationStencilHierarchisation.hpp>
+#include <sgpp/base/algorithm/sweep.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -82,6 +83,15 @@ class StencilDehierarchisationModLinear {
   OperationStencilHierarchisation::WeightStencil& _weightStencil;
 };
 
+/**
+ * The stencil is assembled in shared vectors, so the poles are processed sequentially.
+ */
+template<>
+struct sweep_traits<StencilDehierarchisationModLinear> {
+  static const bool parallel = false;
+  static const bool batched = false;
+};
+
 }  // namespace base
 }  // namespace sgpp
 
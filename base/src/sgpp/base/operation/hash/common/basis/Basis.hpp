@@ -53,6 +53,14 @@ class Basis {
    */
   virtual double getIntegral(LT level, IT index) = 0;
 
+  /**
+   * Returns whether eval and evalDx may be called by multiple threads simultaneously,
+   * i.e., whether they do not modify the state of the basis.
+   *
+   * @return whether the basis can be evaluated concurrently
+   */
+  virtual bool isThreadSafe() const { return true; }
+
   /**
    * Destructor.
    */
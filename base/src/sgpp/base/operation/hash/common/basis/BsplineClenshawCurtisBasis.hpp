@@ -255,6 +255,11 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
    */
   inline size_t getDegree() const override { return bsplineBasis.getDegree(); }
 
+  /**
+   * @return      false, as eval and evalDx construct the knots in a member
+   */
+  bool isThreadSafe() const override { return false; }
+
   /**
    * @param l     level of basis function
    * @param i     index of basis function
@@ -182,6 +182,11 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    */
   inline size_t getDegree() const override { return degree; }
 
+  /**
+   * @return      false, as eval and evalDx construct the knots in a member
+   */
+  bool isThreadSafe() const override { return false; }
+
   /**
    * @param l     level of basis function
    * @param i     index of basis function
@@ -0,0 +1,191 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/CPUFeatures.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#ifdef SGPP_RUNTIME_ISA_DISPATCH
+#include <cpuid.h>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+namespace {
+
+/**
+ * @param isa   instruction set
+ * @return      whether the CPU supports the instruction set (or, without
+ *              SGPP_RUNTIME_ISA_DISPATCH, whether it is enabled at compile time)
+ */
+bool isSupportedByCPU(InstructionSet isa) {
+#ifdef SGPP_RUNTIME_ISA_DISPATCH
+  // the checks of the AVX extensions include the check whether the OS saves the registers
+  __builtin_cpu_init();
+
+  switch (isa) {
+    case InstructionSet::SCALAR:
+      return true;
+    case InstructionSet::SSE3:
+      return __builtin_cpu_supports("sse3");
+    case InstructionSet::AVX:
+      return __builtin_cpu_supports("avx");
+    case InstructionSet::AVX2:
+      return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case InstructionSet::AVX512F:
+      return __builtin_cpu_supports("avx512f");
+  }
+
+  return false;
+#else
+  switch (isa) {
+    case InstructionSet::SCALAR:
+      return true;
+    case InstructionSet::SSE3:
+#if defined(__SSE3__) || defined(__MIC__)
+      return true;
+#else
+      return false;
+#endif
+    case InstructionSet::AVX:
+#if defined(__AVX__) || defined(__MIC__)
+      return true;
+#else
+      return false;
+#endif
+    case InstructionSet::AVX2:
+#if (defined(__AVX2__) && defined(__FMA__)) || defined(__MIC__)
+      return true;
+#else
+      return false;
+#endif
+    case InstructionSet::AVX512F:
+#if defined(__AVX512F__) || defined(__MIC__)
+      return true;
+#else
+      return false;
+#endif
+  }
+
+  return false;
+#endif
+}
+
+/**
+ * @return reference to the maximum instruction set, which is initialized with the value of
+ *         the environment variable SGPP_MAX_INSTRUCTION_SET (if set and valid)
+ */
+InstructionSet& maximumInstructionSet() {
+  static InstructionSet maximum = []() {
+    const char* value = std::getenv("SGPP_MAX_INSTRUCTION_SET");
+
+    if (value != nullptr) {
+      try {
+        return CPUFeatures::fromString(value);
+      } catch (const data_exception&) {
+        // ignore invalid values
+      }
+    }
+
+    return InstructionSet::AVX512F;
+  }();
+
+  return maximum;
+}
+
+}  // namespace
+
+bool CPUFeatures::isSupported(InstructionSet isa) {
+  return (static_cast<int>(isa) <= static_cast<int>(getMaximumInstructionSet())) &&
+         isSupportedByCPU(isa);
+}
+
+InstructionSet CPUFeatures::getBestInstructionSet() {
+  for (InstructionSet isa : {InstructionSet::AVX512F, InstructionSet::AVX2, InstructionSet::AVX,
+                             InstructionSet::SSE3}) {
+    if (isSupported(isa)) {
+      return isa;
+    }
+  }
+
+  return InstructionSet::SCALAR;
+}
+
+InstructionSet CPUFeatures::getMaximumInstructionSet() { return maximumInstructionSet(); }
+
+void CPUFeatures::setMaximumInstructionSet(InstructionSet isa) { maximumInstructionSet() = isa; }
+
+std::string CPUFeatures::getCPUModel() {
+#ifdef SGPP_RUNTIME_ISA_DISPATCH
+  // the brand string is returned by the extended CPUID leaves 0x80000002 to 0x80000004
+  if (__get_cpuid_max(0x80000000, nullptr) >= 0x80000004) {
+    unsigned int registers[12];
+
+    for (unsigned int i = 0; i < 3; i++) {
+      __get_cpuid(0x80000002 + i, &registers[4 * i], &registers[4 * i + 1],
+                  &registers[4 * i + 2], &registers[4 * i + 3]);
+    }
+
+    std::string model(reinterpret_cast<const char*>(registers), sizeof(registers));
+    model = model.substr(0, model.find('\0'));
+
+    // remove leading and trailing spaces
+    const size_t first = model.find_first_not_of(' ');
+    const size_t last = model.find_last_not_of(' ');
+
+    if (first != std::string::npos) {
+      return model.substr(first, last - first + 1);
+    }
+  }
+#endif
+
+  return "unknown";
+}
+
+std::string CPUFeatures::toString(InstructionSet isa) {
+  switch (isa) {
+    case InstructionSet::SCALAR:
+      return "scalar";
+    case InstructionSet::SSE3:
+      return "sse3";
+    case InstructionSet::AVX:
+      return "avx";
+    case InstructionSet::AVX2:
+      return "avx2";
+    case InstructionSet::AVX512F:
+      return "avx512f";
+  }
+
+  return "unknown";
+}
+
+InstructionSet CPUFeatures::fromString(const std::string& name) {
+  std::string lowerName = name;
+  std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(),
+                 [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+  for (InstructionSet isa : {InstructionSet::SCALAR, InstructionSet::SSE3, InstructionSet::AVX,
+                             InstructionSet::AVX2, InstructionSet::AVX512F}) {
+    if (lowerName == toString(isa)) {
+      return isa;
+    }
+  }
+
+  if (lowerName == "avx512") {
+    return InstructionSet::AVX512F;
+  }
+
+  throw data_exception("CPUFeatures::fromString: unknown instruction set");
+}
+
+}  // namespace base
+}  // namespace sgpp
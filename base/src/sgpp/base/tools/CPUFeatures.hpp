@@ -0,0 +1,112 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef CPUFEATURES_HPP
+#define CPUFEATURES_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <string>
+
+/*
+ * SGPP_RUNTIME_ISA_DISPATCH is defined if the compiler is able to generate code for instruction
+ * sets that are not enabled for the whole library (target attribute of GCC and Clang). Then,
+ * kernels for several instruction sets are compiled into the library and the best one that is
+ * supported by the CPU is chosen at runtime. Otherwise, only the kernels for the instruction
+ * sets that are enabled at compile time (e.g., via -mavx2) are available.
+ *
+ * SGPP_TARGET(isa) marks a function to be compiled for the given instruction set
+ * (e.g., SGPP_TARGET("avx2,fma")).
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__INTEL_COMPILER) && \
+    (defined(__x86_64__) || defined(__i386__)) && !defined(__MIC__)
+#define SGPP_RUNTIME_ISA_DISPATCH
+#define SGPP_TARGET(isa) __attribute__((target(isa)))
+#else
+#define SGPP_TARGET(isa)
+#endif
+
+namespace sgpp {
+namespace base {
+
+/**
+ * x86 instruction set extensions for which SG++ contains specialized kernels,
+ * ordered from oldest to newest.
+ */
+enum class InstructionSet {
+  /// no SIMD extensions (portable C++)
+  SCALAR = 0,
+  /// SSE3
+  SSE3 = 1,
+  /// AVX
+  AVX = 2,
+  /// AVX2 together with FMA3
+  AVX2 = 3,
+  /// AVX-512 Foundation (or the instruction set of Knights Corner Xeon Phis)
+  AVX512F = 4
+};
+
+/**
+ * Detects the instruction set extensions of the CPU the program is running on
+ * (via CPUID, including the check whether the operating system saves the AVX registers).
+ *
+ * The instruction sets that are used by the kernels can be limited, either with
+ * setMaximumInstructionSet or with the environment variable SGPP_MAX_INSTRUCTION_SET
+ * (e.g., SGPP_MAX_INSTRUCTION_SET=avx2). This is useful for benchmarks and for
+ * reproducing results on heterogeneous clusters.
+ *
+ * If SGPP_RUNTIME_ISA_DISPATCH is not defined, the instruction sets enabled at compile time
+ * are reported instead of the ones of the CPU.
+ */
+class CPUFeatures {
+ public:
+  /**
+   * @param isa   instruction set
+   * @return      whether the CPU supports the instruction set and the instruction set
+   *              is not above the maximum instruction set
+   */
+  static bool isSupported(InstructionSet isa);
+
+  /**
+   * @return newest instruction set that is supported (see isSupported)
+   */
+  static InstructionSet getBestInstructionSet();
+
+  /**
+   * @return maximum instruction set that may be used by the kernels
+   */
+  static InstructionSet getMaximumInstructionSet();
+
+  /**
+   * Limits the instruction sets that may be used by the kernels.
+   * Operations that have already been created are not affected.
+   *
+   * @param isa   maximum instruction set
+   */
+  static void setMaximumInstructionSet(InstructionSet isa);
+
+  /**
+   * @return model name of the CPU (brand string reported by CPUID, "unknown" if it is
+   *         not available)
+   */
+  static std::string getCPUModel();
+
+  /**
+   * @param isa   instruction set
+   * @return      name of the instruction set (e.g., "avx2")
+   */
+  static std::string toString(InstructionSet isa);
+
+  /**
+   * @param name  name of an instruction set (case-insensitive, e.g., "AVX2")
+   * @return      corresponding instruction set
+   */
+  static InstructionSet fromString(const std::string& name);
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* CPUFEATURES_HPP */
@@ -0,0 +1,109 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SGPP_HAVE_MMAP
+#endif
+
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+const uint64_t MemoryMappedFile::CHECKSUM_SEED;
+
+MemoryMappedFile::MemoryMappedFile(const std::string& fileName, bool copyOnWrite)
+    : data(nullptr), size(0), mapped(false) {
+#ifdef SGPP_HAVE_MMAP
+  const int fileDescriptor = open(fileName.c_str(), O_RDONLY);
+
+  if (fileDescriptor < 0) {
+    throw file_exception("MemoryMappedFile: cannot open file");
+  }
+
+  struct stat fileStatus;
+
+  if ((fstat(fileDescriptor, &fileStatus) != 0) || (fileStatus.st_size == 0)) {
+    close(fileDescriptor);
+    throw file_exception("MemoryMappedFile: cannot read file");
+  }
+
+  size = static_cast<size_t>(fileStatus.st_size);
+  void* address = copyOnWrite
+                      ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileDescriptor, 0)
+                      : mmap(nullptr, size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+  close(fileDescriptor);
+
+  if (address == MAP_FAILED) {
+    throw file_exception("MemoryMappedFile: cannot map file");
+  }
+
+  data = static_cast<char*>(address);
+  mapped = true;
+#else
+  std::ifstream istream(fileName, std::ios::binary | std::ios::ate);
+
+  if (!istream) {
+    throw file_exception("MemoryMappedFile: cannot open file");
+  }
+
+  size = static_cast<size_t>(istream.tellg());
+
+  if (size == 0) {
+    throw file_exception("MemoryMappedFile: cannot read file");
+  }
+
+  data = new char[size];
+  istream.seekg(0);
+
+  if (!istream.read(data, size)) {
+    delete[] data;
+    throw file_exception("MemoryMappedFile: cannot read file");
+  }
+#endif
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+#ifdef SGPP_HAVE_MMAP
+  if (mapped) {
+    munmap(data, size);
+    return;
+  }
+#endif
+
+  delete[] data;
+}
+
+uint64_t MemoryMappedFile::computeChecksum(const void* data, size_t size, uint64_t checksum) {
+  const uint64_t prime = 0x100000001b3ULL;
+  const char* bytes = static_cast<const char*>(data);
+  size_t i = 0;
+
+  for (; i + 8 <= size; i += 8) {
+    uint64_t word;
+    std::memcpy(&word, bytes + i, 8);
+    checksum = (checksum ^ word) * prime;
+  }
+
+  for (; i < size; i++) {
+    checksum = (checksum ^ static_cast<unsigned char>(bytes[i])) * prime;
+  }
+
+  return checksum;
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,86 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef MEMORYMAPPEDFILE_HPP
+#define MEMORYMAPPEDFILE_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Maps a whole file into memory.
+ *
+ * Read-only mappings are shared, i.e., all processes that map the same file use the same
+ * pages of the page cache. Copy-on-write mappings can be modified without changing the file.
+ * On platforms without mmap, the file is read into memory.
+ */
+class MemoryMappedFile {
+ public:
+  /**
+   * Constructor. Throws a file_exception if the file cannot be opened, is empty, or cannot be
+   * mapped.
+   *
+   * @param fileName    name of the file
+   * @param copyOnWrite whether the mapped data may be modified (the file is not changed)
+   */
+  explicit MemoryMappedFile(const std::string& fileName, bool copyOnWrite = false);
+
+  /**
+   * Destructor. Unmaps the file.
+   */
+  ~MemoryMappedFile();
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+  /**
+   * @return pointer to the data (page-aligned if the file is mapped),
+   *         writable only for copy-on-write mappings
+   */
+  char* getData() const { return data; }
+
+  /**
+   * @return size of the file in bytes
+   */
+  size_t getSize() const { return size; }
+
+  /**
+   * @return whether the file is mapped (false if it was read into memory)
+   */
+  bool isMapped() const { return mapped; }
+
+  /**
+   * FNV-1a variant that processes 8 bytes at once.
+   *
+   * @param data      data
+   * @param size      size of the data in bytes
+   * @param checksum  checksum of the preceding data (CHECKSUM_SEED at the beginning)
+   * @return          checksum of the preceding data and the given data
+   */
+  static uint64_t computeChecksum(const void* data, size_t size,
+                                  uint64_t checksum = CHECKSUM_SEED);
+
+  /// initial value of computeChecksum
+  static const uint64_t CHECKSUM_SEED = 0xcbf29ce484222325ULL;
+
+ private:
+  /// mapped data
+  char* data;
+  /// size of the file in bytes
+  size_t size;
+  /// whether the data is mapped or allocated
+  bool mapped;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* MEMORYMAPPEDFILE_HPP */
@@ -157,6 +157,7 @@
 #include <sgpp/base/grid/type/WaveletGrid.hpp>
 #include <sgpp/base/grid/type/WeaklyFundamentalNakSplineBoundaryGrid.hpp>
 #include <sgpp/base/grid/type/WeaklyFundamentalSplineBoundaryGrid.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
 #include <sgpp/base/tools/Distribution.hpp>
 #include <sgpp/base/tools/DistributionLogNormal.hpp>
 #include <sgpp/base/tools/DistributionNormal.hpp>
@@ -0,0 +1,136 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/grid/generation/hashmap/AbstractRefinement.hpp>
+#include <sgpp/base/grid/generation/hashmap/HashRefinement.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+using sgpp::base::AbstractRefinement;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::GridPoint;
+using sgpp::base::GridStorage;
+using sgpp::base::HashRefinement;
+using sgpp::base::SurplusRefinementFunctor;
+
+BOOST_AUTO_TEST_SUITE(TestHashRefinementParallel)
+
+/*
+  Serial refinement as implemented before the parallelization
+  (heap of keys in the order of the map, refinement in the order of the heap)
+ */
+void referenceRefine(GridStorage& storage, SurplusRefinementFunctor& functor) {
+  HashRefinement refinement;
+  AbstractRefinement::refinement_container_type collection;
+
+  for (auto iter = storage.begin(); iter != storage.end(); iter++) {
+    // check whether a child is missing
+    GridPoint point(*(iter->first));
+    bool missing = false;
+
+    for (size_t d = 0; (d < storage.getDimension()) && !missing; d++) {
+      sgpp::base::level_t level;
+      sgpp::base::index_t index;
+      point.get(d, level, index);
+      point.set(d, level + 1, 2 * index - 1);
+      missing = !storage.isContaining(point);
+      point.set(d, level + 1, 2 * index + 1);
+      missing = missing || !storage.isContaining(point);
+      point.set(d, level, index);
+    }
+
+    if (!missing) {
+      continue;
+    }
+
+    collection.emplace_back(
+        std::make_shared<AbstractRefinement::refinement_key_type>(*(iter->first), iter->second),
+        functor(storage, iter->second));
+    std::push_heap(collection.begin(), collection.end(), AbstractRefinement::compare_pairs);
+
+    if (collection.size() > functor.getRefinementsNum()) {
+      std::pop_heap(collection.begin(), collection.end(), AbstractRefinement::compare_pairs);
+      collection.pop_back();
+    }
+  }
+
+  for (AbstractRefinement::refinement_pair_type& pair : collection) {
+    if (pair.second >= functor.getRefinementThreshold()) {
+      const size_t seq = pair.first->getSeq();
+      GridPoint point(storage[seq]);
+      storage[seq].setLeaf(false);
+
+      for (size_t d = 0; d < storage.getDimension(); d++) {
+        refinement.refineGridpoint1D(storage, point, d);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testIdenticalToSerialRefinement) {
+  const size_t dim = 4;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  std::unique_ptr<Grid> referenceGrid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+  referenceGrid->getGenerator().regular(4);
+
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> distribution(0, 9);
+
+#ifdef _OPENMP
+  const int oldNumThreads = omp_get_max_threads();
+  omp_set_num_threads(4);
+#endif
+
+  for (size_t step = 0; step < 4; step++) {
+    // few distinct values, such that the selection depends on the order of the ties
+    DataVector alpha(grid->getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = static_cast<double>(distribution(generator));
+    }
+
+    SurplusRefinementFunctor functor(alpha, 25);
+    HashRefinement refinement;
+    BOOST_CHECK_EQUAL(refinement.getNumberOfRefinablePoints(grid->getStorage()),
+                      refinement.getNumberOfRefinablePoints(referenceGrid->getStorage()));
+
+    std::vector<size_t> addedPoints;
+    refinement.free_refine(grid->getStorage(), functor, &addedPoints);
+    referenceRefine(referenceGrid->getStorage(), functor);
+
+    // same grid points with the same sequence numbers
+    GridStorage& storage = grid->getStorage();
+    GridStorage& referenceStorage = referenceGrid->getStorage();
+    BOOST_REQUIRE_EQUAL(storage.getSize(), referenceStorage.getSize());
+    BOOST_CHECK_EQUAL(addedPoints.size(), storage.getSize() - alpha.getSize());
+
+    for (size_t i = 0; i < storage.getSize(); i++) {
+      BOOST_CHECK(storage[i].equals(referenceStorage[i]));
+      BOOST_CHECK_EQUAL(storage[i].isLeaf(), referenceStorage[i].isLeaf());
+    }
+  }
+
+#ifdef _OPENMP
+  omp_set_num_threads(oldNumThreads);
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END()
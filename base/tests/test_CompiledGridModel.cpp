@@ -0,0 +1,187 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/exception/generation_exception.hpp>
+#include <sgpp/base/grid/CompiledGridModel.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/operation/hash/OperationEvalCompiledModel.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalCompiledModel.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using sgpp::base::BoundingBox1D;
+using sgpp::base::CompiledGridModel;
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+
+BOOST_AUTO_TEST_SUITE(TestCompiledGridModel)
+
+BOOST_AUTO_TEST_CASE(testEvalAsGrid) {
+  const size_t dim = 3;
+  const size_t numberOfEvalPoints = 200;
+  const std::string fileName = "test_CompiledGridModel.bin";
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.push_back(std::unique_ptr<Grid>(Grid::createLinearGrid(dim)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModLinearGrid(dim)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createPolyGrid(dim, 3)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModPolyGrid(dim, 4)));
+
+  DataMatrix points(numberOfEvalPoints, dim);
+
+  for (size_t i = 0; i < numberOfEvalPoints; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      points(i, d) = distribution(generator);
+    }
+  }
+
+  // points on the boundary and on the borders of the hierarchical cells
+  points(0, 0) = 1.0;
+  points(1, 1) = 0.0;
+  points(2, 2) = 0.5;
+
+  for (std::unique_ptr<Grid>& grid : grids) {
+    grid->getGenerator().regular(4);
+
+    // adaptive grid, such that not all subspaces are full
+    DataVector alpha(grid->getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = distribution(generator) - 0.5;
+    }
+
+    sgpp::base::SurplusRefinementFunctor functor(alpha, 5);
+    grid->getGenerator().refine(functor);
+    alpha.resize(grid->getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = distribution(generator) - 0.5;
+    }
+
+    CompiledGridModel::compile(*grid, alpha, fileName);
+    CompiledGridModel model(fileName, true);
+    BOOST_CHECK_EQUAL(model.getDimension(), dim);
+    BOOST_CHECK_EQUAL(model.getSize(), grid->getSize());
+    BOOST_CHECK(model.getGridDescription().getType() == grid->getType());
+    BOOST_CHECK_EQUAL(model.getGridDescription().getSize(), 0);
+
+    DataVector coefficients = model.getCoefficients();
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      BOOST_CHECK_EQUAL(coefficients[i], alpha[i]);
+    }
+
+    std::unique_ptr<sgpp::base::OperationEval> opEval(sgpp::op_factory::createOperationEval(*grid));
+    sgpp::base::OperationEvalCompiledModel opEvalModel(model);
+    DataVector point(dim);
+    DataVector noAlpha;
+
+    for (size_t i = 0; i < numberOfEvalPoints; i++) {
+      points.getRow(i, point);
+      const double value = opEval->eval(alpha, point);
+      BOOST_CHECK_CLOSE(model.eval(point), value, 1e-10);
+      BOOST_CHECK_CLOSE(opEvalModel.eval(noAlpha, point), value, 1e-10);
+      BOOST_CHECK_CLOSE(opEvalModel.eval(alpha, point), value, 1e-10);
+    }
+
+    std::unique_ptr<sgpp::base::OperationMultipleEval> opMultipleEval(
+        sgpp::op_factory::createOperationMultipleEval(*grid, points));
+    sgpp::base::OperationMultipleEvalCompiledModel opMultipleEvalModel(model, points);
+
+    DataVector result(numberOfEvalPoints);
+    DataVector resultModel(numberOfEvalPoints);
+    opMultipleEval->mult(alpha, result);
+    opMultipleEvalModel.mult(noAlpha, resultModel);
+
+    for (size_t i = 0; i < numberOfEvalPoints; i++) {
+      BOOST_CHECK_CLOSE(resultModel[i], result[i], 1e-10);
+    }
+
+    DataVector source(numberOfEvalPoints);
+
+    for (size_t i = 0; i < numberOfEvalPoints; i++) {
+      source[i] = distribution(generator);
+    }
+
+    DataVector resultTranspose(grid->getSize());
+    DataVector resultTransposeModel(grid->getSize());
+    opMultipleEval->multTranspose(source, resultTranspose);
+    opMultipleEvalModel.multTranspose(source, resultTransposeModel);
+
+    for (size_t i = 0; i < grid->getSize(); i++) {
+      BOOST_CHECK_SMALL(resultTransposeModel[i] - resultTranspose[i], 1e-12);
+    }
+  }
+
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testBoundingBoxAndErrors) {
+  const size_t dim = 2;
+  const std::string fileName = "test_CompiledGridModel.bin";
+
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getStorage().getBoundingBox()->setBoundary(0, BoundingBox1D(-1.0, 3.0));
+  grid->getStorage().getBoundingBox()->setBoundary(1, BoundingBox1D(2.0, 2.5));
+  grid->getGenerator().regular(5);
+
+  DataVector alpha(grid->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = static_cast<double>(i % 7) - 3.0;
+  }
+
+  CompiledGridModel::compile(*grid, alpha, fileName);
+  CompiledGridModel model(fileName);
+
+  // the points are given in the bounding box, as for the operations of the grid
+  std::unique_ptr<sgpp::base::OperationEval> opEval(sgpp::op_factory::createOperationEval(*grid));
+  DataVector point(dim);
+
+  for (double x : {0.1, 0.37, 0.5, 0.93}) {
+    for (double y : {0.0, 0.25, 0.61, 1.0}) {
+      point[0] = -1.0 + 4.0 * x;
+      point[1] = 2.0 + 0.5 * y;
+      BOOST_CHECK_CLOSE(model.eval(point), opEval->eval(alpha, point), 1e-10);
+    }
+  }
+
+  // corrupted files are rejected
+  {
+    std::fstream file(fileName, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(20);
+    file.put('x');
+  }
+
+  BOOST_CHECK_THROW(CompiledGridModel model(fileName), sgpp::base::generation_exception);
+  std::remove(fileName.c_str());
+
+  // grid types whose basis functions are not supported on the hierarchical cells
+  std::unique_ptr<Grid> boundaryGrid(Grid::createLinearBoundaryGrid(dim));
+  boundaryGrid->getGenerator().regular(2);
+  DataVector boundaryAlpha(boundaryGrid->getSize());
+  BOOST_CHECK_THROW(CompiledGridModel::compile(*boundaryGrid, boundaryAlpha, fileName),
+                    sgpp::base::factory_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
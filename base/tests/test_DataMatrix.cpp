@@ -8,9 +8,11 @@
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/MemoryArena.hpp>
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
@@ -444,4 +446,83 @@ BOOST_AUTO_TEST_CASE(resizeToSubMatrixTests) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(alignmentTest) {
+  for (size_t nrows = 1; nrows < 20; nrows += 3) {
+    DataMatrix m(nrows, 3, 1.0);
+    BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(m.data()) % 64, 0);
+    m.appendRow();
+    BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(m.data()) % 64, 0);
+
+    DataVector v(nrows * 5, 2.0);
+    BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(v.data()) % 64, 0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(hugePageArenaTest) {
+  sgpp::base::HugePageMemoryArena arena;
+  sgpp::base::MemoryArena::setLargeAllocationArena(&arena, 1 << 20);
+
+  DataMatrix large(1000, 200, 1.5);
+  DataMatrix small(10, 20, 2.5);
+  BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(large.data()) % 64, 0);
+  BOOST_CHECK_EQUAL(large.sum(), 1.5 * 1000 * 200);
+
+  // memory from the arena may outlive the arena setting
+  sgpp::base::MemoryArena::setLargeAllocationArena(nullptr, 0);
+  DataMatrix copy(large);
+  large.resize(5, 200);
+  BOOST_CHECK_EQUAL(copy.sum(), 1.5 * 1000 * 200);
+  BOOST_CHECK_EQUAL(small.sum(), 2.5 * 10 * 20);
+}
+
+BOOST_AUTO_TEST_CASE(viewTest) {
+  DataMatrix m(4, 3);
+
+  for (size_t i = 0; i < 4; i++) {
+    for (size_t j = 0; j < 3; j++) {
+      m.set(i, j, static_cast<double>(10 * i + j));
+    }
+  }
+
+  // rows are contiguous and alias the matrix
+  sgpp::base::DataVectorView row = m.getRowView(2);
+  BOOST_CHECK(row.isContiguous());
+  BOOST_CHECK_EQUAL(row.getSize(), 3);
+  BOOST_CHECK_EQUAL(row[1], 21.0);
+  row.set(0, -1.0);
+  BOOST_CHECK_EQUAL(m.get(2, 0), -1.0);
+
+  // columns are strided
+  sgpp::base::ConstDataVectorView col = static_cast<const DataMatrix&>(m).getColumnView(1);
+  BOOST_CHECK_EQUAL(col.getSize(), 4);
+  BOOST_CHECK_EQUAL(col.getStride(), 3);
+
+  for (size_t i = 0; i < 4; i++) {
+    BOOST_CHECK_EQUAL(col[i], static_cast<double>(10 * i + 1));
+  }
+
+  // block of rows and submatrix copy
+  sgpp::base::ConstDataMatrixView block = m.getView().getRows(1, 2);
+  BOOST_CHECK_EQUAL(block.getNrows(), 2);
+  BOOST_CHECK_EQUAL(block.get(1, 2), 22.0);
+  BOOST_CHECK_THROW(m.getView().getRows(3, 2), sgpp::base::data_exception);
+  DataMatrix blockCopy(block);
+  BOOST_CHECK_EQUAL(blockCopy.getNrows(), 2);
+  BOOST_CHECK_EQUAL(blockCopy.get(0, 1), 11.0);
+
+  // setting a row from a row of another matrix
+  DataMatrix other(2, 3, 0.0);
+  other.setRow(1, m.getRowView(3));
+  BOOST_CHECK_EQUAL(other.get(1, 2), 32.0);
+  BOOST_CHECK_THROW(other.setRow(0, m.getColumnView(0)), sgpp::base::data_exception);
+
+  // views of external buffers with padded rows
+  double buffer[] = {1.0, 2.0, 0.0, 3.0, 4.0, 0.0};
+  sgpp::base::ConstDataMatrixView padded(buffer, 2, 2, 3);
+  BOOST_CHECK(!padded.isContiguous());
+  DataMatrix unpadded(padded);
+  BOOST_CHECK_EQUAL(unpadded.get(1, 0), 3.0);
+  BOOST_CHECK_EQUAL(unpadded.get(1, 1), 4.0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -7,11 +7,15 @@
 #include <boost/test/unit_test.hpp>
 
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataVectorView.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
 
 #include <algorithm>
 #include <cmath>
 
+using sgpp::base::ConstDataVectorView;
 using sgpp::base::DataVector;
+using sgpp::base::DataVectorView;
 
 struct FixtureDataVector {
   FixtureDataVector() : nrows(5), ncols(3), N(nrows * ncols), d_rand(N), min(0), max(0), sum(0) {
@@ -252,4 +256,120 @@ BOOST_AUTO_TEST_CASE(testDotProduct) {
   BOOST_CHECK_EQUAL(d.dotProduct(d), x);
 }
 
+BOOST_AUTO_TEST_CASE(testFusedOps) {
+  // short vectors and vectors that are long enough to be processed in parallel
+  for (size_t n : {static_cast<size_t>(N), static_cast<size_t>(100003)}) {
+    DataVector x(n);
+    DataVector y(n);
+    DataVector z(n);
+
+    for (size_t i = 0; i < n; ++i) {
+      x[i] = std::sin(static_cast<double>(i));
+      y[i] = std::cos(0.5 * static_cast<double>(i));
+      z[i] = static_cast<double>(i % 7) - 3.0;
+    }
+
+    const double a = 0.213;
+    const double b = -1.7;
+    const double tol = 1e-10;
+
+    // axpyDot
+    DataVector d(x);
+    DataVector dReference(x);
+    const double squaredNorm = d.axpyDot(a, y);
+    dReference.axpy(a, y);
+
+    for (size_t i = 0; i < n; ++i) {
+      BOOST_CHECK_EQUAL(d[i], dReference[i]);
+    }
+
+    BOOST_CHECK_CLOSE(squaredNorm, dReference.dotProduct(dReference), tol);
+
+    // axpy with two vectors
+    d = x;
+    d.axpy(a, y, b, z);
+
+    for (size_t i = 0; i < n; ++i) {
+      BOOST_CHECK_SMALL(d[i] - (x[i] + a * y[i] + b * z[i]), 1e-14);
+    }
+
+    // xpay
+    d = x;
+    d.xpay(b, y);
+
+    for (size_t i = 0; i < n; ++i) {
+      BOOST_CHECK_SMALL(d[i] - (y[i] + b * x[i]), 1e-14);
+    }
+
+    // dotProductWithNorm
+    double xx = 0.0;
+    const double xy = x.dotProductWithNorm(y, xx);
+    double xyExact = 0.0;
+    double xxExact = 0.0;
+
+    for (size_t i = 0; i < n; ++i) {
+      xyExact += x[i] * y[i];
+      xxExact += x[i] * x[i];
+    }
+
+    BOOST_CHECK_CLOSE(xy, xyExact, tol);
+    BOOST_CHECK_CLOSE(xx, xxExact, tol);
+    BOOST_CHECK_CLOSE(x.dotProduct(y), xyExact, tol);
+    BOOST_CHECK_CLOSE(x.l2Norm(), std::sqrt(xxExact), tol);
+
+    // element-wise operations
+    d = x;
+    d.sub(y);
+    d.mult(b);
+    d.add(z);
+
+    for (size_t i = 0; i < n; ++i) {
+      BOOST_CHECK_SMALL(d[i] - ((x[i] - y[i]) * b + z[i]), 1e-14);
+    }
+  }
+
+  DataVector shortVector(3);
+  BOOST_CHECK_THROW(d_rand.xpay(1.0, shortVector), sgpp::base::data_exception);
+  BOOST_CHECK_THROW(d_rand.axpyDot(1.0, shortVector), sgpp::base::data_exception);
+}
+
+BOOST_AUTO_TEST_CASE(testView) {
+  DataVectorView view = d_rand.getView();
+  BOOST_CHECK_EQUAL(view.getSize(), d_rand.getSize());
+  BOOST_CHECK_EQUAL(view.getPointer(), d_rand.getPointer());
+  BOOST_CHECK(view.isContiguous());
+  BOOST_CHECK_CLOSE(view.sum(), sum, 1e-12);
+
+  // writing through the view changes the vector
+  view.set(2, 42.0);
+  BOOST_CHECK_EQUAL(d_rand[2], 42.0);
+
+  // strided slice over every third element
+  DataVectorView strided(d_rand.getPointer() + 1, N / 3, 3);
+  BOOST_CHECK(!strided.isContiguous());
+
+  for (size_t i = 0; i < strided.getSize(); i++) {
+    BOOST_CHECK_EQUAL(strided[i], d_rand[3 * i + 1]);
+  }
+
+  ConstDataVectorView slice = strided.getSlice(1, 2);
+  BOOST_CHECK_EQUAL(slice.getSize(), 2);
+  BOOST_CHECK_EQUAL(slice[1], d_rand[7]);
+  BOOST_CHECK_THROW(strided.getSlice(1, N), sgpp::base::data_exception);
+
+  // copying a view yields an owning vector
+  DataVector copy(slice);
+  BOOST_CHECK_EQUAL(copy.getSize(), 2);
+  BOOST_CHECK_EQUAL(copy[0], d_rand[4]);
+  BOOST_CHECK_EQUAL(copy[1], d_rand[7]);
+
+  // vectors convert implicitly to views
+  const DataVector& constRef = d_rand;
+  ConstDataVectorView constView = constRef;
+  BOOST_CHECK_CLOSE(constView.dotProduct(d_rand), d_rand.dotProduct(d_rand), 1e-12);
+
+  view.setAll(1.0);
+  BOOST_CHECK_EQUAL(d_rand.sum(), static_cast<double>(N));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
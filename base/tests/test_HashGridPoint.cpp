@@ -7,6 +7,8 @@
 #include <boost/test/unit_test.hpp>
 #include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
 
+#include <cstddef>
+
 using sgpp::base::HashGridPoint;
 
 BOOST_AUTO_TEST_SUITE(TestSHashGridPoint)
@@ -34,4 +36,50 @@ BOOST_AUTO_TEST_CASE(testAssign) {
   BOOST_CHECK_EQUAL(s.getIndex(1), s2.getIndex(1));
 }
 
+BOOST_AUTO_TEST_CASE(testIncrementalHash) {
+  for (size_t dim = 1; dim <= 20; dim++) {
+    HashGridPoint s(dim);
+
+    for (size_t k = 0; k < 100; k++) {
+      const size_t d = (7 * k + 3) % dim;
+      const HashGridPoint::level_type l = static_cast<HashGridPoint::level_type>(k % 12);
+      const HashGridPoint::index_type i = static_cast<HashGridPoint::index_type>(
+          (k % 2 == 0) ? 1 : (k * 13) % (static_cast<size_t>(1) << l) | 1);
+
+      if (k % 3 == 0) {
+        s.push(d, l, i);
+      } else {
+        s.set(d, l, i);
+      }
+
+      HashGridPoint s2(s);
+      s2.rehash();
+      BOOST_CHECK_EQUAL(s.getHash(), s2.getHash());
+      BOOST_CHECK(s.equals(s2));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testEquals) {
+  HashGridPoint s(3);
+  s.set(0, 1, 1);
+  s.set(1, 2, 3);
+  s.set(2, 3, 5);
+
+  HashGridPoint s2(s);
+  BOOST_CHECK(s.equals(s2));
+
+  s2.set(2, 3, 7);
+  BOOST_CHECK(!s.equals(s2));
+
+  s2.set(2, 3, 5);
+  BOOST_CHECK(s.equals(s2));
+  BOOST_CHECK_EQUAL(s.getHash(), s2.getHash());
+
+  HashGridPoint s3(2);
+  s3.set(0, 1, 1);
+  s3.set(1, 2, 3);
+  BOOST_CHECK(!s.equals(s3));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -7,17 +7,31 @@
 #include <boost/test/unit_test.hpp>
 
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/generation_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/grid/generation/hashmap/HashGenerator.hpp>
 #include <sgpp/base/grid/generation/hashmap/HashRefinement.hpp>
 #include <sgpp/base/grid/generation/hashmap/HashRefinementBoundaries.hpp>
 #include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
 #include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
-
+#include <sgpp/base/grid/type/ModPolyGrid.hpp>
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 
+using sgpp::base::BoundingBox;
+using sgpp::base::BoundingBox1D;
 using sgpp::base::DataVector;
+using sgpp::base::Grid;
 using sgpp::base::HashGenerator;
 using sgpp::base::HashGridPoint;
 using sgpp::base::HashGridStorage;
@@ -89,6 +103,197 @@ BOOST_AUTO_TEST_CASE(testSerializeWithLeaf) {
   delete[] srcLeaf;
 }
 
+void checkEqualStorages(HashGridStorage& s, HashGridStorage& s2) {
+  BOOST_REQUIRE_EQUAL(s.getSize(), s2.getSize());
+  BOOST_REQUIRE_EQUAL(s.getDimension(), s2.getDimension());
+
+  for (size_t i = 0; i < s.getSize(); i++) {
+    BOOST_CHECK(s.getPoint(i).equals(s2.getPoint(i)));
+    BOOST_CHECK_EQUAL(s.getPoint(i).isLeaf(), s2.getPoint(i).isLeaf());
+    BOOST_CHECK_EQUAL(s2.getSequenceNumber(s.getPoint(i)), i);
+  }
+
+  for (size_t d = 0; d < s.getDimension(); d++) {
+    BOOST_CHECK_EQUAL(s.getBoundingBox()->getBoundary(d).leftBoundary,
+                      s2.getBoundingBox()->getBoundary(d).leftBoundary);
+    BOOST_CHECK_EQUAL(s.getBoundingBox()->getBoundary(d).rightBoundary,
+                      s2.getBoundingBox()->getBoundary(d).rightBoundary);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testSerializeBinary) {
+  BoundingBox boundingBox(3);
+  boundingBox.setBoundary(1, BoundingBox1D(-0.1, 1.0 / 3.0));
+  HashGridStorage s(boundingBox);
+  HashGenerator g;
+  g.regular(s, 4);
+
+  DataVector alpha(s.getSize());
+  DataVector beta(s.getSize());
+
+  for (size_t i = 0; i < s.getSize(); i++) {
+    alpha[i] = 1.0 / static_cast<double>(i + 1);
+    beta[i] = -static_cast<double>(i);
+  }
+
+  std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+  s.serializeBinary(stream, std::vector<DataVector>{alpha, beta});
+
+  // the binary format is recognized by the constructors, the coefficients are skipped
+  HashGridStorage s2(stream);
+  checkEqualStorages(s, s2);
+
+  // the storage can be extended after loading
+  HashGridPoint point(s2.getPoint(0));
+  point.set(0, 6, 1);
+  s2.insert(point);
+  BOOST_CHECK_EQUAL(s2.getSize(), s.getSize() + 1);
+  BOOST_CHECK(s2.isContaining(point));
+
+  // memory-mapped file with the coefficients
+  const std::string fileName = "testSerializeBinary.grid";
+  {
+    std::ofstream file(fileName, std::ios::binary);
+    s.serializeBinary(file, std::vector<DataVector>{alpha, beta});
+  }
+
+  HashGridStorage s3(1);
+  std::vector<DataVector> coefficients;
+  s3.mapBinaryFile(fileName, &coefficients);
+  checkEqualStorages(s, s3);
+  BOOST_REQUIRE_EQUAL(coefficients.size(), 2U);
+
+  for (size_t i = 0; i < s.getSize(); i++) {
+    BOOST_CHECK_EQUAL(coefficients[0][i], alpha[i]);
+    BOOST_CHECK_EQUAL(coefficients[1][i], beta[i]);
+  }
+
+  // the text format is still supported
+  std::string str = s.serialize();
+  HashGridStorage s4(str);
+  BOOST_CHECK_EQUAL(s4.getSize(), s.getSize());
+
+  // corrupted grid points are detected by the checksum
+  std::string binary = stream.str();
+  binary[binary.size() - 2 * s.getSize() * sizeof(double) - 20] ^= 1;
+  {
+    std::ofstream file(fileName, std::ios::binary);
+    file << binary;
+  }
+  std::istringstream corruptStream(binary);
+  BOOST_CHECK_THROW(HashGridStorage s5(corruptStream), sgpp::base::generation_exception);
+  BOOST_CHECK_THROW(s3.mapBinaryFile(fileName), sgpp::base::generation_exception);
+
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testSerializeBinaryGrid) {
+  std::unique_ptr<Grid> grid(Grid::createModPolyGrid(2, 3));
+  grid->getGenerator().regular(3);
+
+  std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+  grid->serialize(stream, SERIALIZATION_VERSION_BINARY);
+  std::unique_ptr<Grid> grid2(Grid::unserialize(stream));
+
+  BOOST_CHECK(grid2->getType() == grid->getType());
+  BOOST_CHECK_EQUAL(dynamic_cast<sgpp::base::ModPolyGrid&>(*grid2).getDegree(), 3U);
+  checkEqualStorages(grid->getStorage(), grid2->getStorage());
+
+  // the grid file (starting with the grid type) can be mapped, too
+  const std::string fileName = "testSerializeBinaryGrid.grid";
+  {
+    std::ofstream file(fileName, std::ios::binary);
+    grid->serialize(file, SERIALIZATION_VERSION_BINARY);
+  }
+
+  std::unique_ptr<Grid> grid3(Grid::createModPolyGrid(2, 3));
+  grid3->getStorage().mapBinaryFile(fileName);
+  checkEqualStorages(grid->getStorage(), grid3->getStorage());
+
+  std::unique_ptr<Grid> grid4(Grid::unserializeFromFile(fileName));
+  checkEqualStorages(grid->getStorage(), grid4->getStorage());
+
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testSerializeBinaryCompact) {
+  HashGridStorage s(4);
+  HashGenerator g;
+  g.regular(s, 5);
+  DataVector alpha(s.getSize(), 0.5);
+
+  // levels and indices below 256 are stored with one byte each instead of four
+  std::stringstream compactStream(std::ios::in | std::ios::out | std::ios::binary);
+  std::stringstream wideStream(std::ios::in | std::ios::out | std::ios::binary);
+  s.serializeBinary(compactStream, std::vector<DataVector>{alpha});
+  s.serializeBinary(wideStream, std::vector<DataVector>{alpha}, false);
+  const std::string compact = compactStream.str();
+  const std::string wide = wideStream.str();
+  BOOST_CHECK_LE(compact.size() + 2 * 3 * 4 * s.getSize(), wide.size() + 8);
+
+  HashGridStorage s2(compactStream);
+  checkEqualStorages(s, s2);
+  HashGridStorage s3(wideStream);
+  checkEqualStorages(s, s3);
+
+  // both variants can be mapped (the wide one in place)
+  const std::string fileName = "testSerializeBinaryCompact.grid";
+
+  for (const std::string* binary : {&compact, &wide}) {
+    {
+      std::ofstream file(fileName, std::ios::binary);
+      file << *binary;
+    }
+
+    HashGridStorage s4(1);
+    std::vector<DataVector> coefficients;
+    s4.mapBinaryFile(fileName, &coefficients);
+    checkEqualStorages(s, s4);
+    BOOST_REQUIRE_EQUAL(coefficients.size(), 1U);
+    BOOST_CHECK_EQUAL(coefficients[0][s.getSize() - 1], 0.5);
+  }
+
+  // wider levels and indices
+  HashGridPoint point(s.getPoint(0));
+  point.set(0, 20, 1);
+  s.insert(point);
+  std::stringstream widerStream(std::ios::in | std::ios::out | std::ios::binary);
+  s.serializeBinary(widerStream);
+  HashGridStorage s5(widerStream);
+  checkEqualStorages(s, s5);
+
+  // truncated grids are rejected before the grid points are allocated
+  std::istringstream truncatedStream(compact.substr(0, compact.size() - 1));
+  BOOST_CHECK_THROW(HashGridStorage s6(truncatedStream), sgpp::base::generation_exception);
+
+  // a header with a valid checksum, but a huge number of grid points or dimension
+  const size_t numberOfPointsOffset = 32;
+  const size_t dimensionOffset = 24;
+  const size_t headerChecksumOffset = 80;
+
+  for (size_t offset : {numberOfPointsOffset, dimensionOffset}) {
+    for (uint64_t value : {static_cast<uint64_t>(1) << 40, static_cast<uint64_t>(-1) / 2}) {
+      std::string corrupt = compact;
+      std::memcpy(&corrupt[offset], &value, sizeof(value));
+      const uint64_t checksum =
+          sgpp::base::MemoryMappedFile::computeChecksum(corrupt.data(), headerChecksumOffset);
+      std::memcpy(&corrupt[headerChecksumOffset], &checksum, sizeof(checksum));
+
+      std::istringstream corruptStream(corrupt);
+      BOOST_CHECK_THROW(HashGridStorage s7(corruptStream), sgpp::base::generation_exception);
+
+      {
+        std::ofstream file(fileName, std::ios::binary);
+        file << corrupt;
+      }
+
+      BOOST_CHECK_THROW(s2.mapBinaryFile(fileName), sgpp::base::generation_exception);
+    }
+  }
+
+  std::remove(fileName.c_str());
+}
+
 BOOST_AUTO_TEST_CASE(testInsert) {
   HashGridPoint i(1);
   HashGridStorage s(1);
@@ -194,6 +399,53 @@ BOOST_AUTO_TEST_CASE(testSeq) {
   BOOST_CHECK(s.isInvalidSequenceNumber(seq));
 }
 
+BOOST_AUTO_TEST_CASE(testDeleteAndReinsert) {
+  HashGridStorage s(3);
+  HashGenerator g;
+
+  g.regular(s, 5);
+
+  const size_t size = s.getSize();
+  std::vector<HashGridPoint> points;
+
+  for (size_t k = 0; k < size; k++) {
+    points.push_back(s[k]);
+  }
+
+  // delete every other point
+  std::list<size_t> removePoints;
+
+  for (size_t k = 0; k < size; k += 2) {
+    removePoints.push_back(k);
+  }
+
+  s.deletePoints(removePoints);
+  BOOST_CHECK_EQUAL(s.getSize(), size / 2);
+
+  for (size_t k = 0; k < size; k++) {
+    BOOST_CHECK_EQUAL(s.isContaining(points[k]), k % 2 == 1);
+  }
+
+  // the memory of the deleted points is reused
+  for (size_t k = 0; k < size; k += 2) {
+    s.insert(points[k]);
+  }
+
+  BOOST_CHECK_EQUAL(s.getSize(), size);
+
+  for (size_t k = 0; k < size; k++) {
+    size_t seq = s.getSequenceNumber(points[k]);
+    BOOST_CHECK(!s.isInvalidSequenceNumber(seq));
+    BOOST_CHECK(s[seq].equals(points[k]));
+  }
+
+  // copies own their grid points
+  HashGridStorage s2(s);
+  s.clear();
+  BOOST_CHECK_EQUAL(s2.getSize(), size);
+  BOOST_CHECK(s2.isContaining(points[0]));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(TestHashGridStorageWithT)
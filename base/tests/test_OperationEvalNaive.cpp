@@ -19,6 +19,14 @@
 #include <sgpp/base/operation/hash/common/basis/PolyClenshawCurtisBasis.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationEvalBsplineNaive.hpp>
+#include <sgpp/base/operation/hash/OperationEvalLinearNaive.hpp>
+#include <sgpp/base/operation/hash/OperationEvalModBsplineNaive.hpp>
+#include <sgpp/base/operation/hash/OperationEvalModLinearNaive.hpp>
+#include <sgpp/base/operation/hash/OperationEvalModPolyNaive.hpp>
+#include <sgpp/base/operation/hash/OperationEvalPolyNaive.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 
 #include <vector>
 #include <random>
@@ -506,3 +514,213 @@ BOOST_AUTO_TEST_CASE(TestOperationEvalNaive) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestOperationEvalFixedDimensionNaive) {
+  const size_t p = 3;
+  const size_t m = 2;
+  const size_t N = 10;
+
+  std::mt19937 generator;
+  generator.seed(42);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+  std::normal_distribution<double> normalDistribution(0.0, 1.0);
+
+  for (size_t d : {1, 4, 12, 13}) {
+    std::vector<std::unique_ptr<Grid>> grids;
+    grids.push_back(std::unique_ptr<Grid>(Grid::createLinearGrid(d)));
+    grids.push_back(std::unique_ptr<Grid>(Grid::createModLinearGrid(d)));
+    grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineGrid(d, p)));
+    grids.push_back(std::unique_ptr<Grid>(Grid::createModBsplineGrid(d, p)));
+    grids.push_back(std::unique_ptr<Grid>(Grid::createPolyGrid(d, p)));
+    grids.push_back(std::unique_ptr<Grid>(Grid::createModPolyGrid(d, p)));
+
+    // reference operations with runtime dimensionality
+    std::vector<std::unique_ptr<OperationEval>> opsReference;
+    opsReference.push_back(std::unique_ptr<OperationEval>(
+        new sgpp::base::OperationEvalLinearNaive(grids[0]->getStorage())));
+    opsReference.push_back(std::unique_ptr<OperationEval>(
+        new sgpp::base::OperationEvalModLinearNaive(grids[1]->getStorage())));
+    opsReference.push_back(std::unique_ptr<OperationEval>(
+        new sgpp::base::OperationEvalBsplineNaive(grids[2]->getStorage(), p)));
+    opsReference.push_back(std::unique_ptr<OperationEval>(
+        new sgpp::base::OperationEvalModBsplineNaive(grids[3]->getStorage(), p)));
+    opsReference.push_back(std::unique_ptr<OperationEval>(
+        new sgpp::base::OperationEvalPolyNaive(grids[4]->getStorage(), p)));
+    opsReference.push_back(std::unique_ptr<OperationEval>(
+        new sgpp::base::OperationEvalModPolyNaive(grids[5]->getStorage(), p)));
+
+    for (size_t k = 0; k < grids.size(); k++) {
+      Grid& grid = *grids[k];
+      grid.getGenerator().regular((d <= 4) ? 4 : 2);
+      const size_t n = grid.getSize();
+
+      BoundingBox& boundingBox = grid.getBoundingBox();
+
+      for (size_t t = 0; t < d; t++) {
+        const double left = normalDistribution(generator);
+        boundingBox.setBoundary(t, BoundingBox1D(left, left + 1.5));
+      }
+
+      if (d > 12) {
+        BOOST_CHECK_THROW(sgpp::op_factory::createOperationEvalFixedDimensionNaive(grid),
+                          sgpp::base::factory_exception);
+        continue;
+      }
+
+      std::unique_ptr<OperationEval> opEval(
+          sgpp::op_factory::createOperationEvalFixedDimensionNaive(grid));
+
+      DataVector alpha(n);
+      DataMatrix alphaMatrix(n, m);
+
+      for (size_t i = 0; i < n; i++) {
+        alpha[i] = normalDistribution(generator);
+
+        for (size_t j = 0; j < m; j++) {
+          alphaMatrix(i, j) = normalDistribution(generator);
+        }
+      }
+
+      DataVector y(d);
+      DataVector value, valueReference;
+
+      for (size_t r = 0; r < N; r++) {
+        for (size_t t = 0; t < d; t++) {
+          y[t] = boundingBox.getIntervalOffset(t) +
+                 boundingBox.getIntervalWidth(t) * uniformDistribution(generator);
+        }
+
+        // the factors are multiplied in the same order, so the results must be identical
+        BOOST_CHECK_EQUAL(opEval->eval(alpha, y), opsReference[k]->eval(alpha, y));
+
+        opEval->eval(alphaMatrix, y, value);
+        opsReference[k]->eval(alphaMatrix, y, valueReference);
+        BOOST_CHECK_EQUAL(value.getSize(), m);
+
+        for (size_t j = 0; j < m; j++) {
+          BOOST_CHECK_EQUAL(value[j], valueReference[j]);
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestOperationEvalHierarchicalDescent) {
+  const size_t m = 2;
+  const size_t N = 10;
+
+  std::mt19937 generator;
+  generator.seed(42);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+  std::normal_distribution<double> normalDistribution(0.0, 1.0);
+
+  for (size_t p : {1, 3, 5}) {
+    for (size_t d : {1, 2, 4}) {
+      std::vector<std::unique_ptr<Grid>> grids;
+      grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineGrid(d, p)));
+      grids.push_back(std::unique_ptr<Grid>(Grid::createModBsplineGrid(d, p)));
+
+      for (std::unique_ptr<Grid>& gridPtr : grids) {
+        Grid& grid = *gridPtr;
+        grid.getGenerator().regular((d <= 2) ? 4 : 3);
+
+        // make the grid spatially adaptive
+        for (size_t q = 0; q < 2; q++) {
+          DataVector surpluses(grid.getSize());
+
+          for (size_t i = 0; i < grid.getSize(); i++) {
+            surpluses[i] = uniformDistribution(generator);
+          }
+
+          sgpp::base::SurplusRefinementFunctor functor(surpluses, 3);
+          grid.getGenerator().refine(functor);
+        }
+
+        const size_t n = grid.getSize();
+        BoundingBox& boundingBox = grid.getBoundingBox();
+
+        for (size_t t = 0; t < d; t++) {
+          const double left = normalDistribution(generator);
+          boundingBox.setBoundary(t, BoundingBox1D(left, left + 1.5));
+        }
+
+        std::unique_ptr<OperationEval> opEval(sgpp::op_factory::createOperationEval(grid));
+        std::unique_ptr<OperationEvalGradient> opEvalGradient(
+            sgpp::op_factory::createOperationEvalGradient(grid));
+        std::unique_ptr<OperationEvalHessian> opEvalHessian(
+            sgpp::op_factory::createOperationEvalHessian(grid));
+        std::unique_ptr<OperationEvalHessian> opEvalHessianNaive(
+            sgpp::op_factory::createOperationEvalHessianNaive(grid));
+
+        DataVector alpha(n);
+        DataMatrix alphaMatrix(n, m);
+
+        for (size_t i = 0; i < n; i++) {
+          alpha[i] = normalDistribution(generator);
+
+          for (size_t j = 0; j < m; j++) {
+            alphaMatrix(i, j) = normalDistribution(generator);
+          }
+        }
+
+        DataVector y(d);
+
+        for (size_t r = 0; r < N; r++) {
+          for (size_t t = 0; t < d; t++) {
+            y[t] = boundingBox.getIntervalOffset(t) +
+                   boundingBox.getIntervalWidth(t) * uniformDistribution(generator);
+          }
+
+          DataVector gradientReference;
+          DataMatrix hessianReference;
+          const double fxReference =
+              opEvalHessianNaive->evalHessian(alpha, y, gradientReference, hessianReference);
+
+          checkClose(opEval->eval(alpha, y), fxReference);
+
+          DataVector gradient;
+          checkClose(opEvalGradient->evalGradient(alpha, y, gradient), fxReference);
+          checkClose(gradient, gradientReference);
+
+          DataMatrix hessian;
+          checkClose(opEvalHessian->evalHessian(alpha, y, gradient, hessian), fxReference);
+          checkClose(gradient, gradientReference);
+          checkClose(hessian, hessianReference);
+
+          // vectorial evaluation
+          DataVector valueReference;
+          DataMatrix jacobianReference;
+          std::vector<DataMatrix> hessiansReference;
+          opEvalHessianNaive->evalHessian(alphaMatrix, y, valueReference, jacobianReference,
+                                          hessiansReference);
+
+          DataVector value;
+          opEval->eval(alphaMatrix, y, value);
+          checkClose(value, valueReference);
+
+          DataMatrix jacobian;
+          opEvalGradient->evalGradient(alphaMatrix, y, value, jacobian);
+          checkClose(value, valueReference);
+          checkClose(jacobian, jacobianReference);
+
+          std::vector<DataMatrix> hessians;
+          opEvalHessian->evalHessian(alphaMatrix, y, value, jacobian, hessians);
+          checkClose(value, valueReference);
+          checkClose(jacobian, jacobianReference);
+          BOOST_CHECK_EQUAL(hessians.size(), m);
+
+          for (size_t j = 0; j < m; j++) {
+            checkClose(hessians[j], hessiansReference[j]);
+          }
+        }
+      }
+    }
+  }
+
+  // other grid types are not supported
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(2));
+  BOOST_CHECK_THROW(sgpp::op_factory::createOperationEvalGradient(*grid),
+                    sgpp::base::factory_exception);
+  BOOST_CHECK_THROW(sgpp::op_factory::createOperationEvalHessian(*grid),
+                    sgpp::base::factory_exception);
+}
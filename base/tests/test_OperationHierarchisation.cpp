@@ -9,8 +9,13 @@
 
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <vector>
 
 using sgpp::base::DataVector;
@@ -338,4 +343,112 @@ BOOST_AUTO_TEST_CASE(testHierarchisationStretchedTruncatedBoundary3D) {
   testHierarchisationDehierarchisation(*grid, level, &parabolaBoundary, 1e-12, false);
 }
 
+BOOST_AUTO_TEST_CASE(testHierarchisationAdaptiveAndDeep) {
+  // adaptive grids have incomplete poles, and deep poles are processed recursively
+  // by the batched (de)hierarchisation functors
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.push_back(std::unique_ptr<Grid>(Grid::createLinearGrid(3)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModLinearGrid(3)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createLinearGrid(1)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModLinearGrid(1)));
+
+  for (auto& grid : grids) {
+    GridStorage& gridStore = grid->getStorage();
+    const size_t dim = gridStore.getDimension();
+    DataVector coords(dim);
+
+    if (dim == 1) {
+      grid->getGenerator().regular(14);
+    } else {
+      grid->getGenerator().regular(3);
+
+      for (size_t k = 0; k < 5; k++) {
+        DataVector surpluses(gridStore.getSize());
+
+        for (size_t n = 0; n < gridStore.getSize(); n++) {
+          gridStore.getCoordinates(gridStore[n], coords);
+          surpluses[n] = (coords[0] < 0.3) ? 1.0 : 0.0;
+        }
+
+        sgpp::base::SurplusRefinementFunctor functor(surpluses, 10);
+        grid->getGenerator().refine(functor);
+      }
+    }
+
+    DataVector nodeValues(gridStore.getSize());
+
+    for (size_t n = 0; n < gridStore.getSize(); n++) {
+      gridStore.getCoordinates(gridStore[n], coords);
+      nodeValues[n] = parabolaBoundary(coords);
+    }
+
+    std::unique_ptr<OperationHierarchisation> hierarchisation(
+        sgpp::op_factory::createOperationHierarchisation(*grid));
+    std::unique_ptr<OperationEval> op(sgpp::op_factory::createOperationEvalNaive(*grid));
+
+    DataVector alpha(nodeValues);
+    hierarchisation->doHierarchisation(alpha);
+
+    for (size_t n = 0; n < gridStore.getSize(); n++) {
+      gridStore.getCoordinates(gridStore[n], coords);
+      BOOST_CHECK_CLOSE(op->eval(alpha, coords), nodeValues[n], 1e-10);
+    }
+
+    hierarchisation->doDehierarchisation(alpha);
+
+    for (size_t n = 0; n < gridStore.getSize(); n++) {
+      BOOST_CHECK_CLOSE(alpha[n], nodeValues[n], 1e-10);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testHierarchisationParallelSweep) {
+#ifdef _OPENMP
+  // the grids are large enough for the poles of the sweeps to be processed in parallel
+  const int oldNumThreads = omp_get_max_threads();
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.push_back(std::unique_ptr<Grid>(Grid::createLinearGrid(4)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModLinearGrid(4)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createLinearBoundaryGrid(4)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createPolyGrid(4, 3)));
+
+  for (auto& grid : grids) {
+    grid->getGenerator().regular(7);
+    GridStorage& gridStore = grid->getStorage();
+    BOOST_CHECK_GT(gridStore.getSize(), 4096);
+
+    DataVector coords(gridStore.getDimension());
+    DataVector nodeValues(gridStore.getSize());
+
+    for (size_t n = 0; n < gridStore.getSize(); n++) {
+      gridStore.getCoordinates(gridStore[n], coords);
+      nodeValues[n] = parabolaBoundary(coords);
+    }
+
+    std::unique_ptr<OperationHierarchisation> hierarchisation(
+        sgpp::op_factory::createOperationHierarchisation(*grid));
+
+    DataVector alphaSequential(nodeValues);
+    omp_set_num_threads(1);
+    hierarchisation->doHierarchisation(alphaSequential);
+
+    DataVector alphaParallel(nodeValues);
+    omp_set_num_threads(4);
+    hierarchisation->doHierarchisation(alphaParallel);
+
+    for (size_t n = 0; n < gridStore.getSize(); n++) {
+      BOOST_CHECK_EQUAL(alphaSequential[n], alphaParallel[n]);
+    }
+
+    hierarchisation->doDehierarchisation(alphaParallel);
+
+    for (size_t n = 0; n < gridStore.getSize(); n++) {
+      BOOST_CHECK_CLOSE(alphaParallel[n], nodeValues[n], 1e-10);
+    }
+  }
+
+  omp_set_num_threads(oldNumThreads);
+#endif
+}
+
 BOOST_AUTO_TEST_SUITE_END()
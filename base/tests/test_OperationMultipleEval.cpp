@@ -11,12 +11,17 @@
 #include <sgpp/base/grid/Grid.hpp>
 // #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalBatched.hpp>
+
+#include <random>
+#include <vector>
 
 using sgpp::base::BoundingBox1D;
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::base::Grid;
 using sgpp::base::GridStorage;
+using sgpp::base::OperationEval;
 using sgpp::base::OperationMultipleEval;
 
 BOOST_AUTO_TEST_SUITE(TestOperationMultipleEval)
@@ -78,4 +83,98 @@ BOOST_AUTO_TEST_CASE(testOperationMultipleEval) {
   BOOST_CHECK_CLOSE(result[2], result_ref[2], 1e-7);
 }
 
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalBatched) {
+  const size_t dim = 3;
+  const size_t p = 3;
+  const size_t numberDataPoints = 150;
+
+  std::mt19937 generator;
+  generator.seed(42);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+  std::normal_distribution<double> normalDistribution(0.0, 1.0);
+
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineGrid(dim, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineBoundaryGrid(dim, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModBsplineGrid(dim, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createNakBsplineGrid(dim, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModNakBsplineGrid(dim, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createFundamentalSplineGrid(dim, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModFundamentalSplineGrid(dim, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createWaveletGrid(dim)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createPolyClenshawCurtisGrid(dim, p)));
+
+  for (std::unique_ptr<Grid>& grid : grids) {
+    grid->getGenerator().regular(3);
+
+    for (size_t t = 0; t < dim; t++) {
+      const double left = normalDistribution(generator);
+      grid->getBoundingBox().setBoundary(t, BoundingBox1D(left, left + 2.0));
+    }
+
+    const size_t N = grid->getSize();
+    DataVector alpha(N);
+
+    for (size_t i = 0; i < N; i++) {
+      alpha[i] = normalDistribution(generator);
+    }
+
+    DataMatrix dataset(numberDataPoints, dim);
+
+    for (size_t j = 0; j < numberDataPoints; j++) {
+      for (size_t t = 0; t < dim; t++) {
+        dataset(j, t) = grid->getBoundingBox().getIntervalOffset(t) +
+                        2.0 * uniformDistribution(generator);
+      }
+    }
+
+    DataVector source(numberDataPoints);
+
+    for (size_t j = 0; j < numberDataPoints; j++) {
+      source[j] = normalDistribution(generator);
+    }
+
+    // reference: evaluate each basis function at each point
+    std::unique_ptr<OperationEval> opEval(sgpp::op_factory::createOperationEvalNaive(*grid));
+    DataVector resultReference(numberDataPoints);
+    DataVector resultTransposedReference(N, 0.0);
+    DataVector unitVector(N, 0.0);
+
+    for (size_t j = 0; j < numberDataPoints; j++) {
+      DataVector point(dim);
+      dataset.getRow(j, point);
+      resultReference[j] = opEval->eval(alpha, point);
+
+      for (size_t i = 0; i < N; i++) {
+        unitVector[i] = 1.0;
+        resultTransposedReference[i] += source[j] * opEval->eval(unitVector, point);
+        unitVector[i] = 0.0;
+      }
+    }
+
+    // tile sizes that do and do not divide the number of data points
+    for (size_t tileSize : {1, 16, 64, 1000}) {
+      sgpp::base::OperationMultipleEvalBatched opMultipleEval(*grid, dataset, tileSize);
+      DataVector result(numberDataPoints);
+      DataVector resultTransposed(N);
+
+      opMultipleEval.mult(alpha, result);
+      opMultipleEval.multTranspose(source, resultTransposed);
+
+      for (size_t j = 0; j < numberDataPoints; j++) {
+        BOOST_CHECK_SMALL(result[j] - resultReference[j], 1e-10);
+      }
+
+      for (size_t i = 0; i < N; i++) {
+        BOOST_CHECK_SMALL(resultTransposed[i] - resultTransposedReference[i], 1e-10);
+      }
+    }
+
+    // the factory has to select the batched evaluation
+    std::unique_ptr<OperationMultipleEval> opFactory(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+    BOOST_CHECK_EQUAL(opFactory->getImplementationName(), "BATCHED");
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -6,6 +6,8 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/RandomNumberGenerator.hpp>
 #include <sgpp/base/tools/sle/system/FullSLE.hpp>
@@ -13,6 +15,8 @@
 #include <string>
 #include <vector>
 
+using sgpp::base::CPUFeatures;
+using sgpp::base::InstructionSet;
 using sgpp::base::Printer;
 using sgpp::base::RandomNumberGenerator;
 
@@ -124,3 +128,42 @@ BOOST_AUTO_TEST_CASE(TestRandomNumberGenerator) {
     BOOST_CHECK_SMALL(calculateVariance(numbers) - (kDbl * kDbl - 1.0) / 12.0, 0.01 * kDbl * kDbl);
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestCPUFeatures) {
+  const std::vector<InstructionSet> instructionSets = {
+      InstructionSet::SCALAR, InstructionSet::SSE3, InstructionSet::AVX, InstructionSet::AVX2,
+      InstructionSet::AVX512F};
+  const InstructionSet oldMaximum = CPUFeatures::getMaximumInstructionSet();
+
+  // names
+  for (InstructionSet isa : instructionSets) {
+    BOOST_CHECK(CPUFeatures::fromString(CPUFeatures::toString(isa)) == isa);
+  }
+
+  BOOST_CHECK(CPUFeatures::fromString("AVX2") == InstructionSet::AVX2);
+  BOOST_CHECK_THROW(CPUFeatures::fromString("altivec"), sgpp::base::data_exception);
+
+  // the best instruction set is supported and implies the older ones
+  CPUFeatures::setMaximumInstructionSet(InstructionSet::AVX512F);
+  const InstructionSet best = CPUFeatures::getBestInstructionSet();
+  BOOST_CHECK(CPUFeatures::isSupported(InstructionSet::SCALAR));
+  BOOST_CHECK(CPUFeatures::isSupported(best));
+
+  // the maximum instruction set limits the supported ones
+  for (InstructionSet isa : instructionSets) {
+    CPUFeatures::setMaximumInstructionSet(isa);
+    BOOST_CHECK(CPUFeatures::getMaximumInstructionSet() == isa);
+    BOOST_CHECK(static_cast<int>(CPUFeatures::getBestInstructionSet()) <= static_cast<int>(isa));
+    BOOST_CHECK(static_cast<int>(CPUFeatures::getBestInstructionSet()) <=
+                static_cast<int>(best));
+  }
+
+  CPUFeatures::setMaximumInstructionSet(InstructionSet::SCALAR);
+  BOOST_CHECK(CPUFeatures::getBestInstructionSet() == InstructionSet::SCALAR);
+  BOOST_CHECK(!CPUFeatures::isSupported(InstructionSet::SSE3));
+
+  CPUFeatures::setMaximumInstructionSet(oldMaximum);
+
+  // the CPU model is used as part of cache keys
+  BOOST_CHECK(!CPUFeatures::getCPUModel().empty());
+}
@@ -13,12 +13,12 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <limits>
 #include <list>
 #include <map>
 #include <memory>
 #include <numeric>
-#include <set>
 #include <utility>
 #include <vector>
 
@@ -228,20 +228,46 @@ std::map<LevelVector, double> AdaptiveCombinationGridGenerator::getPriorities()
 
 std::vector<LevelVector> AdaptiveCombinationGridGenerator::getPriorityQueue() const {
   auto priorities = getPriorities();
-  auto comparator = [](std::pair<LevelVector, double> elem1, std::pair<LevelVector, double> elem2) {
-    return std::abs(elem1.second) > std::abs(elem2.second);
-  };
-  std::set<std::pair<LevelVector, double>, decltype(comparator)> orderedSet(
-      priorities.begin(), priorities.end(), comparator);
+  // a stable sort keeps level vectors of equal priority (unknown priorities come last)
+  std::vector<std::pair<LevelVector, double>> orderedPriorities(priorities.begin(),
+                                                                 priorities.end());
+  auto key = [](double priority) { return std::isnan(priority) ? -1. : std::abs(priority); };
+  std::stable_sort(orderedPriorities.begin(), orderedPriorities.end(),
+                   [&key](const std::pair<LevelVector, double>& elem1,
+                          const std::pair<LevelVector, double>& elem2) {
+                     return key(elem1.second) > key(elem2.second);
+                   });
 
   std::vector<LevelVector> queue;
   queue.reserve(priorities.size());
-  std::transform(orderedSet.begin(), orderedSet.end(), back_inserter(queue),
+  std::transform(orderedPriorities.begin(), orderedPriorities.end(), back_inserter(queue),
                  [](std::pair<LevelVector, double> const& pair) { return pair.first; });
 
   return queue;
 }
 
+double AdaptiveCombinationGridGenerator::estimatePriority(const LevelVector& levelVector) const {
+  std::map<LevelVector, double> deltasOfLowerNeighbors;
+
+  for (size_t d = 0; d < levelVector.size(); ++d) {
+    if (levelVector[d] > minimumLevelVector[d]) {
+      auto neighborLevel = levelVector;
+      --neighborLevel[d];
+      const double delta = getDelta(neighborLevel);
+
+      if (!std::isnan(delta)) {
+        deltasOfLowerNeighbors[neighborLevel] = delta;
+      }
+    }
+  }
+
+  if (deltasOfLowerNeighbors.empty()) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+
+  return priorityEstimator->estimatePriority(levelVector, deltasOfLowerNeighbors);
+}
+
 std::map<LevelVector, double> AdaptiveCombinationGridGenerator::getRelevanceOfActiveSet() const {
   std::map<LevelVector, double> relevance;
 
@@ -251,6 +251,16 @@ class AdaptiveCombinationGridGenerator {
    */
   std::vector<LevelVector> getPriorityQueue() const;
 
+  /**
+   * @brief estimate the priority of an arbitrary level vector from the deltas of those downward
+   * neighbors whose results are already known (in contrast to \c getPriorities , the level vector
+   * does not have to be in the active set, which is useful for speculative evaluations)
+   *
+   * @param levelVector   the level vector
+   * @return double       the priority estimate, NaN if no downward neighbor has a known delta
+   */
+  double estimatePriority(const LevelVector& levelVector) const;
+
   /**
    * @brief get exact value of relevance / "error" of those elements in the active set
    * that already have a QoI value
@@ -0,0 +1,268 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/combigrid/adaptive/AsynchronousAdaptiveCombinationGridDriver.hpp>
+
+#include <sgpp/base/exception/application_exception.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+AsynchronousAdaptiveCombinationGridDriver::AsynchronousAdaptiveCombinationGridDriver(
+    AdaptiveCombinationGridGenerator& generator,
+    std::function<double(const LevelVector&)> evaluationFunction, size_t numberOfThreads,
+    bool speculative)
+    : generator(generator),
+      evaluationFunction(evaluationFunction),
+      numberOfThreads(0),
+      speculative(speculative),
+      numberOfSpeculativeEvaluations(0) {
+  setNumberOfThreads(numberOfThreads);
+}
+
+void AsynchronousAdaptiveCombinationGridDriver::setNumberOfThreads(size_t numberOfThreads) {
+  if (numberOfThreads == 0) {
+    throw sgpp::base::application_exception(
+        "AsynchronousAdaptiveCombinationGridDriver: numberOfThreads must be positive");
+  }
+
+  this->numberOfThreads = numberOfThreads;
+}
+
+size_t AsynchronousAdaptiveCombinationGridDriver::run(size_t maxNumberOfEvaluations) {
+  // shared between the calling thread and the workers (protected by mutex)
+  std::mutex mutex;
+  std::condition_variable taskAvailable;
+  std::condition_variable resultAvailable;
+  std::deque<LevelVector> tasks;
+  std::deque<std::pair<LevelVector, double>> results;
+  std::exception_ptr exception;
+  bool finished = false;
+
+  std::vector<std::thread> workers;
+
+  for (size_t t = 0; t < numberOfThreads; t++) {
+    workers.emplace_back([&]() {
+      std::unique_lock<std::mutex> lock(mutex);
+
+      while (true) {
+        taskAvailable.wait(lock, [&]() { return finished || !tasks.empty(); });
+
+        if (tasks.empty()) {
+          return;
+        }
+
+        const LevelVector levelVector = tasks.front();
+        tasks.pop_front();
+        lock.unlock();
+
+        double qoi = std::numeric_limits<double>::quiet_NaN();
+        std::exception_ptr curException;
+
+        try {
+          qoi = evaluationFunction(levelVector);
+        } catch (...) {
+          curException = std::current_exception();
+        }
+
+        lock.lock();
+
+        if (curException && !exception) {
+          exception = curException;
+        }
+
+        results.emplace_back(levelVector, qoi);
+        resultAvailable.notify_one();
+      }
+    });
+  }
+
+  // the generator is only accessed by the calling thread
+  std::set<LevelVector> inFlight;
+  std::vector<std::pair<LevelVector, double>> newResults;
+  size_t numberOfEvaluations = 0;
+  bool failed = false;
+  numberOfSpeculativeEvaluations = 0;
+
+  std::exception_ptr callerException;
+
+  try {
+    while (true) {
+      // start new evaluations
+      while (!failed && (inFlight.size() < numberOfThreads) &&
+             (numberOfEvaluations < maxNumberOfEvaluations)) {
+        LevelVector levelVector;
+        bool isSpeculative;
+
+        if (!findNextLevelVector(inFlight, levelVector, isSpeculative)) {
+          break;
+        }
+
+        inFlight.insert(levelVector);
+        numberOfEvaluations++;
+
+        if (isSpeculative) {
+          numberOfSpeculativeEvaluations++;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(levelVector);
+        taskAvailable.notify_one();
+      }
+
+      if (inFlight.empty()) {
+        break;
+      }
+
+      // wait for at least one result
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        resultAvailable.wait(lock, [&]() { return !results.empty(); });
+        newResults.assign(results.begin(), results.end());
+        results.clear();
+        failed = (exception != nullptr);
+      }
+
+      for (const std::pair<LevelVector, double>& result : newResults) {
+        inFlight.erase(result.first);
+
+        if (!std::isnan(result.second)) {
+          generator.setQoIInformation(result.first, result.second);
+        }
+      }
+    }
+  } catch (...) {
+    // stop the workers before propagating errors of the calling thread
+    callerException = std::current_exception();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    finished = true;
+    taskAvailable.notify_all();
+  }
+
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+
+  if (callerException) {
+    std::rethrow_exception(callerException);
+  } else if (exception) {
+    std::rethrow_exception(exception);
+  }
+
+  generator.adaptAllKnown();
+
+  return numberOfEvaluations;
+}
+
+bool AsynchronousAdaptiveCombinationGridDriver::findNextLevelVector(
+    const std::set<LevelVector>& inFlight, LevelVector& levelVector, bool& isSpeculative) {
+  isSpeculative = false;
+
+  // 1. level vectors of the old set without QoI
+  bool isOldSetComplete = true;
+
+  for (const LevelVector& oldLevelVector : generator.getOldSet()) {
+    if (!generator.hasQoIInformation(oldLevelVector)) {
+      isOldSetComplete = false;
+
+      if (inFlight.find(oldLevelVector) == inFlight.end()) {
+        levelVector = oldLevelVector;
+        return true;
+      }
+    }
+  }
+
+  while (true) {
+    // 2. level vectors of the active set without QoI, highest priority first
+    for (const LevelVector& activeLevelVector : generator.getPriorityQueue()) {
+      if (inFlight.find(activeLevelVector) == inFlight.end()) {
+        levelVector = activeLevelVector;
+        return true;
+      }
+    }
+
+    // 3. adapt to the most relevant level vector of known QoI (only if the deltas are complete)
+    if (!isOldSetComplete || !generator.adaptNextLevelVector()) {
+      break;
+    }
+  }
+
+  if (!speculative) {
+    return false;
+  }
+
+  // 4. upward neighbors of the active set that will be admissible as soon as
+  // the active set has been adapted to
+  const std::vector<LevelVector> oldSet = generator.getOldSet();
+  const std::vector<LevelVector> activeSet = generator.getActiveSet();
+  const LevelVector& minimumLevelVector = generator.getMinimumLevelVector();
+  auto isOldOrActive = [&oldSet, &activeSet](const LevelVector& curLevelVector) {
+    return (std::find(oldSet.begin(), oldSet.end(), curLevelVector) != oldSet.end()) ||
+           (std::find(activeSet.begin(), activeSet.end(), curLevelVector) != activeSet.end());
+  };
+  bool found = false;
+  double maxPriority = -1.0;
+
+  for (const LevelVector& activeLevelVector : activeSet) {
+    for (size_t d = 0; d < activeLevelVector.size(); ++d) {
+      LevelVector candidate = activeLevelVector;
+      ++candidate[d];
+
+      if ((inFlight.find(candidate) != inFlight.end()) ||
+          generator.hasQoIInformation(candidate) || isOldOrActive(candidate)) {
+        continue;
+      }
+
+      bool isCandidateAdmissible = true;
+
+      for (size_t d2 = 0; d2 < candidate.size(); ++d2) {
+        if (candidate[d2] > minimumLevelVector[d2]) {
+          LevelVector neighborLevelVector = candidate;
+          --neighborLevelVector[d2];
+
+          if (!isOldOrActive(neighborLevelVector)) {
+            isCandidateAdmissible = false;
+            break;
+          }
+        }
+      }
+
+      if (!isCandidateAdmissible) {
+        continue;
+      }
+
+      // unknown priorities are treated as the lowest possible priority
+      const double priority = generator.estimatePriority(candidate);
+      const double curPriority = std::isnan(priority) ? 0.0 : std::abs(priority);
+
+      if (curPriority > maxPriority) {
+        levelVector = candidate;
+        maxPriority = curPriority;
+        found = true;
+      }
+    }
+  }
+
+  isSpeculative = found;
+  return found;
+}
+
+}  // namespace combigrid
+}  // namespace sgpp
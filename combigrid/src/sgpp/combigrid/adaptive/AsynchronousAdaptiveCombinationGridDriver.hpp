@@ -0,0 +1,129 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/combigrid/LevelIndexTypes.hpp>
+#include <sgpp/combigrid/adaptive/AdaptiveCombinationGridGenerator.hpp>
+
+#include <functional>
+#include <set>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * @brief The AsynchronousAdaptiveCombinationGridDriver runs the dimension-adaptive algorithm of an
+ * AdaptiveCombinationGridGenerator, where the QoIs of the level vectors are computed by an
+ * expensive function (e.g., a simulation on the respective component grid).
+ *
+ * Instead of evaluating one level vector after another, the driver keeps up to
+ * \c numberOfThreads evaluations in flight on a pool of worker threads and processes the results
+ * as they arrive. Hence, the wall-clock time of an adaptive run is roughly the sum of the longest
+ * evaluations of every batch instead of the sum of all evaluations.
+ *
+ * Whenever a worker is free, the next level vector is chosen as follows:
+ *  1. level vectors of the old set without a QoI (e.g., from the initial combination grid),
+ *  2. level vectors of the active set without a QoI, ordered by the priority queue of the
+ *     generator (\c getPriorityQueue , based on the \c PriorityEstimator ),
+ *  3. if all of these are known or in flight, the most relevant level vector with known QoI is
+ *     moved from the active to the old set (\c adaptNextLevelVector , based on the
+ *     \c RelevanceCalculator ), which may lead to new candidates for 2.,
+ *  4. otherwise (if enabled), a level vector outside the active set is evaluated speculatively:
+ *     an upward neighbor of the active set whose downward neighbors are all in the old or active
+ *     set, with the highest estimated priority (\c estimatePriority ).
+ *
+ * The generator is only modified via \c setQoIInformation and \c adaptNextLevelVector by the
+ * calling thread, which means that the old set stays downward closed (admissible) at all times.
+ * Results of speculative evaluations are stored in the generator and are used as soon as the
+ * respective level vector becomes admissible. For a single thread without speculation, the
+ * driver performs the same steps as the sequential algorithm.
+ */
+class AsynchronousAdaptiveCombinationGridDriver {
+ public:
+  /**
+   * @brief Construct a new AsynchronousAdaptiveCombinationGridDriver object
+   *
+   * @param generator           the adaptive generator, which is updated by \c run
+   *                              (do not destruct before this object)
+   * @param evaluationFunction  the function computing the QoI of a level vector, is called
+   *                              concurrently from different threads (must be thread-safe)
+   * @param numberOfThreads     the maximal number of concurrent evaluations (at least one)
+   * @param speculative         whether level vectors outside the active set may be evaluated
+   *                              if no other level vector can be evaluated
+   */
+  AsynchronousAdaptiveCombinationGridDriver(
+      AdaptiveCombinationGridGenerator& generator,
+      std::function<double(const LevelVector&)> evaluationFunction, size_t numberOfThreads,
+      bool speculative = true);
+
+  /**
+   * @brief evaluate level vectors and adapt the generator until the budget is exhausted or no
+   * level vector can be evaluated anymore; at the end, all level vectors with known QoI are
+   * adapted to (\c adaptAllKnown ), i.e., no evaluation is wasted
+   *
+   * If the evaluation function throws an exception, no new evaluations are started, and the
+   * exception is rethrown after the evaluations in flight have finished.
+   *
+   * @param maxNumberOfEvaluations  the maximal number of evaluations
+   * @return size_t                 the number of evaluations
+   */
+  size_t run(size_t maxNumberOfEvaluations);
+
+  /**
+   * @brief get the number of speculative evaluations of the last \c run
+   */
+  size_t getNumberOfSpeculativeEvaluations() const { return numberOfSpeculativeEvaluations; }
+
+  /**
+   * @brief get the maximal number of concurrent evaluations
+   */
+  size_t getNumberOfThreads() const { return numberOfThreads; }
+
+  /**
+   * @brief set the maximal number of concurrent evaluations (at least one)
+   */
+  void setNumberOfThreads(size_t numberOfThreads);
+
+  /**
+   * @brief whether level vectors outside the active set may be evaluated
+   */
+  bool isSpeculative() const { return speculative; }
+
+  /**
+   * @brief set whether level vectors outside the active set may be evaluated
+   */
+  void setSpeculative(bool speculative) { this->speculative = speculative; }
+
+ private:
+  /**
+   * @brief find the next level vector to be evaluated (adapting the generator if necessary)
+   *
+   * @param inFlight            the level vectors that are currently evaluated
+   * @param[out] levelVector    the next level vector
+   * @param[out] isSpeculative  whether levelVector is outside the active set
+   * @return true               if there is a level vector to be evaluated
+   */
+  bool findNextLevelVector(const std::set<LevelVector>& inFlight, LevelVector& levelVector,
+                           bool& isSpeculative);
+
+  // the adaptive generator
+  AdaptiveCombinationGridGenerator& generator;
+
+  // the function computing the QoI of a level vector
+  std::function<double(const LevelVector&)> evaluationFunction;
+
+  // the maximal number of concurrent evaluations
+  size_t numberOfThreads;
+
+  // whether level vectors outside the active set may be evaluated
+  bool speculative;
+
+  // the number of speculative evaluations of the last run
+  size_t numberOfSpeculativeEvaluations;
+};
+
+}  // namespace combigrid
+}  // namespace sgpp
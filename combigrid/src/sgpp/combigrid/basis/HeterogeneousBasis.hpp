@@ -180,6 +180,19 @@ class HeterogeneousBasis {
     return bases1d;
   }
 
+  /**
+   * @return whether all 1D bases can be evaluated concurrently (see base::Basis::isThreadSafe)
+   */
+  bool isThreadSafe() const {
+    for (base::Basis<level_t, index_t>* const& basis1d : bases1d) {
+      if (!basis1d->isThreadSafe()) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
   /**
    * @param bases1d   vector of pointers to 1D bases (do not delete before this object)
    */
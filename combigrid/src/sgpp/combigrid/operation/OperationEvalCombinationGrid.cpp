@@ -8,11 +8,22 @@
 #include <sgpp/combigrid/operation/OperationEvalCombinationGrid.hpp>
 #include <sgpp/combigrid/operation/OperationEvalFullGrid.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
 #include <vector>
 
 namespace sgpp {
 namespace combigrid {
 
+namespace {
+/// minimal number of points per thread for which the points instead of the full grids are
+/// distributed among the threads
+const size_t MIN_POINTS_PER_THREAD = 64;
+}  // namespace
+
 OperationEvalCombinationGrid::OperationEvalCombinationGrid(const CombinationGrid& grid) :
     grid(grid) {
 }
@@ -34,17 +45,60 @@ double OperationEvalCombinationGrid::eval(const std::vector<base::DataVector>& s
 void OperationEvalCombinationGrid::multiEval(const std::vector<base::DataVector>& surpluses,
     const base::DataMatrix& points, base::DataVector& result) {
   const std::vector<FullGrid>& fullGrids = grid.getFullGrids();
-  base::DataMatrix values(points.getNrows(), fullGrids.size());
-  base::DataVector curValues(points.getNrows());
-  OperationEvalFullGrid operationEvalFullGrid;
+  const size_t n = points.getNrows();
 
-  for (size_t i = 0; i < fullGrids.size(); i++) {
-    operationEvalFullGrid.setGrid(fullGrids[i]);
-    operationEvalFullGrid.multiEval(surpluses[i], points, curValues);
-    values.setColumn(i, curValues);
-  }
+#ifdef _OPENMP
+  const size_t numberOfThreads = static_cast<size_t>(omp_get_max_threads());
+#else
+  const size_t numberOfThreads = 1;
+#endif
+
+  if (n >= MIN_POINTS_PER_THREAD * numberOfThreads) {
+    // many points: the full grids are evaluated one after another, each in parallel
+    // over the points, and the values are accumulated directly
+    base::DataVector curValues(n);
+    OperationEvalFullGrid operationEvalFullGrid;
+    const base::DataVector& coefficients = grid.getCoefficients();
+    result.resize(n);
+    result.setAll(0.0);
 
-  grid.combineValues(values, result);
+    for (size_t i = 0; i < fullGrids.size(); i++) {
+      operationEvalFullGrid.setGrid(fullGrids[i]);
+      operationEvalFullGrid.multiEval(surpluses[i], points, curValues);
+      result.axpy(coefficients[i], curValues);
+    }
+  } else {
+    // few points: the full grids are evaluated in parallel (largest first),
+    // unless they share bases that cannot be evaluated concurrently
+    base::DataMatrix values(n, fullGrids.size());
+    std::vector<size_t> order(fullGrids.size());
+    bool isThreadSafe = true;
+
+    for (size_t i = 0; i < order.size(); i++) {
+      order[i] = i;
+      isThreadSafe = isThreadSafe && fullGrids[i].getBasis().isThreadSafe();
+    }
+
+    std::sort(order.begin(), order.end(), [&fullGrids](size_t i, size_t j) {
+      return fullGrids[i].getNumberOfIndexVectors() > fullGrids[j].getNumberOfIndexVectors();
+    });
+
+#pragma omp parallel if (isThreadSafe)
+    {
+      base::DataVector curValues(n);
+      OperationEvalFullGrid operationEvalFullGrid;
+
+#pragma omp for schedule(dynamic)
+      for (size_t k = 0; k < order.size(); k++) {
+        const size_t i = order[k];
+        operationEvalFullGrid.setGrid(fullGrids[i]);
+        operationEvalFullGrid.multiEval(surpluses[i], points, curValues);
+        values.setColumn(i, curValues);
+      }
+    }
+
+    grid.combineValues(values, result);
+  }
 }
 
 const CombinationGrid& OperationEvalCombinationGrid::getGrid() const {
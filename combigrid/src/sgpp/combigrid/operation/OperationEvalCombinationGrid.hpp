@@ -43,6 +43,9 @@ class OperationEvalCombinationGrid {
 
   /**
    * Evaluate a combination grid function at multiple points.
+   * The evaluation is parallelized with OpenMP, either over the points (if there are many)
+   * or over the full grids, if the 1D bases of all full grids can be evaluated concurrently
+   * (see HeterogeneousBasis::isThreadSafe).
    *
    * @param[in] surpluses   coefficients for the basis functions (may be nodal/hierarchical),
    *                        every vector corresponds to one full grid (the order of DataVector
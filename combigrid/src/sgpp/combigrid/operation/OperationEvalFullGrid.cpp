@@ -8,13 +8,183 @@
 #include <sgpp/combigrid/operation/OperationEvalFullGrid.hpp>
 #include <sgpp/combigrid/tools/IndexVectorRange.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace sgpp {
 namespace combigrid {
 
-OperationEvalFullGrid::OperationEvalFullGrid() : grid() {
+namespace {
+
+/**
+ * Level/index pairs of the 1D basis functions of a full grid (hierarchized if the basis is
+ * hierarchical), i.e., the data that is needed to evaluate the 1D basis functions.
+ */
+class TensorProductBasis {
+ public:
+  explicit TensorProductBasis(const FullGrid& grid) :
+      bases1d(grid.getBasis().getBases1d()), levelIndexPairs(grid.getDimension()),
+      strides(grid.getDimension()) {
+    const size_t dim = grid.getDimension();
+    const bool isHierarchical = grid.getBasis().isHierarchical();
+    size_t stride = 1;
+
+    for (size_t d = 0; d < dim; d++) {
+      const index_t minIndex = grid.getMinIndex(d);
+      const index_t maxIndex = grid.getMaxIndex(d);
+
+      for (index_t i = minIndex; i <= maxIndex; i++) {
+        level_t curLevel = grid.getLevel()[d];
+        index_t curIndex = i;
+
+        if (isHierarchical) {
+          HeterogeneousBasis::hierarchizeLevelIndex(curLevel, curIndex);
+        }
+
+        levelIndexPairs[d].emplace_back(curLevel, curIndex);
+      }
+
+      strides[d] = stride;
+      stride *= levelIndexPairs[d].size();
+    }
+  }
+
+  /// 1D bases
+  std::vector<base::Basis<level_t, index_t>*> bases1d;
+  /// level/index pairs of the 1D basis functions for every dimension
+  std::vector<std::vector<std::pair<level_t, index_t>>> levelIndexPairs;
+  /// distance of consecutive 1D indices in the vector of coefficients for every dimension
+  std::vector<size_t> strides;
+};
+
+/**
+ * Buffers for evaluating a full grid function at one point with sum factorization.
+ */
+struct TensorProductWorkspace {
+  /// positions of the non-vanishing 1D basis functions for every dimension
+  std::vector<std::vector<size_t>> supportPositions;
+  /// values of the non-vanishing 1D basis functions for every dimension
+  std::vector<std::vector<double>> supportValues;
+  /// partially contracted coefficients
+  std::vector<double> buffer;
+  /// counter for iterating over the non-vanishing basis functions
+  std::vector<size_t> counter;
+};
+
+/**
+ * Evaluates a full grid function at one point with sum factorization.
+ *
+ * @param basis       1D basis functions of the full grid
+ * @param surpluses   coefficients of the full grid basis functions
+ * @param point       evaluation point (dim entries)
+ * @param workspace   buffers (reused between calls)
+ * @return value of the full grid function at the point
+ */
+double evalTensorProduct(const TensorProductBasis& basis, const base::DataVector& surpluses,
+    const double* point, TensorProductWorkspace& workspace) {
+  const size_t dim = basis.levelIndexPairs.size();
+
+  if (dim == 0) {
+    return surpluses[0];
+  }
+
+  workspace.supportPositions.resize(dim);
+  workspace.supportValues.resize(dim);
+  workspace.counter.assign(dim, 0);
+  size_t bufferSize = 1;
+
+  // evaluate the 1D basis functions and keep the non-vanishing ones
+  for (size_t d = 0; d < dim; d++) {
+    const std::vector<std::pair<level_t, index_t>>& levelIndexPairs = basis.levelIndexPairs[d];
+    std::vector<size_t>& positions = workspace.supportPositions[d];
+    std::vector<double>& values = workspace.supportValues[d];
+    positions.clear();
+    values.clear();
+
+    for (size_t k = 0; k < levelIndexPairs.size(); k++) {
+      const double value = basis.bases1d[d]->eval(levelIndexPairs[k].first,
+          levelIndexPairs[k].second, point[d]);
+
+      if (value != 0.0) {
+        positions.push_back(k * basis.strides[d]);
+        values.push_back(value);
+      }
+    }
+
+    if (positions.empty()) {
+      return 0.0;
+    }
+
+    if (d > 0) {
+      bufferSize *= positions.size();
+    }
+  }
+
+  // contract the first dimension while gathering the coefficients
+  // (the remaining dimensions are iterated with the second dimension being the fastest)
+  std::vector<double>& buffer = workspace.buffer;
+  buffer.resize(bufferSize);
+  const std::vector<size_t>& firstPositions = workspace.supportPositions[0];
+  const std::vector<double>& firstValues = workspace.supportValues[0];
+  size_t offset = 0;
+
+  for (size_t d = 1; d < dim; d++) {
+    offset += workspace.supportPositions[d][0];
+  }
+
+  for (size_t m = 0; m < bufferSize; m++) {
+    double sum = 0.0;
+
+    for (size_t a = 0; a < firstPositions.size(); a++) {
+      sum += firstValues[a] * surpluses[offset + firstPositions[a]];
+    }
+
+    buffer[m] = sum;
+
+    // next combination of the non-vanishing basis functions of the remaining dimensions
+    for (size_t d = 1; d < dim; d++) {
+      const std::vector<size_t>& positions = workspace.supportPositions[d];
+      size_t& c = workspace.counter[d];
+      offset -= positions[c];
+
+      if (c + 1 < positions.size()) {
+        c++;
+        offset += positions[c];
+        break;
+      } else {
+        c = 0;
+        offset += positions[0];
+      }
+    }
+  }
+
+  // contract the remaining dimensions (in place)
+  for (size_t d = 1; d < dim; d++) {
+    const std::vector<double>& values = workspace.supportValues[d];
+    const size_t k = values.size();
+    bufferSize /= k;
+
+    for (size_t r = 0; r < bufferSize; r++) {
+      double sum = 0.0;
+
+      for (size_t a = 0; a < k; a++) {
+        sum += values[a] * buffer[a + k * r];
+      }
+
+      buffer[r] = sum;
+    }
+  }
+
+  return buffer[0];
+}
+
+}  // namespace
+
+OperationEvalFullGrid::OperationEvalFullGrid(EvalType evalType) : grid(), evalType(evalType) {
 }
 
-OperationEvalFullGrid::OperationEvalFullGrid(const FullGrid& grid) : grid(grid) {
+OperationEvalFullGrid::OperationEvalFullGrid(const FullGrid& grid, EvalType evalType) :
+    grid(grid), evalType(evalType) {
 }
 
 OperationEvalFullGrid::~OperationEvalFullGrid() {
@@ -22,6 +192,11 @@ OperationEvalFullGrid::~OperationEvalFullGrid() {
 
 double OperationEvalFullGrid::eval(const base::DataVector& surpluses,
     const base::DataVector& point) {
+  if (evalType == EvalType::TensorProduct) {
+    TensorProductWorkspace workspace;
+    return evalTensorProduct(TensorProductBasis(grid), surpluses, point.getPointer(), workspace);
+  }
+
   const LevelVector& level = grid.getLevel();
   const HeterogeneousBasis& basis = grid.getBasis();
   size_t i = 0;
@@ -37,12 +212,33 @@ double OperationEvalFullGrid::eval(const base::DataVector& surpluses,
 
 void OperationEvalFullGrid::multiEval(const base::DataVector& surpluses,
     const base::DataMatrix& points, base::DataVector& result) {
+  const size_t n = points.getNrows();
+  result.resize(n);
+
+  if (evalType == EvalType::TensorProduct) {
+    const TensorProductBasis tensorProductBasis(grid);
+    const size_t dim = points.getNcols();
+    const double* pointsData = points.getPointer();
+    const bool isThreadSafe = grid.getBasis().isThreadSafe();
+
+#pragma omp parallel if (isThreadSafe)
+    {
+      TensorProductWorkspace workspace;
+
+#pragma omp for schedule(static)
+      for (size_t j = 0; j < n; j++) {
+        result[j] = evalTensorProduct(tensorProductBasis, surpluses, pointsData + j * dim,
+            workspace);
+      }
+    }
+
+    return;
+  }
+
   const LevelVector& level = grid.getLevel();
   const HeterogeneousBasis& basis = grid.getBasis();
-  const size_t n = points.getNrows();
   base::DataVector point(points.getNcols());
   size_t i = 0;
-  result.resize(n);
   result.setAll(0.0);
 
   for (const IndexVector& index : IndexVectorRange(grid)) {
@@ -63,5 +259,13 @@ void OperationEvalFullGrid::setGrid(const FullGrid& grid) {
   this->grid = grid;
 }
 
+OperationEvalFullGrid::EvalType OperationEvalFullGrid::getEvalType() const {
+  return evalType;
+}
+
+void OperationEvalFullGrid::setEvalType(EvalType evalType) {
+  this->evalType = evalType;
+}
+
 }  // namespace combigrid
 }  // namespace sgpp
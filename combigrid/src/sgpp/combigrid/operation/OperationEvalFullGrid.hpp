@@ -16,20 +16,44 @@ namespace combigrid {
 
 /**
  * Operation for evaluating a full grid function (linear combination of full grid basis functions).
+ *
+ * By default, the tensor product structure of the full grid is exploited (sum factorization):
+ * For every evaluation point, the 1D basis functions of every dimension are evaluated once,
+ * only the 1D basis functions that do not vanish at the point are kept, and the coefficients
+ * are contracted with the 1D values dimension by dimension. For bases with local support,
+ * the cost per point is thus \f$\mathcal{O}(\sum_d n_d + \prod_d k_d)\f$ instead of
+ * \f$\mathcal{O}(d \prod_d n_d)\f$, where \f$n_d\f$ is the number of 1D grid points and
+ * \f$k_d\f$ is the number of 1D basis functions that do not vanish at the point.
+ * multiEval is parallelized over the points with OpenMP if the 1D bases can be evaluated
+ * concurrently (see HeterogeneousBasis::isThreadSafe).
  */
 class OperationEvalFullGrid : public base::OperationEval {
  public:
+  /**
+   * Algorithm for evaluating the full grid function.
+   */
+  enum class EvalType {
+    /// evaluate every full grid basis function at every point
+    Naive,
+    /// contract the 1D basis values dimension by dimension, skipping vanishing basis functions
+    TensorProduct,
+  };
+
   /**
    * Default constructor.
+   *
+   * @param evalType  algorithm for evaluating the full grid function
    */
-  OperationEvalFullGrid();
+  explicit OperationEvalFullGrid(EvalType evalType = EvalType::TensorProduct);
 
   /**
    * Constructor.
    *
-   * @param grid  full grid
+   * @param grid      full grid
+   * @param evalType  algorithm for evaluating the full grid function
    */
-  explicit OperationEvalFullGrid(const FullGrid& grid);
+  explicit OperationEvalFullGrid(const FullGrid& grid,
+                                 EvalType evalType = EvalType::TensorProduct);
 
   /**
    * Virtual destructor.
@@ -66,9 +90,21 @@ class OperationEvalFullGrid : public base::OperationEval {
    */
   void setGrid(const FullGrid& grid);
 
+  /**
+   * @return algorithm for evaluating the full grid function
+   */
+  EvalType getEvalType() const;
+
+  /**
+   * @param evalType  algorithm for evaluating the full grid function
+   */
+  void setEvalType(EvalType evalType);
+
  protected:
   /// full grid
   FullGrid grid;
+  /// algorithm for evaluating the full grid function
+  EvalType evalType;
 };
 
 }  // namespace combigrid
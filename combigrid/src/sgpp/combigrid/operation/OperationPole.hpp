@@ -59,6 +59,17 @@ class OperationPole {
    */
   virtual void apply(base::DataVector& values, size_t start, size_t step, size_t count,
       level_t level, bool hasBoundary = true) = 0;
+
+  /**
+   * Whether apply may be called concurrently for different poles of the same data vector.
+   * If so, OperationUPFullGrid and OperationUPCombinationGrid process the poles and
+   * the full grids in parallel.
+   *
+   * @return whether apply is thread-safe (default: false)
+   */
+  virtual bool isThreadSafe() const {
+    return false;
+  }
 };
 
 }  // namespace combigrid
@@ -45,10 +45,12 @@ void OperationPoleHierarchisationGeneral::apply(base::DataVector& values, size_t
     rhs[i] = values[start + i * step];
   }
 
-  sle.setDimension(count);
-  sle.setLevel(level);
-  sle.setHasBoundary(hasBoundary);
-  sleSolver.solve(sle, rhs, solution);
+  // local copy of the system, such that apply can be called concurrently
+  HierarchisationGeneralSLE curSle(sle);
+  curSle.setDimension(count);
+  curSle.setLevel(level);
+  curSle.setHasBoundary(hasBoundary);
+  sleSolver.solve(curSle, rhs, solution);
 
   for (size_t i = 0; i < count; i++) {
     values[start + i * step] = solution[i];
@@ -84,6 +86,11 @@ bool OperationPoleHierarchisationGeneral::HierarchisationGeneralSLE::isMatrixEnt
   return (std::abs(getMatrixEntry(i, j)) > 1e-12);
 }
 
+base::Basis<level_t, index_t>&
+OperationPoleHierarchisationGeneral::HierarchisationGeneralSLE::getBasis() const {
+  return basis;
+}
+
 bool OperationPoleHierarchisationGeneral::HierarchisationGeneralSLE::isBasisHierarchical() const {
   return isBasisHierarchical_;
 }
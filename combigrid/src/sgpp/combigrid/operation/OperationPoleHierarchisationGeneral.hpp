@@ -77,6 +77,14 @@ class OperationPoleHierarchisationGeneral : public OperationPole {
   void apply(base::DataVector& values, size_t start, size_t step, size_t count,
       level_t level, bool hasBoundary = true) override;
 
+  /**
+   * @return whether the 1D basis can be evaluated concurrently (every call solves its own
+   *         system of linear equations)
+   */
+  bool isThreadSafe() const override {
+    return sle.getBasis().isThreadSafe();
+  }
+
  protected:
   /**
    * Class for the system of linear equations for hierarchising.
@@ -119,6 +127,11 @@ class OperationPoleHierarchisationGeneral : public OperationPole {
      */
     bool isMatrixEntryNonZero(size_t i, size_t j) override;
 
+    /**
+     * @return 1D basis
+     */
+    base::Basis<level_t, index_t>& getBasis() const;
+
     /**
      * @return whether the basis is hierarchical or nodal
      */
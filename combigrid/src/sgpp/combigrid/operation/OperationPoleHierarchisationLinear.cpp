@@ -24,7 +24,10 @@ void OperationPoleHierarchisationLinear::apply(base::DataVector& values, size_t
     size_t k = start + step * (h - (hasBoundary ? 0 : 1));
 
     for (index_t i = 1; i < hInv; i += 2) {
-      values[k] -= (values[k - step * h] + values[k + step * h]) / 2.0;
+      // without boundary, the values on the boundary are zero
+      const double leftValue = ((i > 1) || hasBoundary) ? values[k - step * h] : 0.0;
+      const double rightValue = ((i + 1 < hInv) || hasBoundary) ? values[k + step * h] : 0.0;
+      values[k] -= (leftValue + rightValue) / 2.0;
       k += 2 * step * h;
     }
 
@@ -48,6 +48,13 @@ class OperationPoleNodalisationLinear : public OperationPole {
    */
   void apply(base::DataVector& values, size_t start, size_t step, size_t count,
       level_t level, bool hasBoundary = true) override;
+
+  /**
+   * @return true, as the operator has no state
+   */
+  bool isThreadSafe() const override {
+    return true;
+  }
 };
 
 }  // namespace combigrid
@@ -8,6 +8,7 @@
 #include <sgpp/combigrid/operation/OperationUPCombinationGrid.hpp>
 #include <sgpp/combigrid/operation/OperationUPFullGrid.hpp>
 
+#include <algorithm>
 #include <vector>
 
 namespace sgpp {
@@ -37,11 +38,44 @@ void OperationUPCombinationGrid::apply(std::vector<base::DataVector>& values) {
     return;
   }
 
-  OperationUPFullGrid operationUPFullGrid(fullGrids[0], operationPole);
+  bool isThreadSafe = true;
 
-  for (size_t i = 0; i < values.size(); i++) {
-    operationUPFullGrid.setGrid(fullGrids[i]);
-    operationUPFullGrid.apply(values[i]);
+  for (const OperationPole* operationPole1d : operationPole) {
+    isThreadSafe = isThreadSafe && operationPole1d->isThreadSafe();
+  }
+
+  if (!isThreadSafe) {
+    OperationUPFullGrid operationUPFullGrid(fullGrids[0], operationPole);
+
+    for (size_t i = 0; i < values.size(); i++) {
+      operationUPFullGrid.setGrid(fullGrids[i]);
+      operationUPFullGrid.apply(values[i]);
+    }
+
+    return;
+  }
+
+  // the full grids are processed in parallel (largest first)
+  std::vector<size_t> order(values.size());
+
+  for (size_t i = 0; i < order.size(); i++) {
+    order[i] = i;
+  }
+
+  std::sort(order.begin(), order.end(), [&fullGrids](size_t i, size_t j) {
+    return fullGrids[i].getNumberOfIndexVectors() > fullGrids[j].getNumberOfIndexVectors();
+  });
+
+#pragma omp parallel
+  {
+    OperationUPFullGrid operationUPFullGrid(fullGrids[0], operationPole);
+
+#pragma omp for schedule(dynamic)
+    for (size_t k = 0; k < order.size(); k++) {
+      const size_t i = order[k];
+      operationUPFullGrid.setGrid(fullGrids[i]);
+      operationUPFullGrid.apply(values[i]);
+    }
   }
 }
 
@@ -18,6 +18,9 @@ namespace combigrid {
 /**
  * Operation for applying 1D OperationPole operators on all poles of all full grids of some
  * combination grid, in all dimensions via the unidirectional principle (UP).
+ *
+ * If all OperationPole operators are thread-safe (see OperationPole::isThreadSafe), the full
+ * grids are processed in parallel with OpenMP (largest first for load balancing).
  */
 class OperationUPCombinationGrid {
  public:
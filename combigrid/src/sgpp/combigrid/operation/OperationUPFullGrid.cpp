@@ -6,14 +6,24 @@
 #include <sgpp/globaldef.hpp>
 #include <sgpp/combigrid/LevelIndexTypes.hpp>
 #include <sgpp/combigrid/operation/OperationUPFullGrid.hpp>
-#include <sgpp/combigrid/tools/IndexVectorRange.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
 namespace sgpp {
 namespace combigrid {
 
+namespace {
+
+/// number of neighboring strided poles that are copied into a contiguous buffer at once
+const size_t BLOCK_SIZE = 16;
+
+/// minimal number of grid points for which the poles are processed in parallel with OpenMP
+const size_t MIN_PARALLEL_SIZE = 4096;
+
+}  // namespace
+
 OperationUPFullGrid::OperationUPFullGrid(const FullGrid& grid,
     const std::vector<std::unique_ptr<OperationPole>>& operationPole) :
     grid(grid), operationPole() {
@@ -33,38 +43,59 @@ OperationUPFullGrid::OperationUPFullGrid(const FullGrid& grid, OperationPole& op
 void OperationUPFullGrid::apply(base::DataVector& values) {
   const size_t dim = grid.getDimension();
   const bool hasBoundary = grid.hasBoundary();
-  FullGrid gridProjection(LevelVector(dim-1, 0), grid.getBasis(), grid.hasBoundary());
-  LevelVector& levelProjection = gridProjection.getLevel();
-  IndexVectorRange range(grid);
-  IndexVector indexStart(dim);
+  const LevelVector& level = grid.getLevel();
+  const size_t numberOfValues = grid.getNumberOfIndexVectors();
   size_t step = 1;
 
   for (size_t d = 0; d < dim; d++) {
-    const LevelVector& level = grid.getLevel();
-
-    for (size_t d2 = 0; d2 < dim; d2++) {
-      if (d2 < d) {
-        levelProjection[d2] = level[d2];
-      } else if (d2 > d) {
-        levelProjection[d2-1] = level[d2];
+    // the poles in dimension d are indexed by (inner, outer) with inner < step, i.e.,
+    // the k-th entry of the pole (inner, outer) is at outer * step * count + k * step + inner
+    const size_t count = grid.getNumberOfIndexVectors(d);
+    const size_t numberOfOuter = numberOfValues / (step * count);
+    OperationPole& operationPole1d = *operationPole[d];
+    const bool parallel = operationPole1d.isThreadSafe() &&
+        (numberOfValues >= MIN_PARALLEL_SIZE);
+
+    if (step == 1) {
+      // the poles are contiguous in memory
+#pragma omp parallel for schedule(static) if (parallel)
+      for (size_t outer = 0; outer < numberOfOuter; outer++) {
+        operationPole1d.apply(values, outer * count, 1, count, level[d], hasBoundary);
       }
-    }
-
-    range.setGrid(grid);
-    const index_t count = grid.getNumberOfIndexVectors(d);
-    IndexVectorRange rangeProjection(gridProjection);
-    indexStart[d] = grid.getMinIndex(d);
-
-    for (const IndexVector& indexProjection : rangeProjection) {
-      for (size_t d2 = 0; d2 < dim; d2++) {
-        if (d2 < d) {
-          indexStart[d2] = indexProjection[d2];
-      } else if (d2 > d) {
-          indexStart[d2] = indexProjection[d2-1];
+    } else {
+      // the poles are strided: copy blocks of neighboring poles into a contiguous buffer
+      // (in this way, each cache line of values is only loaded once per block),
+      // apply the pole operators on the buffer, and copy the results back
+      const size_t numberOfBlocks = (step + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+#pragma omp parallel if (parallel)
+      {
+        base::DataVector buffer(BLOCK_SIZE * count);
+
+#pragma omp for schedule(static)
+        for (size_t t = 0; t < numberOfOuter * numberOfBlocks; t++) {
+          const size_t outer = t / numberOfBlocks;
+          const size_t firstInner = (t % numberOfBlocks) * BLOCK_SIZE;
+          const size_t blockSize = std::min(BLOCK_SIZE, step - firstInner);
+          const size_t offset = outer * step * count + firstInner;
+
+          for (size_t k = 0; k < count; k++) {
+            for (size_t b = 0; b < blockSize; b++) {
+              buffer[b * count + k] = values[offset + k * step + b];
+            }
+          }
+
+          for (size_t b = 0; b < blockSize; b++) {
+            operationPole1d.apply(buffer, b * count, 1, count, level[d], hasBoundary);
+          }
+
+          for (size_t k = 0; k < count; k++) {
+            for (size_t b = 0; b < blockSize; b++) {
+              values[offset + k * step + b] = buffer[b * count + k];
+            }
+          }
         }
       }
-
-      operationPole[d]->apply(values, range.find(indexStart), step, count, level[d], hasBoundary);
     }
 
     step *= count;
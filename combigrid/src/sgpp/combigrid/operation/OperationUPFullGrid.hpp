@@ -19,6 +19,11 @@ namespace combigrid {
 /**
  * Operation for applying 1D OperationPole operators on all poles of a full grid in all dimensions
  * via the unidirectional principle (UP).
+ *
+ * Poles that are strided in memory (all dimensions except the first) are processed in blocks
+ * of neighboring poles, which are copied to a contiguous buffer before the 1D operator is
+ * applied. The poles of one dimension are processed in parallel with OpenMP if the respective
+ * OperationPole is thread-safe (see OperationPole::isThreadSafe).
  */
 class OperationUPFullGrid {
  public:
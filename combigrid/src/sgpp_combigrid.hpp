@@ -8,6 +8,7 @@
 #include <sgpp/combigrid/LevelIndexTypes.hpp>
 
 #include <sgpp/combigrid/adaptive/AdaptiveCombinationGridGenerator.hpp>
+#include <sgpp/combigrid/adaptive/AsynchronousAdaptiveCombinationGridDriver.hpp>
 #include <sgpp/combigrid/adaptive/AveragingPriorityEstimator.hpp>
 #include <sgpp/combigrid/adaptive/PriorityEstimator.hpp>
 #include <sgpp/combigrid/adaptive/RelevanceCalculator.hpp>
@@ -8,15 +8,18 @@
 
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineClenshawCurtisBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 
 #include <sgpp/combigrid/LevelIndexTypes.hpp>
 #include <sgpp/combigrid/adaptive/AdaptiveCombinationGridGenerator.hpp>
+#include <sgpp/combigrid/adaptive/AsynchronousAdaptiveCombinationGridDriver.hpp>
 #include <sgpp/combigrid/basis/HeterogeneousBasis.hpp>
 #include <sgpp/combigrid/grid/CombinationGrid.hpp>
 #include <sgpp/combigrid/grid/FullGrid.hpp>
 #include <sgpp/combigrid/operation/OperationEvalCombinationGrid.hpp>
+#include <sgpp/combigrid/operation/OperationEvalFullGrid.hpp>
 #include <sgpp/combigrid/operation/OperationPole.hpp>
 #include <sgpp/combigrid/operation/OperationPoleDehierarchisationLinear.hpp>
 #include <sgpp/combigrid/operation/OperationPoleHierarchisationGeneral.hpp>
@@ -30,16 +33,29 @@
 
 #include <boost/test/unit_test.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <numeric>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <thread>
 #include <vector>
 
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::combigrid::AdaptiveCombinationGridGenerator;
+using sgpp::combigrid::AsynchronousAdaptiveCombinationGridDriver;
 using sgpp::combigrid::CombinationGrid;
 using sgpp::combigrid::FullGrid;
 using sgpp::combigrid::HeterogeneousBasis;
@@ -48,6 +64,7 @@ using sgpp::combigrid::IndexVectorRange;
 using sgpp::combigrid::LevelVector;
 using sgpp::combigrid::LevelVectorTools;
 using sgpp::combigrid::OperationEvalCombinationGrid;
+using sgpp::combigrid::OperationEvalFullGrid;
 using sgpp::combigrid::OperationPole;
 using sgpp::combigrid::OperationPoleDehierarchisationLinear;
 using sgpp::combigrid::OperationPoleHierarchisationGeneral;
@@ -457,6 +474,132 @@ BOOST_AUTO_TEST_CASE(testOperationEvalCombinationGrid) {
   BOOST_CHECK_EQUAL(result[1], -3.9375);
 }
 
+BOOST_AUTO_TEST_CASE(testOperationEvalTensorProduct) {
+  sgpp::base::SBsplineBase basis1d1(1);
+  sgpp::base::SBsplineBase basis1d3(3);
+  sgpp::base::SLinearBase basis1dLinear;
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  // few points (parallelization over the full grids) and many points
+  // (parallelization over the points)
+  for (size_t n : {3, 1000}) {
+    DataMatrix points(n, 3);
+
+    for (double& x : points) {
+      x = distribution(generator);
+    }
+
+    // points on the boundary and on grid points
+    points(0, 0) = 0.0;
+    points(0, 1) = 1.0;
+    points(1, 2) = 0.25;
+
+    for (bool isHierarchical : {true, false}) {
+      for (bool hasBoundary : {true, false}) {
+        const HeterogeneousBasis basis({&basis1d1, &basis1d3, &basis1dLinear}, isHierarchical);
+        const CombinationGrid combinationGrid =
+            CombinationGrid::fromRegularSparse(3, 4, basis, hasBoundary);
+        std::vector<DataVector> surpluses;
+
+        for (const FullGrid& fullGrid : combinationGrid.getFullGrids()) {
+          surpluses.emplace_back(fullGrid.getNumberOfIndexVectors());
+
+          for (double& surplus : surpluses.back()) {
+            surplus = distribution(generator) - 0.5;
+          }
+
+          // naive evaluation and evaluation with sum factorization
+          OperationEvalFullGrid opNaive(fullGrid, OperationEvalFullGrid::EvalType::Naive);
+          OperationEvalFullGrid opTensorProduct(fullGrid);
+          BOOST_CHECK(opTensorProduct.getEvalType() ==
+                      OperationEvalFullGrid::EvalType::TensorProduct);
+          DataVector resultNaive;
+          DataVector resultTensorProduct;
+          opNaive.multiEval(surpluses.back(), points, resultNaive);
+          opTensorProduct.multiEval(surpluses.back(), points, resultTensorProduct);
+          DataVector point(3);
+
+          for (size_t j = 0; j < n; j++) {
+            BOOST_CHECK_SMALL(resultTensorProduct[j] - resultNaive[j], 1e-12);
+            points.getRow(j, point);
+            BOOST_CHECK_SMALL(opTensorProduct.eval(surpluses.back(), point) - resultNaive[j],
+                              1e-12);
+          }
+        }
+
+        OperationEvalCombinationGrid op(combinationGrid);
+        DataVector result;
+        op.multiEval(surpluses, points, result);
+        DataVector point(3);
+
+        for (size_t j = 0; j < n; j++) {
+          points.getRow(j, point);
+          BOOST_CHECK_SMALL(result[j] - op.eval(surpluses, point), 1e-12);
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationEvalThreadSafety) {
+  sgpp::base::SBsplineBase basis1d(3);
+  sgpp::base::SBsplineClenshawCurtisBase basis1dClenshawCurtis(3);
+  BOOST_CHECK(basis1d.isThreadSafe());
+  BOOST_CHECK(!basis1dClenshawCurtis.isThreadSafe());
+
+  const HeterogeneousBasis basis({&basis1d, &basis1dClenshawCurtis});
+  BOOST_CHECK(HeterogeneousBasis(2, basis1d).isThreadSafe());
+  BOOST_CHECK(!basis.isThreadSafe());
+
+  // the hierarchisation poles are only thread-safe if their basis is
+  std::vector<std::unique_ptr<OperationPole>> operationPole;
+  OperationPoleHierarchisationGeneral::fromHeterogenerousBasis(basis, operationPole);
+  BOOST_CHECK(operationPole[0]->isThreadSafe());
+  BOOST_CHECK(!operationPole[1]->isThreadSafe());
+
+#ifdef _OPENMP
+  const int oldNumThreads = omp_get_max_threads();
+  omp_set_num_threads(4);
+#endif
+
+  // bases that are not thread-safe are evaluated serially
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  const CombinationGrid combinationGrid = CombinationGrid::fromRegularSparse(2, 5, basis);
+  std::vector<DataVector> surpluses;
+
+  for (const FullGrid& fullGrid : combinationGrid.getFullGrids()) {
+    surpluses.emplace_back(fullGrid.getNumberOfIndexVectors());
+
+    for (double& surplus : surpluses.back()) {
+      surplus = distribution(generator) - 0.5;
+    }
+  }
+
+  for (size_t n : {3, 1000}) {
+    DataMatrix points(n, 2);
+
+    for (double& x : points) {
+      x = distribution(generator);
+    }
+
+    OperationEvalCombinationGrid op(combinationGrid);
+    DataVector result;
+    op.multiEval(surpluses, points, result);
+    DataVector point(2);
+
+    for (size_t j = 0; j < n; j++) {
+      points.getRow(j, point);
+      BOOST_CHECK_SMALL(result[j] - op.eval(surpluses, point), 1e-12);
+    }
+  }
+
+#ifdef _OPENMP
+  omp_set_num_threads(oldNumThreads);
+#endif
+}
+
 BOOST_AUTO_TEST_CASE(testOperationUPFullGridLinear) {
   sgpp::base::SLinearBase basis1d;
   const HeterogeneousBasis basis(2, basis1d);
@@ -575,6 +718,104 @@ BOOST_AUTO_TEST_CASE(testOperationUPCombinationGrid) {
   }
 }
 
+namespace {
+
+/**
+ * Pole operator that forwards to another pole operator, but is not thread-safe
+ * (forces the serial code path).
+ */
+class OperationPoleSerial : public OperationPole {
+ public:
+  explicit OperationPoleSerial(OperationPole& operationPole) : operationPole(operationPole) {}
+
+  void apply(DataVector& values, size_t start, size_t step, size_t count,
+             sgpp::combigrid::level_t level, bool hasBoundary = true) override {
+    operationPole.apply(values, start, step, count, level, hasBoundary);
+  }
+
+ private:
+  OperationPole& operationPole;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(testOperationUPBlockedParallel) {
+  sgpp::base::SBsplineBase basis1d(3);
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+  for (bool hasBoundary : {true, false}) {
+    const HeterogeneousBasis basis(3, basis1d);
+    std::vector<std::unique_ptr<OperationPole>> operationPoleGeneral;
+    OperationPoleHierarchisationGeneral::fromHeterogenerousBasis(basis, operationPoleGeneral);
+    OperationPoleHierarchisationLinear operationPoleLinear;
+    OperationPoleNodalisationBspline operationPoleBspline(3);
+    std::vector<OperationPole*> operationPole{operationPoleGeneral[0].get(), &operationPoleLinear,
+                                              &operationPoleBspline};
+
+    // large enough for the parallel code path, with more than one block of strided poles
+    const FullGrid fullGrid({5, 6, 4}, basis, hasBoundary);
+    DataVector values(fullGrid.getNumberOfIndexVectors());
+
+    for (double& value : values) {
+      value = distribution(generator);
+    }
+
+    // reference: apply the pole operators directly on the strided poles
+    DataVector correctValues(values);
+    size_t step = 1;
+
+    for (size_t d = 0; d < 3; d++) {
+      const size_t count = fullGrid.getNumberOfIndexVectors(d);
+      const size_t numberOfOuter = values.size() / (step * count);
+
+      for (size_t outer = 0; outer < numberOfOuter; outer++) {
+        for (size_t inner = 0; inner < step; inner++) {
+          operationPole[d]->apply(correctValues, outer * step * count + inner, step, count,
+                                  fullGrid.getLevel()[d], hasBoundary);
+        }
+      }
+
+      step *= count;
+    }
+
+    OperationUPFullGrid operation(fullGrid, operationPole);
+    operation.apply(values);
+
+    for (size_t i = 0; i < values.size(); i++) {
+      BOOST_CHECK_EQUAL(values[i], correctValues[i]);
+    }
+
+    // parallel processing of the full grids vs. serial processing
+    const CombinationGrid combinationGrid =
+        CombinationGrid::fromRegularSparse(3, 5, basis, hasBoundary);
+    OperationPoleSerial operationPoleSerial0(*operationPole[0]);
+    OperationPoleSerial operationPoleSerial1(*operationPole[1]);
+    OperationPoleSerial operationPoleSerial2(*operationPole[2]);
+    std::vector<OperationPole*> operationPoleSerial{&operationPoleSerial0, &operationPoleSerial1,
+                                                    &operationPoleSerial2};
+    std::vector<DataVector> valuesParallel;
+
+    for (const FullGrid& curFullGrid : combinationGrid.getFullGrids()) {
+      valuesParallel.emplace_back(curFullGrid.getNumberOfIndexVectors());
+
+      for (double& value : valuesParallel.back()) {
+        value = distribution(generator);
+      }
+    }
+
+    std::vector<DataVector> valuesSerial = valuesParallel;
+    OperationUPCombinationGrid(combinationGrid, operationPole).apply(valuesParallel);
+    OperationUPCombinationGrid(combinationGrid, operationPoleSerial).apply(valuesSerial);
+
+    for (size_t i = 0; i < valuesParallel.size(); i++) {
+      for (size_t j = 0; j < valuesParallel[i].size(); j++) {
+        BOOST_CHECK_EQUAL(valuesParallel[i][j], valuesSerial[i][j]);
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(testMakeDownwardClosed) {
   std::vector<LevelVector> subspaces = {LevelVector{0, 0, 1}, LevelVector{0, 2, 1},
                                         LevelVector{1, 0, 3}};
@@ -729,3 +970,166 @@ BOOST_AUTO_TEST_CASE(testAdaptiveCombinationGridGenerator) {
     }
   }
 }
+
+namespace {
+
+/**
+ * Anisotropic QoI of a level vector (converges to 1 for increasing levels).
+ */
+double anisotropicQoI(const LevelVector& level) {
+  const std::vector<double> weights{1.0, 0.5, 0.1};
+  double result = 1.0;
+
+  for (size_t d = 0; d < level.size(); d++) {
+    result *= 1.0 - weights[d] / static_cast<double>(1 << level[d]);
+  }
+
+  return result;
+}
+
+/**
+ * Check that the old set is downward closed and that all QoIs of the old set are known.
+ */
+void checkOldSetAdmissible(AdaptiveCombinationGridGenerator& generator) {
+  const std::vector<LevelVector> oldSet = generator.getOldSet();
+  const LevelVector& minimumLevel = generator.getMinimumLevelVector();
+
+  for (const LevelVector& level : oldSet) {
+    BOOST_CHECK(generator.hasQoIInformation(level));
+
+    for (size_t d = 0; d < level.size(); d++) {
+      if (level[d] > minimumLevel[d]) {
+        LevelVector neighborLevel = level;
+        neighborLevel[d]--;
+        BOOST_CHECK(std::find(oldSet.begin(), oldSet.end(), neighborLevel) != oldSet.end());
+      }
+    }
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(testAsynchronousAdaptiveCombinationGridDriver) {
+  sgpp::base::SBsplineBase basis1d;
+  HeterogeneousBasis basis(3, basis1d);
+  const CombinationGrid combinationGrid = CombinationGrid::fromRegularSparse(3, 1, basis);
+  const size_t maxNumberOfEvaluations = 25;
+
+  // one thread without speculation: same steps as the sequential algorithm
+  {
+    auto generator = AdaptiveCombinationGridGenerator::fromCombinationGrid(combinationGrid);
+    AsynchronousAdaptiveCombinationGridDriver driver(generator, anisotropicQoI, 1, false);
+    BOOST_CHECK_EQUAL(driver.run(maxNumberOfEvaluations), maxNumberOfEvaluations);
+    BOOST_CHECK_EQUAL(driver.getNumberOfSpeculativeEvaluations(), 0);
+
+    auto sequentialGenerator =
+        AdaptiveCombinationGridGenerator::fromCombinationGrid(combinationGrid);
+    size_t numberOfEvaluations = 0;
+
+    while (numberOfEvaluations < maxNumberOfEvaluations) {
+      bool evaluated = false;
+
+      for (const LevelVector& level : sequentialGenerator.getOldSet()) {
+        if (!sequentialGenerator.hasQoIInformation(level)) {
+          sequentialGenerator.setQoIInformation(level, anisotropicQoI(level));
+          evaluated = true;
+          break;
+        }
+      }
+
+      if (!evaluated) {
+        const std::vector<LevelVector> queue = sequentialGenerator.getPriorityQueue();
+
+        if (!queue.empty()) {
+          sequentialGenerator.setQoIInformation(queue[0], anisotropicQoI(queue[0]));
+          evaluated = true;
+        } else if (!sequentialGenerator.adaptNextLevelVector()) {
+          break;
+        }
+      }
+
+      if (evaluated) {
+        numberOfEvaluations++;
+      }
+    }
+
+    sequentialGenerator.adaptAllKnown();
+
+    const std::vector<LevelVector> oldSet = generator.getOldSet();
+    const std::vector<LevelVector> sequentialOldSet = sequentialGenerator.getOldSet();
+    BOOST_CHECK_EQUAL_COLLECTIONS(oldSet.begin(), oldSet.end(), sequentialOldSet.begin(),
+                                  sequentialOldSet.end());
+    BOOST_CHECK_EQUAL(generator.getCurrentResult(), sequentialGenerator.getCurrentResult());
+    checkOldSetAdmissible(generator);
+  }
+
+  // several threads with speculation
+  {
+    auto generator = AdaptiveCombinationGridGenerator::fromCombinationGrid(combinationGrid);
+    std::mutex mutex;
+    std::multiset<LevelVector> evaluatedLevels;
+    std::atomic<size_t> numberOfRunningEvaluations(0);
+    std::atomic<size_t> maxNumberOfRunningEvaluations(0);
+
+    auto evaluationFunction = [&](const LevelVector& level) {
+      const size_t numberOfRunning = ++numberOfRunningEvaluations;
+      size_t maxNumberOfRunning = maxNumberOfRunningEvaluations;
+
+      while ((numberOfRunning > maxNumberOfRunning) &&
+             !maxNumberOfRunningEvaluations.compare_exchange_weak(maxNumberOfRunning,
+                                                                  numberOfRunning)) {
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        evaluatedLevels.insert(level);
+      }
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      --numberOfRunningEvaluations;
+      return anisotropicQoI(level);
+    };
+
+    AsynchronousAdaptiveCombinationGridDriver driver(generator, evaluationFunction, 4);
+    BOOST_CHECK_EQUAL(driver.run(maxNumberOfEvaluations), maxNumberOfEvaluations);
+    BOOST_CHECK_EQUAL(evaluatedLevels.size(), maxNumberOfEvaluations);
+    BOOST_CHECK_GT(maxNumberOfRunningEvaluations.load(), 1);
+    BOOST_CHECK_LE(maxNumberOfRunningEvaluations.load(), 4);
+
+    for (const LevelVector& level : evaluatedLevels) {
+      // every level is evaluated only once
+      BOOST_CHECK_EQUAL(evaluatedLevels.count(level), 1);
+    }
+
+    checkOldSetAdmissible(generator);
+    BOOST_CHECK(std::isfinite(generator.getCurrentResult()));
+  }
+
+  // speculation (in 1D, the active set contains only one level)
+  {
+    AdaptiveCombinationGridGenerator generator({LevelVector{0}});
+    AsynchronousAdaptiveCombinationGridDriver driver(generator, anisotropicQoI, 3);
+    BOOST_CHECK_EQUAL(driver.run(6), 6);
+    BOOST_CHECK_GT(driver.getNumberOfSpeculativeEvaluations(), 0);
+    checkOldSetAdmissible(generator);
+    BOOST_CHECK_EQUAL(generator.getOldSet().size(), 6);
+    BOOST_CHECK_EQUAL(generator.getCurrentResult(), anisotropicQoI(LevelVector{5}));
+  }
+
+  // exceptions of the evaluation function are propagated
+  {
+    auto generator = AdaptiveCombinationGridGenerator::fromCombinationGrid(combinationGrid);
+    AsynchronousAdaptiveCombinationGridDriver driver(
+        generator,
+        [](const LevelVector& level) {
+          if (level[0] > 3) {
+            throw std::runtime_error("simulation failed");
+          }
+
+          return anisotropicQoI(level);
+        },
+        3);
+    BOOST_CHECK_THROW(driver.run(maxNumberOfEvaluations), std::runtime_error);
+    checkOldSetAdmissible(generator);
+  }
+}
@@ -11,6 +11,7 @@
 #include <sgpp/base/grid/type/ModPolyGrid.hpp>
 #include <sgpp/base/grid/type/PolyGrid.hpp>
 #include <sgpp/base/grid/type/PrewaveletGrid.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
 
 #include <sgpp/datadriven/operation/hash/simple/OperationDensityConditional.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationDensityConditionalLinear.hpp>
@@ -86,13 +87,14 @@
 #include <sgpp/datadriven/operation/hash/simple/OperationTestPoly.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationTestPrewavelet.hpp>
 
+#include <sgpp/datadriven/operation/hash/MultipleEvalAutoTuner/MultipleEvalAutoTuner.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalModMaskStreaming/OperationMultiEvalModMaskStreaming.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingBSpline/OperationMultiEvalStreamingBSpline.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingPoly/OperationMultiEvalStreamingPoly.hpp>
 
-#ifdef __AVX__
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalSubspace/combined/OperationMultipleEvalSubspaceCombined.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalSubspace/simple/OperationMultipleEvalSubspaceSimple.hpp>
-#endif
 
 #ifdef USE_OCL
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalStreamingBSplineOCL/StreamingBSplineOCLOperatorFactory.hpp>
@@ -129,6 +131,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <cstring>
+#include <memory>
 
 namespace sgpp {
 namespace op_factory {
@@ -433,6 +436,19 @@ base::OperationMultipleEval* createOperationMultipleEval(
 
   // can now assume that MPI type is NONE
   if (configuration.getType() == sgpp::datadriven::OperationMultipleEvalType::DEFAULT) {
+    if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::NAIVE) {
+      return createOperationMultipleEvalNaive(grid, dataset);
+    }
+
+    if ((configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) &&
+        datadriven::MultipleEvalAutoTuner::isAutoTuningEnabled(grid, dataset)) {
+      datadriven::MultipleEvalAutoTuner tuner;
+      datadriven::OperationMultipleEvalConfiguration tunedConfiguration =
+          tuner.tune(grid, dataset);
+      return datadriven::MultipleEvalAutoTuner::createOperation(grid, dataset,
+                                                                tunedConfiguration);
+    }
+
     return createOperationMultipleEval(grid, dataset);
   }
 
@@ -440,6 +456,16 @@ base::OperationMultipleEval* createOperationMultipleEval(
     if (configuration.getType() == datadriven::OperationMultipleEvalType::DEFAULT ||
         configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) {
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+        std::shared_ptr<base::OperationConfiguration> parameters = configuration.getParameters();
+
+        if ((parameters != nullptr) && parameters->contains("CHUNK_GRID_POINTS") &&
+            parameters->contains("CHUNK_DATA_POINTS")) {
+          return new datadriven::OperationMultiEvalStreaming(
+              grid, dataset, datadriven::OperationMultiEvalStreaming::getBestInstructionSet(),
+              (*parameters)["CHUNK_GRID_POINTS"].getUInt(),
+              (*parameters)["CHUNK_DATA_POINTS"].getUInt());
+        }
+
         return new datadriven::OperationMultiEvalStreaming(grid, dataset);
       }
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::OCLMP) {
@@ -453,7 +479,12 @@ base::OperationMultipleEval* createOperationMultipleEval(
     } else if (configuration.getType() == datadriven::OperationMultipleEvalType::SUBSPACELINEAR) {
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT ||
           configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::COMBINED) {
-#ifdef __AVX__
+#if defined(__AVX__) || defined(SGPP_RUNTIME_ISA_DISPATCH)
+        if (!base::CPUFeatures::isSupported(base::InstructionSet::AVX)) {
+          throw base::factory_exception(
+              "Error creating function: the subspace kernels require a CPU with AVX");
+        }
+
         return new datadriven::OperationMultipleEvalSubspaceCombined(grid, dataset);
 #else
         throw base::factory_exception(
@@ -461,7 +492,12 @@ base::OperationMultipleEval* createOperationMultipleEval(
 #endif
       } else if (configuration.getSubType() ==
                  sgpp::datadriven::OperationMultipleEvalSubType::SIMPLE) {
-#ifdef __AVX__
+#if defined(__AVX__) || defined(SGPP_RUNTIME_ISA_DISPATCH)
+        if (!base::CPUFeatures::isSupported(base::InstructionSet::AVX)) {
+          throw base::factory_exception(
+              "Error creating function: the subspace kernels require a CPU with AVX");
+        }
+
         return new datadriven::OperationMultipleEvalSubspaceSimple(grid, dataset);
 #else
         throw base::factory_exception(
@@ -517,6 +553,9 @@ base::OperationMultipleEval* createOperationMultipleEval(
     }
   } else if (grid.getType() == base::GridType::Bspline) {
     if (configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) {
+      if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+        return new datadriven::OperationMultiEvalStreamingBSpline(grid, dataset);
+      }
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::OCL) {
 #ifdef USE_OCL
         return datadriven::createStreamingBSplineOCLConfigured(grid, dataset, configuration);
@@ -526,6 +565,12 @@ base::OperationMultipleEval* createOperationMultipleEval(
 #endif
       }
     }
+  } else if (grid.getType() == base::GridType::ModBspline) {
+    if (configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) {
+      if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+        return new datadriven::OperationMultiEvalStreamingBSpline(grid, dataset);
+      }
+    }
   } else if (grid.getType() == base::GridType::Poly) {
     if (configuration.getType() == datadriven::OperationMultipleEvalType::DEFAULT) {
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::CUDA) {
@@ -536,7 +581,14 @@ base::OperationMultipleEval* createOperationMultipleEval(
             "Error creating function: the library wasn't compiled with CUDA support");
 #endif
       }
+    } else if (configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) {
+      if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+        return new datadriven::OperationMultiEvalStreamingPoly(grid, dataset, false);
+      }
     } else if (configuration.getType() == datadriven::OperationMultipleEvalType::MORTONORDER) {
+      if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+        return new datadriven::OperationMultiEvalStreamingPoly(grid, dataset, true);
+      }
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::CUDA) {
 #ifdef USE_CUDA
         return new datadriven::OperationMultiEvalCuda(grid, dataset, grid.getDegree(), true);
@@ -546,6 +598,16 @@ base::OperationMultipleEval* createOperationMultipleEval(
 #endif
       }
     }
+  } else if (grid.getType() == base::GridType::ModPoly) {
+    if (configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) {
+      if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+        return new datadriven::OperationMultiEvalStreamingPoly(grid, dataset, false);
+      }
+    } else if (configuration.getType() == datadriven::OperationMultipleEvalType::MORTONORDER) {
+      if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+        return new datadriven::OperationMultiEvalStreamingPoly(grid, dataset, true);
+      }
+    }
   }
 
   throw base::factory_exception("OperationMultiEval is not implemented for this grid type.");
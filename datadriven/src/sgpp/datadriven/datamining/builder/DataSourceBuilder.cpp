@@ -14,6 +14,7 @@
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceFileTypeParser.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/GzipFileSampleDecorator.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/StreamingFileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorFactory.hpp>
 
 #include <algorithm>
@@ -41,6 +42,11 @@ DataSourceBuilder& DataSourceBuilder::withBatchSize(size_t batchSize) {
   return *this;
 }
 
+DataSourceBuilder& DataSourceBuilder::withValidationSize(size_t validationSize) {
+  config.validationSize_ = validationSize;
+  return *this;
+}
+
 DataSourceBuilder& DataSourceBuilder::withCompression(bool isCompressed) {
   config.isCompressed_ = isCompressed;
 
@@ -54,6 +60,11 @@ DataSourceBuilder& DataSourceBuilder::withCompression(bool isCompressed) {
   return *this;
 }
 
+DataSourceBuilder& DataSourceBuilder::withStreaming(bool isStreaming) {
+  config.isStreaming_ = isStreaming;
+  return *this;
+}
+
 DataSourceBuilder& DataSourceBuilder::withPath(const std::string& filePath) {
   config.filePath_ = filePath;
   if (config.fileType_ == DataSourceFileType::NONE) {
@@ -63,6 +74,10 @@ DataSourceBuilder& DataSourceBuilder::withPath(const std::string& filePath) {
 }
 
 DataSourceSplitting* DataSourceBuilder::splittingAssemble() const {
+  if (config.isStreaming_) {
+    return streamingAssemble();
+  }
+
   // Create a shuffling functor
   DataShufflingFunctorFactory shufflingFunctorFactory;
   DataShufflingFunctor* shuffling = shufflingFunctorFactory.buildDataShufflingFunctor(config);
@@ -89,6 +104,39 @@ DataSourceSplitting* DataSourceBuilder::splittingAssemble() const {
   return new DataSourceSplitting(config, sampleProvider);
 }
 
+DataSourceSplitting* DataSourceBuilder::streamingAssemble() const {
+  if (config.shuffling_ != DataSourceShufflingType::sequential) {
+    throw data_exception("DataSourceBuilder::streamingAssemble() streaming requires sequential "
+                         "shuffling");
+  }
+
+  if ((config.fileType_ != DataSourceFileType::ARFF) &&
+      (config.fileType_ != DataSourceFileType::CSV)) {
+    throw data_exception("DataSourceBuilder::streamingAssemble() unknown file type");
+  }
+
+  // the validation portion would require an additional pass to count the samples
+  if ((config.validationSize_ == 0) && (config.validationPortion_ > 0.0)) {
+    throw data_exception("DataSourceBuilder::streamingAssemble() streaming requires an absolute "
+                         "validationSize (or a validationPortion of 0)");
+  }
+
+#ifndef ZLIB
+  if (config.isCompressed_) {
+    throw sgpp::base::application_exception{
+        "sgpp has been built without zlib support. Reading compressed files is not possible"};
+  }
+#endif
+
+  // compressed files are decompressed on the fly, chunks are as large as the batches
+  SampleProvider* sampleProvider =
+      (config.batchSize_ > 0)
+          ? new StreamingFileSampleProvider(config.fileType_, config.batchSize_)
+          : new StreamingFileSampleProvider(config.fileType_);
+
+  return new DataSourceSplitting(config, sampleProvider);
+}
+
 DataSourceSplitting* DataSourceBuilder::splittingFromConfig(const DataSourceConfig& config) {
   this->config = config;
 
@@ -99,6 +147,11 @@ DataSourceSplitting* DataSourceBuilder::splittingFromConfig(const DataSourceConf
 }
 
 DataSourceCrossValidation* DataSourceBuilder::crossValidationAssemble() const {
+  if (config.isStreaming_) {
+    throw data_exception("DataSourceBuilder::crossValidationAssemble() streaming is not "
+                         "supported for cross validation");
+  }
+
   // Create a shuffling functor
   DataShufflingFunctorFactory shufflingFunctorFactory;
   DataShufflingFunctor* shuffling = shufflingFunctorFactory.buildDataShufflingFunctor(config);
@@ -44,6 +44,16 @@ class DataSourceBuilder {
    */
   DataSourceBuilder& withCompression(bool isCompressed);
 
+  /**
+   * Optionally Specify if the file should be streamed, i.e., read batch by batch in the
+   * background instead of loading it completely into memory. Only supported for sequential
+   * shuffling and not for cross validation. The validation set has to be specified by
+   * withValidationSize (unless the validation portion is 0). False by default.
+   * @param isStreaming true if the file should be streamed, false otherwise.
+   * @return Reference to this object, used for chaining.
+   */
+  DataSourceBuilder& withStreaming(bool isStreaming);
+
   /**
    * Optionally Specify the file type if files are used. If data source does not use any files,
    * this is set to none by default. See DataSourceFileType for supported file types.
@@ -68,6 +78,14 @@ class DataSourceBuilder {
    */
   DataSourceBuilder& withBatchSize(size_t batchSize);
 
+  /**
+   * Optionally Specify the number of samples used for validation. If 0 (default), the validation
+   * portion of the dataset is used, which requires the number of samples.
+   * @param validationSize number of validation samples
+   * @return Reference to this object, used for chaining.
+   */
+  DataSourceBuilder& withValidationSize(size_t validationSize);
+
   /**
    * Based on the currently specified configuration, build and configure an instance of a data
    * source object.
@@ -106,6 +124,12 @@ class DataSourceBuilder {
    */
   void grabTypeInfoFromFilePath();
 
+  /**
+   * Build a data source object that streams the file (see DataSourceConfig::isStreaming_).
+   * @return Fully configured instance of #sgpp::datadriven::DataSourceSplitting object.
+   */
+  DataSourceSplitting* streamingAssemble() const;
+
   /**
    * Current state of the object is stored inside this configuration object.
    */
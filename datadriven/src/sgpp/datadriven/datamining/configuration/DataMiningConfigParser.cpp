@@ -126,6 +126,8 @@ bool DataMiningConfigParser::getDataSourceConfig(DataSourceConfig &config,
     config.filePath_ = parseString(*dataSourceConfig, "filePath", defaults.filePath_, "dataSource");
     config.isCompressed_ =
         parseBool(*dataSourceConfig, "compression", defaults.isCompressed_, "dataSource");
+    config.isStreaming_ =
+        parseBool(*dataSourceConfig, "streaming", defaults.isStreaming_, "dataSource");
     config.numBatches_ =
         parseUInt(*dataSourceConfig, "numBatches", defaults.numBatches_, "dataSource");
     config.batchSize_ =
@@ -134,6 +136,8 @@ bool DataMiningConfigParser::getDataSourceConfig(DataSourceConfig &config,
         parseBool(*dataSourceConfig, "hasTargets", defaults.hasTargets_, "dataSource");
     config.validationPortion_ = parseDouble(*dataSourceConfig, "validationPortion",
                                             defaults.validationPortion_, "dataSource");
+    config.validationSize_ =
+        parseUInt(*dataSourceConfig, "validationSize", defaults.validationSize_, "dataSource");
     // if negative we want UINT_MAX here, so all should be fine
     config.readinCutoff_ = static_cast<size_t>(
         parseInt(*dataSourceConfig, "readinCutoff", defaults.readinCutoff_, "dataSource"));
@@ -229,6 +233,8 @@ bool DataMiningConfigParser::getMultiDataSourceConfig(
     // Fill in all parameters for first dataset (except the filePath)
     config[0].isCompressed_ =
         parseBool(*dataSourceConfig, "compression", defaults[0].isCompressed_, "dataSource");
+    config[0].isStreaming_ =
+        parseBool(*dataSourceConfig, "streaming", defaults[0].isStreaming_, "dataSource");
     config[0].numBatches_ =
         parseUInt(*dataSourceConfig, "numBatches", defaults[0].numBatches_, "dataSource");
     config[0].batchSize_ =
@@ -237,6 +243,8 @@ bool DataMiningConfigParser::getMultiDataSourceConfig(
         parseBool(*dataSourceConfig, "hasTargets", defaults[0].hasTargets_, "dataSource");
     config[0].validationPortion_ = parseDouble(*dataSourceConfig, "validationPortion",
                                                defaults[0].validationPortion_, "dataSource");
+    config[0].validationSize_ = parseUInt(*dataSourceConfig, "validationSize",
+                                          defaults[0].validationSize_, "dataSource");
     // if negative we want UINT_MAX here, so all should be fine
     config[0].readinCutoff_ = static_cast<size_t>(
         parseInt(*dataSourceConfig, "readinCutoff", defaults[0].readinCutoff_, "dataSource"));
@@ -95,13 +95,10 @@ Dataset* ArffFileSampleProvider::splitDataset(size_t howMany) {
   base::DataMatrix& destSamples = tmpDataset->getData();
   base::DataVector& destTargets = tmpDataset->getTargets();
 
-  base::DataVector tmpRow(srcSamples.getNcols());
-
   // copy "size" rows beginning from "counter" to the new dataset.
   for (size_t i = counter; i < counter + size; ++i) {
     size_t srcIdx = shuffling != nullptr ? (*shuffling)(i, dataset.getNumberInstances()) : i;
-    srcSamples.getRow(srcIdx, tmpRow);
-    destSamples.setRow(i - counter, tmpRow);
+    destSamples.setRow(i - counter, srcSamples.getRowView(srcIdx));
 
     destTargets[i - counter] = srcTargets[srcIdx];
   }
@@ -43,6 +43,12 @@ struct DataSourceConfig {
    * The dataset is gzip compressed
    */
   bool isCompressed_ = false;
+  /**
+   * Read the file batch by batch in the background instead of loading it completely into memory
+   * (see #sgpp::datadriven::StreamingFileSampleProvider). Requires sequential shuffling and an
+   * absolute validationSize_ (unless validationPortion_ is 0).
+   */
+  bool isStreaming_ = false;
   /**
    * How many batches should the dataset be split into for batch learning - if 1, take the
    * entire dataset
@@ -56,6 +62,12 @@ struct DataSourceConfig {
    * The portion of the dataset that is used for validation
    */
   double validationPortion_ = 0.3;
+  /*
+   * The number of samples that are used for validation - if 0, validationPortion_ is used
+   * instead, which requires the number of samples of the dataset (i.e., an additional pass over
+   * streamed files)
+   */
+  size_t validationSize_ = 0;
   /**
    * whether the file has targets (i.e. supervised learning)
    */
@@ -18,8 +18,12 @@ void DataSourceSplitting::reset() {
   sampleProvider->reset();
   // Retrieve new validation data
   delete validationData;
-  size_t validationSize = static_cast<size_t>(config.validationPortion_ *
-                                              static_cast<double>(sampleProvider->getNumSamples()));
+  // the number of samples is only needed if the validation size is not configured
+  size_t validationSize =
+      (config.validationSize_ > 0)
+          ? config.validationSize_
+          : static_cast<size_t>(config.validationPortion_ *
+                                static_cast<double>(sampleProvider->getNumSamples()));
   validationData = sampleProvider->getNextSamples(validationSize);
 }
 
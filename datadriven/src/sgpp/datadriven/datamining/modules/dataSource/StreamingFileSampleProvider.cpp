@@ -0,0 +1,599 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/datamining/modules/dataSource/StreamingFileSampleProvider.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/tools/FloatParser.hpp>
+
+#ifdef ZLIB
+#include <zlib.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/// initial size of the read buffer (grows for longer lines)
+const size_t READ_BUFFER_SIZE = 1 << 20;
+
+/**
+ * Reads raw bytes from a file or a string. If SG++ has been built with zlib support, files are
+ * read via zlib, which decompresses gzip compressed files on the fly and reads uncompressed files
+ * as they are.
+ */
+class InputReader {
+ public:
+  InputReader(const std::string& filePath, const std::string* input)
+      : input(input), inputPosition(0) {
+    if (input != nullptr) {
+      return;
+    }
+
+#ifdef ZLIB
+    file = gzopen(filePath.c_str(), "rb");
+
+    if (file == nullptr) {
+      std::string msg = "Unable to open file: " + filePath;
+      throw base::file_exception(msg.c_str());
+    }
+
+    gzbuffer(file, static_cast<unsigned int>(READ_BUFFER_SIZE));
+#else
+    stream.open(filePath.c_str(), std::ios::in | std::ios::binary);
+
+    if (!stream.is_open()) {
+      std::string msg = "Unable to open file: " + filePath;
+      throw base::file_exception(msg.c_str());
+    }
+#endif
+  }
+
+  ~InputReader() {
+#ifdef ZLIB
+    if (file != nullptr) {
+      gzclose(file);
+    }
+#endif
+  }
+
+  InputReader(const InputReader&) = delete;
+  InputReader& operator=(const InputReader&) = delete;
+
+  /**
+   * Reads at most size bytes into buffer.
+   * @return number of bytes read, 0 at the end of the input
+   */
+  size_t read(char* buffer, size_t size) {
+    if (input != nullptr) {
+      const size_t count = std::min(size, input->size() - inputPosition);
+      std::memcpy(buffer, input->data() + inputPosition, count);
+      inputPosition += count;
+      return count;
+    }
+
+#ifdef ZLIB
+    const int count = gzread(file, buffer, static_cast<unsigned int>(size));
+
+    if (count < 0) {
+      throw base::file_exception("Failed to read Gzip compressed file.");
+    }
+
+    return static_cast<size_t>(count);
+#else
+    stream.read(buffer, static_cast<std::streamsize>(size));
+    return static_cast<size_t>(stream.gcount());
+#endif
+  }
+
+ private:
+  const std::string* input;
+  size_t inputPosition;
+#ifdef ZLIB
+  gzFile file = nullptr;
+#else
+  std::ifstream stream;
+#endif
+};
+
+/**
+ * Splits the input into the data lines of an ARFF or CSV file, i.e., skips empty lines,
+ * ARFF header and comment lines (containing '@' or '%'), and the header line of CSV files.
+ * The lines are not copied, they point into the read buffer and are valid until the next call.
+ */
+class DataLineReader {
+ public:
+  DataLineReader(DataSourceFileType fileType, const std::string& filePath,
+                 const std::string* input)
+      : fileType(fileType),
+        reader(filePath, input),
+        buffer(READ_BUFFER_SIZE),
+        begin(0),
+        end(0),
+        isEndOfInput(false),
+        isFirstLine(true) {}
+
+  /**
+   * Reads the next data line (without line break).
+   * @return false at the end of the input
+   */
+  bool getDataLine(const char*& first, const char*& last) {
+    while (getLine(first, last)) {
+      const bool isHeader = isFirstLine && (fileType == DataSourceFileType::CSV);
+      isFirstLine = false;
+
+      if (isHeader || (first == last)) {
+        continue;
+      }
+
+      const size_t length = static_cast<size_t>(last - first);
+
+      if ((fileType == DataSourceFileType::ARFF) &&
+          ((std::memchr(first, '%', length) != nullptr) ||
+           (std::memchr(first, '@', length) != nullptr))) {
+        continue;
+      }
+
+      return true;
+    }
+
+    return false;
+  }
+
+ private:
+  bool getLine(const char*& first, const char*& last) {
+    size_t searchBegin = begin;
+
+    while (true) {
+      const char* newline = static_cast<const char*>(
+          std::memchr(buffer.data() + searchBegin, '\n', end - searchBegin));
+
+      if (newline != nullptr) {
+        first = buffer.data() + begin;
+        last = newline;
+        begin = static_cast<size_t>(newline - buffer.data()) + 1;
+        break;
+      } else if (isEndOfInput) {
+        if (begin == end) {
+          return false;
+        }
+
+        // last line without line break
+        first = buffer.data() + begin;
+        last = buffer.data() + end;
+        begin = end;
+        break;
+      }
+
+      // move the incomplete line to the front and read more data
+      searchBegin = end - begin;
+      std::memmove(buffer.data(), buffer.data() + begin, end - begin);
+      end -= begin;
+      begin = 0;
+
+      if (end == buffer.size()) {
+        buffer.resize(2 * buffer.size());
+      }
+
+      const size_t count = reader.read(buffer.data() + end, buffer.size() - end);
+      end += count;
+      isEndOfInput = (count == 0);
+    }
+
+    if ((last > first) && (*(last - 1) == '\r')) {
+      last--;
+    }
+
+    return true;
+  }
+
+  DataSourceFileType fileType;
+  InputReader reader;
+  std::vector<char> buffer;
+  size_t begin;
+  size_t end;
+  bool isEndOfInput;
+  bool isFirstLine;
+};
+
+/**
+ * Whether the target of a sample is one of the selected classes (all classes if empty).
+ */
+bool isSelectedClass(double target, const std::vector<double>& readinClasses) {
+  // if no classes are specified, always accept the line
+  bool isSelected = readinClasses.empty();
+
+  for (size_t i = 0; i < readinClasses.size(); i++) {
+    isSelected = isSelected || (std::fabs(target - readinClasses[i]) < 0.001);
+  }
+
+  return isSelected;
+}
+
+}  // namespace
+
+StreamingFileSampleProvider::StreamingFileSampleProvider(DataSourceFileType fileType,
+                                                         size_t chunkSize,
+                                                         size_t numberOfPrefetchedChunks)
+    : fileType(fileType),
+      chunkSize(std::max(chunkSize, static_cast<size_t>(1))),
+      numberOfPrefetchedChunks(std::max(numberOfPrefetchedChunks, static_cast<size_t>(1))),
+      isStringInput(false),
+      hasTargets(true),
+      readinCutoff(-1),
+      numberOfColumns(0),
+      dimension(0),
+      numberOfSamples(-1),
+      currentChunkPosition(0),
+      isProducerFinished(true),
+      isStopRequested(false) {
+  if ((fileType != DataSourceFileType::ARFF) && (fileType != DataSourceFileType::CSV)) {
+    throw base::data_exception{"StreamingFileSampleProvider supports only ARFF and CSV files."};
+  }
+}
+
+StreamingFileSampleProvider::~StreamingFileSampleProvider() { stopProducer(); }
+
+SampleProvider* StreamingFileSampleProvider::clone() const {
+  auto sampleProvider = std::unique_ptr<StreamingFileSampleProvider>(
+      new StreamingFileSampleProvider{fileType, chunkSize, numberOfPrefetchedChunks});
+
+  if (dimension != 0) {
+    sampleProvider->filePath = filePath;
+    sampleProvider->input = input;
+    sampleProvider->isStringInput = isStringInput;
+    sampleProvider->hasTargets = hasTargets;
+    sampleProvider->readinCutoff = readinCutoff;
+    sampleProvider->readinColumns = readinColumns;
+    sampleProvider->readinClasses = readinClasses;
+    sampleProvider->numberOfColumns = numberOfColumns;
+    sampleProvider->dimension = dimension;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      sampleProvider->numberOfSamples = numberOfSamples;
+    }
+    sampleProvider->startProducer();
+  }
+
+  return dynamic_cast<SampleProvider*>(sampleProvider.release());
+}
+
+size_t StreamingFileSampleProvider::getDim() const {
+  if (dimension != 0) {
+    return dimension;
+  } else {
+    throw base::file_exception{"No dataset loaded."};
+  }
+}
+
+size_t StreamingFileSampleProvider::getNumSamples() const {
+  if (dimension == 0) {
+    throw base::file_exception{"No dataset loaded."};
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (numberOfSamples != static_cast<size_t>(-1)) {
+      return numberOfSamples;
+    }
+  }
+
+  // the background thread has not reached the end of the input yet, count in a separate pass
+  DataLineReader reader(fileType, filePath, isStringInput ? &input : nullptr);
+  const char* first;
+  const char* last;
+  size_t count = 0;
+
+  while ((count < readinCutoff) && reader.getDataLine(first, last)) {
+    if (hasTargets && !readinClasses.empty()) {
+      // the target is the last column
+      const char* target = first;
+
+      for (const char* p = first; p < last; p++) {
+        target = ((*p == ',') ? p + 1 : target);
+      }
+
+      double value;
+      FloatParser::parse(target, last, value);
+
+      if (!isSelectedClass(value, readinClasses)) {
+        continue;
+      }
+    }
+
+    count++;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  numberOfSamples = count;
+  return numberOfSamples;
+}
+
+void StreamingFileSampleProvider::readFile(const std::string& filePath, bool hasTargets,
+                                           size_t readinCutoff,
+                                           std::vector<size_t> readinColumns,
+                                           std::vector<double> readinClasses) {
+  stopProducer();
+  this->filePath = filePath;
+  this->input.clear();
+  this->isStringInput = false;
+  this->hasTargets = hasTargets;
+  this->readinCutoff = readinCutoff;
+  this->readinColumns = readinColumns;
+  this->readinClasses = readinClasses;
+  initialize();
+}
+
+void StreamingFileSampleProvider::readString(const std::string& input, bool hasTargets,
+                                             size_t readinCutoff,
+                                             std::vector<size_t> readinColumns,
+                                             std::vector<double> readinClasses) {
+  stopProducer();
+  this->filePath.clear();
+  this->input = input;
+  this->isStringInput = true;
+  this->hasTargets = hasTargets;
+  this->readinCutoff = readinCutoff;
+  this->readinColumns = readinColumns;
+  this->readinClasses = readinClasses;
+  initialize();
+}
+
+void StreamingFileSampleProvider::initialize() {
+  numberOfColumns = 0;
+  dimension = 0;
+  numberOfSamples = -1;
+
+  const std::string fileTypeName = (fileType == DataSourceFileType::ARFF) ? "ARFF" : "CSV";
+  size_t maxDimension = 0;
+
+  try {
+    // the number of columns is determined by the first data line
+    DataLineReader reader(fileType, filePath, isStringInput ? &input : nullptr);
+    const char* first;
+    const char* last;
+
+    if (reader.getDataLine(first, last)) {
+      numberOfColumns = std::count(first, last, ',') + 1;
+      maxDimension = numberOfColumns - (hasTargets ? 1 : 0);
+    }
+  } catch (...) {
+    std::string msg = "Failed to parse " + fileTypeName + " File.";
+    throw base::data_exception{msg.c_str()};
+  }
+
+  // make sure readinColumns has admissible values if it is not empty
+  if (!readinColumns.empty()) {
+    if (*std::max_element(readinColumns.begin(), readinColumns.end()) >= maxDimension) {
+      std::string msg = "Failed to parse " + fileTypeName + " File.";
+      throw base::data_exception{msg.c_str()};
+    }
+
+    dimension = readinColumns.size();
+  } else {
+    dimension = maxDimension;
+  }
+
+  if ((dimension == 0) || (readinCutoff == 0)) {
+    numberOfSamples = 0;
+  }
+
+  if (dimension != 0) {
+    startProducer();
+  }
+}
+
+void StreamingFileSampleProvider::startProducer() {
+  currentChunk = Chunk();
+  currentChunkPosition = 0;
+  queue.clear();
+  producerException = nullptr;
+  isProducerFinished = false;
+  isStopRequested = false;
+  producer = std::thread(&StreamingFileSampleProvider::produce, this);
+}
+
+void StreamingFileSampleProvider::stopProducer() {
+  if (producer.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      isStopRequested = true;
+      queueNotFull.notify_all();
+    }
+    producer.join();
+  }
+
+  queue.clear();
+  currentChunk = Chunk();
+  currentChunkPosition = 0;
+  isProducerFinished = true;
+}
+
+void StreamingFileSampleProvider::produce() {
+  try {
+    DataLineReader reader(fileType, filePath, isStringInput ? &input : nullptr);
+    std::vector<double> values;
+    Chunk chunk;
+    size_t lineNumber = 0;
+    size_t count = 0;
+    const char* first;
+    const char* last;
+
+    while ((count < readinCutoff) && reader.getDataLine(first, last)) {
+      if (appendSample(first, last, lineNumber, values, chunk)) {
+        count++;
+
+        if (chunk.size == chunkSize) {
+          if (!pushChunk(chunk)) {
+            return;
+          }
+
+          chunk = Chunk();
+        }
+      }
+
+      lineNumber++;
+    }
+
+    if ((chunk.size > 0) && !pushChunk(chunk)) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    numberOfSamples = count;
+    isProducerFinished = true;
+    queueNotEmpty.notify_all();
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(mutex);
+    producerException = std::current_exception();
+    isProducerFinished = true;
+    queueNotEmpty.notify_all();
+  }
+}
+
+bool StreamingFileSampleProvider::pushChunk(Chunk& chunk) {
+  std::unique_lock<std::mutex> lock(mutex);
+  queueNotFull.wait(
+      lock, [this]() { return isStopRequested || (queue.size() < numberOfPrefetchedChunks); });
+
+  if (isStopRequested) {
+    return false;
+  }
+
+  queue.push_back(std::move(chunk));
+  queueNotEmpty.notify_one();
+  return true;
+}
+
+bool StreamingFileSampleProvider::popChunk(Chunk& chunk) {
+  std::unique_lock<std::mutex> lock(mutex);
+  queueNotEmpty.wait(lock, [this]() { return isProducerFinished || !queue.empty(); });
+
+  if (!queue.empty()) {
+    chunk = std::move(queue.front());
+    queue.pop_front();
+    queueNotFull.notify_one();
+    return true;
+  } else if (producerException) {
+    std::rethrow_exception(producerException);
+  }
+
+  return false;
+}
+
+bool StreamingFileSampleProvider::appendSample(const char* first, const char* last,
+                                               size_t lineNumber, std::vector<double>& values,
+                                               Chunk& chunk) const {
+  FloatParser::parseLine(first, last, values);
+
+  if (values.size() != numberOfColumns) {
+    std::string msg = "StreamingFileSampleProvider: Columns missing in line ";
+    msg.append(std::to_string(lineNumber));
+    throw base::file_exception(msg.c_str());
+  }
+
+  // if we want a target, we remove it from line as we process it
+  double target = 0.0;
+
+  if (hasTargets) {
+    target = values.back();
+    values.pop_back();
+
+    if (!isSelectedClass(target, readinClasses)) {
+      return false;
+    }
+  }
+
+  if (readinColumns.empty()) {
+    chunk.data.insert(chunk.data.end(), values.begin(), values.end());
+  } else {
+    for (const size_t column : readinColumns) {
+      chunk.data.push_back(values[column]);
+    }
+  }
+
+  chunk.targets.push_back(target);
+  chunk.size++;
+  return true;
+}
+
+Dataset* StreamingFileSampleProvider::getNextSamples(size_t howMany) {
+  if (dimension == 0) {
+    throw base::file_exception("No dataset loaded.");
+  }
+
+  // collect the rows of the next chunks, such that only the requested batch is copied
+  std::vector<std::pair<Chunk, size_t>> parts;
+  size_t size = 0;
+
+  while (size < howMany) {
+    if (currentChunkPosition == currentChunk.size) {
+      if (!popChunk(currentChunk)) {
+        break;
+      }
+
+      currentChunkPosition = 0;
+    }
+
+    const size_t count = std::min(howMany - size, currentChunk.size - currentChunkPosition);
+    Chunk part;
+
+    if ((currentChunkPosition == 0) && (count == currentChunk.size)) {
+      part = std::move(currentChunk);
+      currentChunk = Chunk();
+    } else {
+      part.data.assign(currentChunk.data.begin() + currentChunkPosition * dimension,
+                       currentChunk.data.begin() + (currentChunkPosition + count) * dimension);
+      part.targets.assign(currentChunk.targets.begin() + currentChunkPosition,
+                          currentChunk.targets.begin() + currentChunkPosition + count);
+      part.size = count;
+      currentChunkPosition += count;
+    }
+
+    parts.emplace_back(std::move(part), size);
+    size += count;
+  }
+
+  auto dataset = std::unique_ptr<Dataset>(new Dataset(size, dimension));
+  double* destSamples = dataset->getData().getPointer();
+  double* destTargets = dataset->getTargets().getPointer();
+
+  for (std::pair<Chunk, size_t>& part : parts) {
+    std::copy(part.first.data.begin(), part.first.data.end(),
+              destSamples + part.second * dimension);
+    std::copy(part.first.targets.begin(), part.first.targets.end(), destTargets + part.second);
+    part.first = Chunk();
+  }
+
+  return dataset.release();
+}
+
+Dataset* StreamingFileSampleProvider::getAllSamples() {
+  return getNextSamples(static_cast<size_t>(-1));
+}
+
+void StreamingFileSampleProvider::reset() {
+  if (dimension != 0) {
+    stopProducer();
+    startProducer();
+  }
+}
+
+} /* namespace datadriven */
+} /* namespace sgpp */
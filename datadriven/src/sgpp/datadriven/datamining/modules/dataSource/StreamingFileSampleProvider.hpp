@@ -0,0 +1,218 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * StreamingFileSampleProvider reads data in ARFF or CSV format batch by batch, without keeping
+ * the whole file (or a decompressed copy of it) in memory.
+ *
+ * In contrast to #sgpp::datadriven::ArffFileSampleProvider and
+ * #sgpp::datadriven::CSVFileSampleProvider, the file is not parsed into a
+ * #sgpp::datadriven::Dataset when calling #readFile. Instead, a background thread reads the file
+ * incrementally (gzip compressed files are decompressed on the fly if SG++ has been built with
+ * zlib support), parses the samples with #sgpp::datadriven::FloatParser, and prefetches the
+ * next chunks of samples while the caller works on the current batch. The memory usage is
+ * bounded by a few chunks (numberOfPrefetchedChunks + 1) plus the requested batch.
+ *
+ * As the file is read sequentially, shuffling is not supported. #getNumSamples requires an
+ * additional pass over the file if the background thread has not reached the end of the file
+ * yet (the result is cached).
+ */
+class StreamingFileSampleProvider : public FileSampleProvider {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param fileType                  type of the file (ARFF or CSV)
+   * @param chunkSize                 number of samples that are parsed at once by the background
+   *                                  thread (e.g., the batch size)
+   * @param numberOfPrefetchedChunks  maximal number of parsed chunks that wait for being
+   *                                  requested
+   */
+  explicit StreamingFileSampleProvider(DataSourceFileType fileType, size_t chunkSize = 1024,
+                                       size_t numberOfPrefetchedChunks = 2);
+
+  /**
+   * Destructor, stops the background thread.
+   */
+  ~StreamingFileSampleProvider() override;
+
+  /**
+   * Clone Pattern to allow copying of derived classes.
+   * @return a Pointer to a new instance of #sgpp::datadriven::StreamingFileSampleProvider with the
+   * same input, which starts at the beginning of the input. Caller owns the new object.
+   */
+  SampleProvider *clone() const override;
+
+  Dataset *getNextSamples(size_t howMany) override;
+
+  /**
+   * Returns all remaining samples (the whole file after #readFile or #reset).
+   * @return #sgpp::datadriven::Dataset* Pointer to a new #sgpp::datadriven::Dataset object. This
+   * object is owned by the caller.
+   */
+  Dataset *getAllSamples() override;
+
+  size_t getDim() const override;
+
+  size_t getNumSamples() const override;
+
+  /**
+   * Open an existing ARFF or CSV file (possibly gzip compressed), parse its header and start
+   * reading samples in the background. Throws if file can not be opened or parsed.
+   * @param filePath Path to an existing file.
+   * @param hasTargets whether the file has targets (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readFile(const std::string &filePath, bool hasTargets, size_t readinCutoff = -1,
+                std::vector<size_t> readinColumns = std::vector<size_t>(),
+                std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Like #readFile, but reads the samples from a string containing ARFF or CSV data.
+   * @param input string containing information in ARFF or CSV file format
+   * @param hasTargets whether the file has targets (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readString(const std::string &input, bool hasTargets, size_t readinCutoff = -1,
+                  std::vector<size_t> readinColumns = std::vector<size_t>(),
+                  std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Restarts reading at the beginning of the input (e.g. to start a new epoch)
+   */
+  void reset() override;
+
+ private:
+  /**
+   * Samples parsed at once by the background thread.
+   */
+  struct Chunk {
+    /// row-major sample data (size * dimension entries)
+    std::vector<double> data;
+    /// targets (size entries, zero if there are no targets)
+    std::vector<double> targets;
+    /// number of samples
+    size_t size = 0;
+  };
+
+  /**
+   * Determines the number of columns from the first data line and starts the background thread.
+   */
+  void initialize();
+
+  /**
+   * Starts the background thread at the beginning of the input.
+   */
+  void startProducer();
+
+  /**
+   * Stops the background thread and discards all parsed chunks.
+   */
+  void stopProducer();
+
+  /**
+   * Main function of the background thread: parses the input into chunks.
+   */
+  void produce();
+
+  /**
+   * Waits until there is space in the queue and appends a chunk (called by the background thread).
+   * @param chunk the chunk (is moved into the queue)
+   * @return false if the background thread should stop
+   */
+  bool pushChunk(Chunk &chunk);
+
+  /**
+   * Waits for the next chunk of the background thread.
+   * @param[out] chunk the next chunk
+   * @return false if there are no more samples
+   */
+  bool popChunk(Chunk &chunk);
+
+  /**
+   * Parses a data line and appends it to a chunk if the class is selected.
+   * @param first pointer to the first character of the line
+   * @param last pointer past the last character of the line
+   * @param lineNumber number of the data line (for error messages)
+   * @param values buffer for the values of the line
+   * @param chunk chunk to append the sample to
+   * @return whether the sample has been appended
+   */
+  bool appendSample(const char *first, const char *last, size_t lineNumber,
+                    std::vector<double> &values, Chunk &chunk) const;
+
+  /// type of the input (ARFF or CSV)
+  DataSourceFileType fileType;
+  /// number of samples per chunk
+  size_t chunkSize;
+  /// maximal number of parsed chunks in the queue
+  size_t numberOfPrefetchedChunks;
+
+  /// path to the input file (empty if reading from a string)
+  std::string filePath;
+  /// input string (if reading from a string)
+  std::string input;
+  /// whether the input is a string instead of a file
+  bool isStringInput;
+  /// whether the input has targets
+  bool hasTargets;
+  /// maximal number of samples to read
+  size_t readinCutoff;
+  /// columns to read (empty for all columns)
+  std::vector<size_t> readinColumns;
+  /// classes to read (empty for all classes)
+  std::vector<double> readinClasses;
+
+  /// number of columns of the input (including the target column)
+  size_t numberOfColumns;
+  /// dimensionality of the samples (zero if no input has been read)
+  size_t dimension;
+  /// number of samples of the input (cached, -1 if unknown)
+  mutable size_t numberOfSamples;
+
+  /// chunk that is currently handed out by #getNextSamples
+  Chunk currentChunk;
+  /// number of samples of currentChunk that have been handed out
+  size_t currentChunkPosition;
+
+  /// background thread
+  std::thread producer;
+  /// protects the following members, which are shared with the background thread
+  mutable std::mutex mutex;
+  /// notifies the background thread that there is space in the queue (or that it should stop)
+  std::condition_variable queueNotFull;
+  /// notifies the caller that there is a new chunk in the queue (or that the input has ended)
+  std::condition_variable queueNotEmpty;
+  /// parsed chunks
+  std::deque<Chunk> queue;
+  /// whether the background thread has finished
+  bool isProducerFinished;
+  /// whether the background thread should stop
+  bool isStopRequested;
+  /// exception of the background thread
+  std::exception_ptr producerException;
+};
+} /* namespace datadriven */
+} /* namespace sgpp */
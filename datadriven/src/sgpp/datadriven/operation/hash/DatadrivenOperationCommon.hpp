@@ -33,7 +33,8 @@ enum class OperationMultipleEvalSubType {
   OCLMASKMP,
   OCLOPT,
   OCLUNIFIED,
-  CUDA
+  CUDA,
+  NAIVE
 };
 
 enum class OperationMultipleEvalMPIType { NONE, MASTERSLAVE, HPX };
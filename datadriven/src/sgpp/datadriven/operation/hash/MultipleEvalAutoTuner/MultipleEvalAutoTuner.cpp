@@ -0,0 +1,433 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/MultipleEvalAutoTuner/MultipleEvalAutoTuner.hpp>
+
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
+#include <sgpp/base/tools/OperationConfiguration.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/base/tools/json/JSON.hpp>
+#include <sgpp/base/tools/json/json_exception.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+const std::vector<std::pair<OperationMultipleEvalType, std::string>> typeNames = {
+    {OperationMultipleEvalType::DEFAULT, "DEFAULT"},
+    {OperationMultipleEvalType::STREAMING, "STREAMING"},
+    {OperationMultipleEvalType::SUBSPACELINEAR, "SUBSPACELINEAR"},
+    {OperationMultipleEvalType::MORTONORDER, "MORTONORDER"}};
+
+const std::vector<std::pair<OperationMultipleEvalSubType, std::string>> subTypeNames = {
+    {OperationMultipleEvalSubType::DEFAULT, "DEFAULT"},
+    {OperationMultipleEvalSubType::SIMPLE, "SIMPLE"},
+    {OperationMultipleEvalSubType::COMBINED, "COMBINED"},
+    {OperationMultipleEvalSubType::NAIVE, "NAIVE"}};
+
+template <class T>
+std::string toString(const std::vector<std::pair<T, std::string>>& names, T value) {
+  for (const auto& entry : names) {
+    if (entry.first == value) {
+      return entry.second;
+    }
+  }
+
+  return "UNKNOWN";
+}
+
+template <class T>
+bool fromString(const std::vector<std::pair<T, std::string>>& names, const std::string& name,
+                T& value) {
+  for (const auto& entry : names) {
+    if (entry.second == name) {
+      value = entry.first;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @return cache of the configurations in memory and the mutex that protects it
+ */
+std::map<std::string, OperationMultipleEvalConfiguration>& memoryCache() {
+  static std::map<std::string, OperationMultipleEvalConfiguration> cache;
+  return cache;
+}
+
+std::mutex& memoryCacheMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+OperationMultipleEvalConfiguration createStreamingConfiguration(size_t chunkGridPoints,
+                                                                size_t chunkDataPoints) {
+  base::OperationConfiguration parameters;
+  parameters.addIDAttr("CHUNK_GRID_POINTS", static_cast<uint64_t>(chunkGridPoints));
+  parameters.addIDAttr("CHUNK_DATA_POINTS", static_cast<uint64_t>(chunkDataPoints));
+  return OperationMultipleEvalConfiguration(OperationMultipleEvalType::STREAMING,
+                                            OperationMultipleEvalSubType::DEFAULT, parameters,
+                                            "STREAMING");
+}
+
+}  // namespace
+
+MultipleEvalAutoTuner::MultipleEvalAutoTuner(const std::string& cacheFileName,
+                                             size_t sampleSize, size_t repetitions)
+    : cacheFileName(cacheFileName),
+      sampleSize(std::max<size_t>(sampleSize, 1)),
+      repetitions(std::max<size_t>(repetitions, 1)) {}
+
+OperationMultipleEvalConfiguration MultipleEvalAutoTuner::tune(base::Grid& grid,
+                                                               base::DataMatrix& dataset) {
+  const std::string key = getCacheKey(grid);
+  std::lock_guard<std::mutex> lock(memoryCacheMutex());
+  auto it = memoryCache().find(key);
+
+  if (it != memoryCache().end()) {
+    return it->second;
+  }
+
+  OperationMultipleEvalConfiguration configuration;
+
+  if (loadFromFile(key, configuration)) {
+    memoryCache()[key] = configuration;
+    return configuration;
+  }
+
+  return measureAndCache(grid, dataset);
+}
+
+OperationMultipleEvalConfiguration MultipleEvalAutoTuner::retune(base::Grid& grid,
+                                                                 base::DataMatrix& dataset) {
+  std::lock_guard<std::mutex> lock(memoryCacheMutex());
+  return measureAndCache(grid, dataset);
+}
+
+OperationMultipleEvalConfiguration MultipleEvalAutoTuner::measureAndCache(
+    base::Grid& grid, base::DataMatrix& dataset) {
+  // evenly spaced sample of the data points
+  const size_t numberDataPoints = dataset.getNrows();
+  const size_t stride = std::max<size_t>((numberDataPoints + sampleSize - 1) / sampleSize, 1);
+  base::DataMatrix sample(0, dataset.getNcols());
+  base::DataVector row(dataset.getNcols());
+
+  for (size_t i = 0; i < numberDataPoints; i += stride) {
+    dataset.getRow(i, row);
+    sample.appendRow(row);
+  }
+
+  // all candidates must compute the same as the default operation
+  base::DataVector alpha(grid.getSize());
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = distribution(generator);
+  }
+
+  base::DataVector referenceResult(sample.getNrows());
+  std::unique_ptr<base::OperationMultipleEval> reference(
+      op_factory::createOperationMultipleEval(grid, sample));
+  reference->mult(alpha, referenceResult);
+
+  OperationMultipleEvalConfiguration best;
+  double bestDuration = std::numeric_limits<double>::infinity();
+
+  for (OperationMultipleEvalConfiguration& candidate : getCandidates(grid)) {
+    const double duration = measure(grid, sample, candidate, referenceResult);
+
+    if (duration < bestDuration) {
+      bestDuration = duration;
+      best = candidate;
+    }
+  }
+
+  const std::string key = getCacheKey(grid);
+  memoryCache()[key] = best;
+  saveToFile(key, best, bestDuration);
+  return best;
+}
+
+std::vector<OperationMultipleEvalConfiguration> MultipleEvalAutoTuner::getCandidates(
+    base::Grid& grid) const {
+  std::vector<OperationMultipleEvalConfiguration> candidates;
+  candidates.emplace_back(OperationMultipleEvalType::DEFAULT,
+                          OperationMultipleEvalSubType::DEFAULT);
+  candidates.emplace_back(OperationMultipleEvalType::DEFAULT, OperationMultipleEvalSubType::NAIVE);
+
+  if (grid.getType() == base::GridType::Linear) {
+    // chunk sizes of the streaming kernel
+    const size_t unrolling = OperationMultiEvalStreaming::getDataPointsUnrolling(
+        OperationMultiEvalStreaming::getBestInstructionSet());
+    const bool fixedDataChunk = (OperationMultiEvalStreaming::getBestInstructionSet() ==
+                                 base::InstructionSet::AVX512F);
+
+    for (size_t chunkGridPoints : {6, 12, 24, 48}) {
+      for (size_t factor : {1, 2, 4}) {
+        if (fixedDataChunk && (factor > 1)) {
+          continue;
+        }
+
+        candidates.push_back(createStreamingConfiguration(chunkGridPoints, factor * unrolling));
+      }
+    }
+
+    candidates.emplace_back(OperationMultipleEvalType::SUBSPACELINEAR,
+                            OperationMultipleEvalSubType::COMBINED);
+    candidates.emplace_back(OperationMultipleEvalType::SUBSPACELINEAR,
+                            OperationMultipleEvalSubType::SIMPLE);
+  } else {
+    candidates.emplace_back(OperationMultipleEvalType::STREAMING,
+                            OperationMultipleEvalSubType::DEFAULT);
+    candidates.emplace_back(OperationMultipleEvalType::MORTONORDER,
+                            OperationMultipleEvalSubType::DEFAULT);
+  }
+
+  return candidates;
+}
+
+double MultipleEvalAutoTuner::measure(base::Grid& grid, base::DataMatrix& sample,
+                                      OperationMultipleEvalConfiguration& configuration,
+                                      const base::DataVector& referenceResult) const {
+  const double infinity = std::numeric_limits<double>::infinity();
+  std::unique_ptr<base::OperationMultipleEval> operation;
+
+  // candidates that are not available for the grid type or on this machine are skipped
+  try {
+    operation.reset(createOperation(grid, sample, configuration));
+  } catch (const std::exception&) {
+    return infinity;
+  }
+
+  base::DataVector alpha(grid.getSize());
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = distribution(generator);
+  }
+
+  base::DataVector result(sample.getNrows());
+  base::DataVector resultTranspose(grid.getSize());
+  operation->mult(alpha, result);
+
+  // reject candidates with wrong results (e.g., unsupported boundary treatment)
+  const double tolerance = 1e-8 * std::max(referenceResult.maxNorm(), 1.0);
+
+  for (size_t i = 0; i < result.getSize(); i++) {
+    if (!(std::abs(result[i] - referenceResult[i]) <= tolerance)) {
+      return infinity;
+    }
+  }
+
+  base::SGppStopwatch stopwatch;
+  double bestDuration = infinity;
+
+  for (size_t r = 0; r < repetitions; r++) {
+    stopwatch.start();
+    operation->mult(alpha, result);
+    operation->multTranspose(result, resultTranspose);
+    bestDuration = std::min(bestDuration, stopwatch.stop());
+  }
+
+  return bestDuration;
+}
+
+base::OperationMultipleEval* MultipleEvalAutoTuner::createOperation(
+    base::Grid& grid, base::DataMatrix& dataset,
+    OperationMultipleEvalConfiguration& configuration) {
+  if (configuration.getType() == OperationMultipleEvalType::DEFAULT) {
+    if (configuration.getSubType() == OperationMultipleEvalSubType::NAIVE) {
+      return op_factory::createOperationMultipleEvalNaive(grid, dataset);
+    } else {
+      return op_factory::createOperationMultipleEval(grid, dataset);
+    }
+  }
+
+  return op_factory::createOperationMultipleEval(grid, dataset, configuration);
+}
+
+std::string MultipleEvalAutoTuner::getCacheKey(base::Grid& grid) const {
+  size_t sizeClass = 1;
+
+  while (sizeClass < grid.getSize()) {
+    sizeClass *= 2;
+  }
+
+  size_t threadCount = 1;
+#ifdef _OPENMP
+  threadCount = static_cast<size_t>(omp_get_max_threads());
+#endif
+
+  std::stringstream stream;
+  stream << grid.getTypeAsString() << "_dim" << grid.getDimension() << "_size" << sizeClass
+         << "_" << base::CPUFeatures::getCPUModel() << "_"
+         << base::CPUFeatures::toString(base::CPUFeatures::getBestInstructionSet())
+         << "_threads" << threadCount;
+
+  // JSON keys without special characters
+  std::string key = stream.str();
+
+  for (char& c : key) {
+    if (!std::isalnum(static_cast<unsigned char>(c))) {
+      c = '_';
+    }
+  }
+
+  return key;
+}
+
+const std::string& MultipleEvalAutoTuner::getCacheFileName() const { return cacheFileName; }
+
+bool MultipleEvalAutoTuner::isAutoTuningEnabled(base::Grid& grid, base::DataMatrix& dataset) {
+  const char* value = std::getenv("SGPP_MULTIEVAL_AUTOTUNING");
+
+  if ((value != nullptr) && (std::string(value) == "0")) {
+    return false;
+  }
+
+  return grid.getSize() * dataset.getNrows() >= getMinimumProblemSize();
+}
+
+size_t MultipleEvalAutoTuner::getMinimumProblemSize() {
+  // below, the operation takes only a few milliseconds and tuning does not pay off
+  return static_cast<size_t>(1) << 27;
+}
+
+std::string MultipleEvalAutoTuner::getDefaultCacheFileName() {
+  const char* fileName = std::getenv("SGPP_MULTIEVAL_TUNING_FILE");
+
+  if (fileName != nullptr) {
+    return fileName;
+  }
+
+  const char* home = std::getenv("HOME");
+
+  if (home != nullptr) {
+    return std::string(home) + "/.sgpp_multieval_tuning.json";
+  }
+
+  return "";
+}
+
+void MultipleEvalAutoTuner::clearMemoryCache() {
+  std::lock_guard<std::mutex> lock(memoryCacheMutex());
+  memoryCache().clear();
+}
+
+bool MultipleEvalAutoTuner::loadFromFile(const std::string& key,
+                                         OperationMultipleEvalConfiguration& configuration) {
+  if (cacheFileName.empty()) {
+    return false;
+  }
+
+  try {
+    json::JSON file(cacheFileName);
+
+    if (!file.contains(key)) {
+      return false;
+    }
+
+    json::Node& entry = file[key];
+    OperationMultipleEvalType type;
+    OperationMultipleEvalSubType subType;
+
+    if (!fromString(typeNames, entry["TYPE"].get(), type) ||
+        !fromString(subTypeNames, entry["SUBTYPE"].get(), subType)) {
+      return false;
+    }
+
+    if (entry.contains("CHUNK_GRID_POINTS") && entry.contains("CHUNK_DATA_POINTS")) {
+      configuration = createStreamingConfiguration(entry["CHUNK_GRID_POINTS"].getUInt(),
+                                                   entry["CHUNK_DATA_POINTS"].getUInt());
+    } else {
+      configuration = OperationMultipleEvalConfiguration(type, subType);
+    }
+
+    return true;
+  } catch (const json::json_exception&) {
+    // missing or invalid cache file
+    return false;
+  }
+}
+
+void MultipleEvalAutoTuner::saveToFile(const std::string& key,
+                                       OperationMultipleEvalConfiguration& configuration,
+                                       double duration) {
+  if (cacheFileName.empty()) {
+    return;
+  }
+
+  json::JSON file;
+
+  try {
+    file = json::JSON(cacheFileName);
+  } catch (const json::json_exception&) {
+    // start a new cache file
+  }
+
+  json::Node& entry = file.contains(key) ? file.replaceDictAttr(key) : file.addDictAttr(key);
+  entry.addTextAttr("TYPE", toString(typeNames, configuration.getType()));
+  entry.addTextAttr("SUBTYPE", toString(subTypeNames, configuration.getSubType()));
+  entry.addIDAttr("DURATION", duration);
+
+  std::shared_ptr<base::OperationConfiguration> parameters = configuration.getParameters();
+
+  if ((parameters != nullptr) && parameters->contains("CHUNK_GRID_POINTS") &&
+      parameters->contains("CHUNK_DATA_POINTS")) {
+    entry.addIDAttr("CHUNK_GRID_POINTS", (*parameters)["CHUNK_GRID_POINTS"].getUInt());
+    entry.addIDAttr("CHUNK_DATA_POINTS", (*parameters)["CHUNK_DATA_POINTS"].getUInt());
+  }
+
+  // write a temporary file and rename it, such that other processes never read a partially
+  // written cache file
+  std::random_device randomDevice;
+  const std::string temporaryFileName =
+      cacheFileName + ".tmp" + std::to_string(static_cast<uint64_t>(randomDevice()));
+
+  try {
+    file.serialize(temporaryFileName);
+  } catch (const std::exception&) {
+    // the cache file is optional
+    std::remove(temporaryFileName.c_str());
+    return;
+  }
+
+  if (std::rename(temporaryFileName.c_str(), cacheFileName.c_str()) != 0) {
+    std::remove(temporaryFileName.c_str());
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
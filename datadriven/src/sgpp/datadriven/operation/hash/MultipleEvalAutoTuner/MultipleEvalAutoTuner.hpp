@@ -0,0 +1,145 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Selects the fastest CPU implementation of OperationMultipleEval for a grid and a dataset.
+ *
+ * The candidates are the default and the naive operation of the base module, the streaming
+ * operations (for linear grids with several chunk sizes), the subspace operations, and the
+ * Morton-ordered operation, as far as they are available for the grid type. Every candidate
+ * is created for a sample of the data points, checked against the default operation, and
+ * timed with mult and multTranspose.
+ *
+ * The winning configuration is cached in memory and in a JSON file (which is replaced by
+ * renaming a temporary file). The key consists of the grid type, the dimension, the grid size
+ * (rounded up to a power of two, so that the result can be reused during refinement), the CPU
+ * model, the instruction set, and the number of OpenMP threads. Tuning is serialized by the
+ * mutex of the memory cache, such that measurements of different threads do not interfere.
+ *
+ * createOperationMultipleEval with the configuration DEFAULT/DEFAULT uses the tuner if the
+ * number of pairs of grid and data points is at least getMinimumProblemSize and auto-tuning
+ * is not disabled with the environment variable SGPP_MULTIEVAL_AUTOTUNING=0. The cache file
+ * can be set with the environment variable SGPP_MULTIEVAL_TUNING_FILE (default:
+ * $HOME/.sgpp_multieval_tuning.json).
+ */
+class MultipleEvalAutoTuner {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param cacheFileName name of the JSON file with the cached configurations
+   *                      (empty to cache only in memory)
+   * @param sampleSize    maximal number of data points used for the measurements
+   * @param repetitions   number of measurements per candidate (the fastest one counts)
+   */
+  explicit MultipleEvalAutoTuner(const std::string& cacheFileName = getDefaultCacheFileName(),
+                                 size_t sampleSize = 2000, size_t repetitions = 3);
+
+  /**
+   * Returns the fastest configuration for the grid and the dataset, either from the cache
+   * or by measuring all candidates.
+   *
+   * @param grid      grid
+   * @param dataset   data points (one per row)
+   * @return          fastest configuration (DEFAULT/DEFAULT for the default operation
+   *                  of the base module, DEFAULT/NAIVE for the naive operation)
+   */
+  OperationMultipleEvalConfiguration tune(base::Grid& grid, base::DataMatrix& dataset);
+
+  /**
+   * Measures all candidates, regardless of the cache, and updates the cache.
+   *
+   * @param grid      grid
+   * @param dataset   data points (one per row)
+   * @return          fastest configuration
+   */
+  OperationMultipleEvalConfiguration retune(base::Grid& grid, base::DataMatrix& dataset);
+
+  /**
+   * @param grid  grid
+   * @return      key of the grid in the cache
+   */
+  std::string getCacheKey(base::Grid& grid) const;
+
+  /**
+   * @return name of the JSON file with the cached configurations
+   */
+  const std::string& getCacheFileName() const;
+
+  /**
+   * Creates the operation for a configuration returned by tune.
+   *
+   * @param grid          grid
+   * @param dataset       data points (one per row)
+   * @param configuration configuration
+   * @return              new operation
+   */
+  static base::OperationMultipleEval* createOperation(
+      base::Grid& grid, base::DataMatrix& dataset,
+      OperationMultipleEvalConfiguration& configuration);
+
+  /**
+   * @param grid      grid
+   * @param dataset   data points (one per row)
+   * @return          whether DEFAULT/DEFAULT should be auto-tuned for the grid and the dataset
+   */
+  static bool isAutoTuningEnabled(base::Grid& grid, base::DataMatrix& dataset);
+
+  /**
+   * @return minimal number of pairs of grid and data points for which DEFAULT/DEFAULT is
+   *         auto-tuned
+   */
+  static size_t getMinimumProblemSize();
+
+  /**
+   * @return default name of the cache file (see class description)
+   */
+  static std::string getDefaultCacheFileName();
+
+  /**
+   * Clears the cache in memory (the cache file is not changed).
+   */
+  static void clearMemoryCache();
+
+ private:
+  std::string cacheFileName;
+  size_t sampleSize;
+  size_t repetitions;
+
+  /**
+   * Measures all candidates and updates the cache (the cache mutex must be locked).
+   */
+  OperationMultipleEvalConfiguration measureAndCache(base::Grid& grid,
+                                                     base::DataMatrix& dataset);
+
+  std::vector<OperationMultipleEvalConfiguration> getCandidates(base::Grid& grid) const;
+
+  double measure(base::Grid& grid, base::DataMatrix& sample,
+                 OperationMultipleEvalConfiguration& configuration,
+                 const base::DataVector& referenceResult) const;
+
+  bool loadFromFile(const std::string& key, OperationMultipleEvalConfiguration& configuration);
+
+  void saveToFile(const std::string& key, OperationMultipleEvalConfiguration& configuration,
+                  double duration);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -12,11 +12,42 @@ namespace datadriven {
 
 OperationMultiEvalStreaming::OperationMultiEvalStreaming(base::Grid& grid,
                                                          base::DataMatrix& dataset)
+    : OperationMultiEvalStreaming(grid, dataset, getBestInstructionSet()) {}
+
+OperationMultiEvalStreaming::OperationMultiEvalStreaming(base::Grid& grid,
+                                                         base::DataMatrix& dataset,
+                                                         base::InstructionSet instructionSet)
+    : OperationMultiEvalStreaming(grid, dataset, instructionSet, 12,
+                                  getDataPointsUnrolling(instructionSet)) {}
+
+OperationMultiEvalStreaming::OperationMultiEvalStreaming(base::Grid& grid,
+                                                         base::DataMatrix& dataset,
+                                                         base::InstructionSet instructionSet,
+                                                         size_t chunkGridPoints,
+                                                         size_t chunkDataPoints)
     : OperationMultipleEval(grid, dataset),
       preparedDataset(dataset),
       myTimer_(sgpp::base::SGppStopwatch()),
+      instructionSet(instructionSet),
+      chunkGridPoints(chunkGridPoints),
+      chunkDataPoints(chunkDataPoints),
       duration(-1.0) {
+  if (!isInstructionSetAvailable(instructionSet)) {
+    throw sgpp::base::operation_exception(
+        "OperationMultiEvalStreaming: no kernel available for the requested instruction set");
+  }
+
+  const size_t unrolling = getDataPointsUnrolling(instructionSet);
+
+  // the AVX-512 kernels process exactly one chunk of data points per iteration
+  if ((chunkGridPoints == 0) || (chunkDataPoints == 0) || (chunkDataPoints % unrolling != 0) ||
+      ((instructionSet == base::InstructionSet::AVX512F) && (chunkDataPoints != unrolling))) {
+    throw sgpp::base::operation_exception(
+        "OperationMultiEvalStreaming: invalid number of grid or data points per chunk");
+  }
+
   this->storage = &grid.getStorage();
+  // the padding depends on the instruction set
   this->padDataset(this->preparedDataset);
   this->preparedDataset.transpose();
 
@@ -79,14 +110,16 @@ void OperationMultiEvalStreaming::getOpenMPPartitionSegment(size_t start, size_t
 
 size_t OperationMultiEvalStreaming::getChunkGridPoints() {
   // not used by the MIC-implementation
-  return 12;
+  return this->chunkGridPoints;
 }
-size_t OperationMultiEvalStreaming::getChunkDataPoints() {
-#if defined(__MIC__) || defined(__AVX512F__)
-  return STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH;
-#else
-  return 24;  // must be divisible by 24
-#endif
+size_t OperationMultiEvalStreaming::getChunkDataPoints() { return this->chunkDataPoints; }
+
+size_t OperationMultiEvalStreaming::getDataPointsUnrolling(base::InstructionSet instructionSet) {
+  if (instructionSet == base::InstructionSet::AVX512F) {
+    return STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH;
+  } else {
+    return 24;
+  }
 }
 
 void OperationMultiEvalStreaming::mult(sgpp::base::DataVector& alpha,
@@ -178,6 +211,57 @@ size_t OperationMultiEvalStreaming::padDataset(sgpp::base::DataMatrix& dataset)
 
 double OperationMultiEvalStreaming::getDuration() { return this->duration; }
 
+base::InstructionSet OperationMultiEvalStreaming::getInstructionSet() const {
+  return this->instructionSet;
+}
+
+bool OperationMultiEvalStreaming::isInstructionSetAvailable(base::InstructionSet instructionSet) {
+  bool compiled = false;
+
+  switch (instructionSet) {
+    case base::InstructionSet::SCALAR:
+      compiled = true;
+      break;
+    case base::InstructionSet::SSE3:
+#ifdef STREAMING_LINEAR_KERNEL_SSE3
+      compiled = true;
+#endif
+      break;
+    case base::InstructionSet::AVX:
+      // there is no kernel for AVX without AVX2
+      break;
+    case base::InstructionSet::AVX2:
+#ifdef STREAMING_LINEAR_KERNEL_AVX2
+      compiled = true;
+#endif
+      break;
+    case base::InstructionSet::AVX512F:
+#ifdef STREAMING_LINEAR_KERNEL_AVX512
+      compiled = true;
+#endif
+      break;
+  }
+
+#ifdef SGPP_RUNTIME_ISA_DISPATCH
+  return compiled && base::CPUFeatures::isSupported(instructionSet);
+#else
+  // the kernels are only compiled if the instruction set is enabled at compile time
+  return compiled && (static_cast<int>(instructionSet) <=
+                      static_cast<int>(base::CPUFeatures::getMaximumInstructionSet()));
+#endif
+}
+
+base::InstructionSet OperationMultiEvalStreaming::getBestInstructionSet() {
+  for (base::InstructionSet instructionSet :
+       {base::InstructionSet::AVX512F, base::InstructionSet::AVX2, base::InstructionSet::SSE3}) {
+    if (isInstructionSetAvailable(instructionSet)) {
+      return instructionSet;
+    }
+  }
+
+  return base::InstructionSet::SCALAR;
+}
+
 void OperationMultiEvalStreaming::prepare() { this->recalculateLevelAndIndex(); }
 }  // namespace datadriven
 }  // namespace sgpp
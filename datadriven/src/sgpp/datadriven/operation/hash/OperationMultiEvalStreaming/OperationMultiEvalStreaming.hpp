@@ -11,6 +11,7 @@
 
 #include <sgpp/base/exception/operation_exception.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
 #include <sgpp/base/tools/SGppStopwatch.hpp>
 #include <sgpp/globaldef.hpp>
 
@@ -19,9 +20,29 @@
 #define STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH 96
 #endif
 
+// kernels that are compiled into the library (with runtime dispatch, all x86 kernels are)
+#if defined(SGPP_RUNTIME_ISA_DISPATCH) || defined(__SSE3__)
+#define STREAMING_LINEAR_KERNEL_SSE3
+#endif
+#if defined(SGPP_RUNTIME_ISA_DISPATCH) || (defined(__AVX2__) && defined(__FMA__))
+#define STREAMING_LINEAR_KERNEL_AVX2
+#endif
+#if defined(SGPP_RUNTIME_ISA_DISPATCH) || defined(__AVX512F__) || defined(__MIC__)
+#define STREAMING_LINEAR_KERNEL_AVX512
+#endif
+
 namespace sgpp {
 namespace datadriven {
 
+/**
+ * Streaming evaluation of linear sparse grid functions on the CPU.
+ *
+ * The kernel is implemented for several instruction sets (scalar, SSE3, AVX2 with FMA, and
+ * AVX-512). The newest one that is supported by the CPU (see base::CPUFeatures) is chosen
+ * when the operation is created, so a single library can be used on different CPUs.
+ * Without runtime dispatch (see SGPP_RUNTIME_ISA_DISPATCH), the AVX2 kernel is the AVX kernel
+ * of the compile-time flags.
+ */
 class OperationMultiEvalStreaming : public base::OperationMultipleEval {
  protected:
   sgpp::base::DataMatrix preparedDataset;
@@ -34,17 +55,63 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
 
   base::GridStorage* storage;
 
+  /// instruction set of the kernel
+  base::InstructionSet instructionSet;
+  /// number of grid points that are processed at once
+  size_t chunkGridPoints;
+  /// number of data points that are processed at once
+  size_t chunkDataPoints;
+
   double duration;
 
  public:
+  /**
+   * Constructor, uses the kernel for the newest instruction set supported by the CPU.
+   *
+   * @param grid      linear grid
+   * @param dataset   data points (one per row)
+   */
   OperationMultiEvalStreaming(base::Grid& grid, base::DataMatrix& dataset);
 
+  /**
+   * Constructor, uses the kernel for the given instruction set.
+   *
+   * @param grid            linear grid
+   * @param dataset         data points (one per row)
+   * @param instructionSet  instruction set of the kernel (must be available,
+   *                        see isInstructionSetAvailable)
+   */
+  OperationMultiEvalStreaming(base::Grid& grid, base::DataMatrix& dataset,
+                              base::InstructionSet instructionSet);
+
+  /**
+   * Constructor, uses the kernel for the given instruction set and the given block sizes.
+   *
+   * @param grid            linear grid
+   * @param dataset         data points (one per row)
+   * @param instructionSet  instruction set of the kernel (must be available,
+   *                        see isInstructionSetAvailable)
+   * @param chunkGridPoints number of grid points that are processed at once (positive)
+   * @param chunkDataPoints number of data points that are processed at once (positive multiple
+   *                        of getDataPointsUnrolling, equal to it for AVX-512)
+   */
+  OperationMultiEvalStreaming(base::Grid& grid, base::DataMatrix& dataset,
+                              base::InstructionSet instructionSet, size_t chunkGridPoints,
+                              size_t chunkDataPoints);
+
   ~OperationMultiEvalStreaming() override;
 
   size_t getChunkGridPoints();
 
   size_t getChunkDataPoints();
 
+  /**
+   * @param instructionSet  instruction set
+   * @return                number of data points the kernel of the instruction set processes
+   *                        at once (default number of data points per chunk)
+   */
+  static size_t getDataPointsUnrolling(base::InstructionSet instructionSet);
+
   void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) override;
 
   void multTranspose(sgpp::base::DataVector& source, sgpp::base::DataVector& result) override;
@@ -53,6 +120,23 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
 
   double getDuration() override;
 
+  /**
+   * @return instruction set of the kernel that is used
+   */
+  base::InstructionSet getInstructionSet() const;
+
+  /**
+   * @param instructionSet  instruction set
+   * @return                whether there is a kernel for the instruction set that
+   *                        can be used on this CPU
+   */
+  static bool isInstructionSetAvailable(base::InstructionSet instructionSet);
+
+  /**
+   * @return newest instruction set for which a kernel is available
+   */
+  static base::InstructionSet getBestInstructionSet();
+
  private:
   void getPartitionSegment(size_t start, size_t end, size_t segmentCount, size_t segmentNumber,
                            size_t* segmentStart, size_t* segmentEnd, size_t blockSize);
@@ -74,6 +158,60 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
                          const size_t end_index_grid, const size_t start_index_data,
                          const size_t end_index_data);
 
+#ifdef STREAMING_LINEAR_KERNEL_SSE3
+  void multImplSSE3(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
+                    sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
+                    sgpp::base::DataVector& result, const size_t start_index_grid,
+                    const size_t end_index_grid, const size_t start_index_data,
+                    const size_t end_index_data);
+
+  void multTransposeImplSSE3(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
+                             sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
+                             sgpp::base::DataVector& result, const size_t start_index_grid,
+                             const size_t end_index_grid, const size_t start_index_data,
+                             const size_t end_index_data);
+#endif
+
+#ifdef STREAMING_LINEAR_KERNEL_AVX2
+  void multImplAVX2(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
+                    sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
+                    sgpp::base::DataVector& result, const size_t start_index_grid,
+                    const size_t end_index_grid, const size_t start_index_data,
+                    const size_t end_index_data);
+
+  void multTransposeImplAVX2(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
+                             sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
+                             sgpp::base::DataVector& result, const size_t start_index_grid,
+                             const size_t end_index_grid, const size_t start_index_data,
+                             const size_t end_index_data);
+#endif
+
+#ifdef STREAMING_LINEAR_KERNEL_AVX512
+  void multImplAVX512(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
+                      sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
+                      sgpp::base::DataVector& result, const size_t start_index_grid,
+                      const size_t end_index_grid, const size_t start_index_data,
+                      const size_t end_index_data);
+
+  void multTransposeImplAVX512(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
+                               sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
+                               sgpp::base::DataVector& result, const size_t start_index_grid,
+                               const size_t end_index_grid, const size_t start_index_data,
+                               const size_t end_index_data);
+#endif
+
+  void multImplScalar(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
+                      sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
+                      sgpp::base::DataVector& result, const size_t start_index_grid,
+                      const size_t end_index_grid, const size_t start_index_data,
+                      const size_t end_index_data);
+
+  void multTransposeImplScalar(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
+                               sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
+                               sgpp::base::DataVector& result, const size_t start_index_grid,
+                               const size_t end_index_grid, const size_t start_index_data,
+                               const size_t end_index_data);
+
   void recalculateLevelAndIndex();
 };
 
@@ -6,29 +6,66 @@
 #include <algorithm>
 #include <cmath>
 
-#if defined(__SSE3__) && !defined(__AVX__)
-#include <pmmintrin.h>
-#endif
-
-#if defined(__SSE3__) && defined(__AVX__)
-#include <immintrin.h>
-#endif
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
+#include <sgpp/globaldef.hpp>
 
-#if defined(__MIC__)
+#if defined(STREAMING_LINEAR_KERNEL_AVX2) || defined(STREAMING_LINEAR_KERNEL_AVX512)
 #include <immintrin.h>  // NOLINT(build/include)
+#elif defined(STREAMING_LINEAR_KERNEL_SSE3)
+#include <pmmintrin.h>
 #endif
 
-#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
-#include <sgpp/globaldef.hpp>
-
 namespace sgpp {
 namespace datadriven {
 
-#if defined(__SSE3__) && !defined(__AVX__) && !defined(__AVX512F__)
 void OperationMultiEvalStreaming::multImpl(
     sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
     const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  switch (this->instructionSet) {
+#ifdef STREAMING_LINEAR_KERNEL_AVX512
+    case base::InstructionSet::AVX512F:
+      multImplAVX512(level, index, dataset, alpha, result, start_index_grid, end_index_grid,
+                     start_index_data, end_index_data);
+      break;
+#endif
+#ifdef STREAMING_LINEAR_KERNEL_AVX2
+    case base::InstructionSet::AVX2:
+      multImplAVX2(level, index, dataset, alpha, result, start_index_grid, end_index_grid,
+                   start_index_data, end_index_data);
+      break;
+#endif
+#ifdef STREAMING_LINEAR_KERNEL_SSE3
+    case base::InstructionSet::SSE3:
+      multImplSSE3(level, index, dataset, alpha, result, start_index_grid, end_index_grid,
+                   start_index_data, end_index_data);
+      break;
+#endif
+    // there is no kernel for AVX without AVX2, and kernels that are not compiled are never
+    // selected (see isInstructionSetAvailable)
+    case base::InstructionSet::SCALAR:
+    case base::InstructionSet::AVX:
+#ifndef STREAMING_LINEAR_KERNEL_SSE3
+    case base::InstructionSet::SSE3:
+#endif
+#ifndef STREAMING_LINEAR_KERNEL_AVX2
+    case base::InstructionSet::AVX2:
+#endif
+#ifndef STREAMING_LINEAR_KERNEL_AVX512
+    case base::InstructionSet::AVX512F:
+#endif
+      multImplScalar(level, index, dataset, alpha, result, start_index_grid, end_index_grid,
+                     start_index_data, end_index_data);
+      break;
+  }
+}
+
+#ifdef STREAMING_LINEAR_KERNEL_SSE3
+SGPP_TARGET("sse3")
+void OperationMultiEvalStreaming::multImplSSE3(
+    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
+    sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
   double* ptrLevel = level->getPointer();
   double* ptrIndex = index->getPointer();
   double* ptrAlpha = alpha.getPointer();
@@ -147,8 +184,9 @@ void OperationMultiEvalStreaming::multImpl(
 }
 #endif
 
-#if defined(__SSE3__) && defined(__AVX__) && !defined(__AVX512F__)
-void OperationMultiEvalStreaming::multImpl(
+#ifdef STREAMING_LINEAR_KERNEL_AVX2
+SGPP_TARGET("avx2,fma")
+void OperationMultiEvalStreaming::multImplAVX2(
     sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
     const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
@@ -205,21 +243,12 @@ void OperationMultiEvalStreaming::multImpl(
             eval_4 = _mm256_msub_pd(eval_4, level, index);
             eval_5 = _mm256_msub_pd(eval_5, level, index);
 #else
-#ifdef __AVX2__
             eval_0 = _mm256_fmsub_pd(eval_0, level, index);
             eval_1 = _mm256_fmsub_pd(eval_1, level, index);
             eval_2 = _mm256_fmsub_pd(eval_2, level, index);
             eval_3 = _mm256_fmsub_pd(eval_3, level, index);
             eval_4 = _mm256_fmsub_pd(eval_4, level, index);
             eval_5 = _mm256_fmsub_pd(eval_5, level, index);
-#else
-            eval_0 = _mm256_sub_pd(_mm256_mul_pd(eval_0, level), index);
-            eval_1 = _mm256_sub_pd(_mm256_mul_pd(eval_1, level), index);
-            eval_2 = _mm256_sub_pd(_mm256_mul_pd(eval_2, level), index);
-            eval_3 = _mm256_sub_pd(_mm256_mul_pd(eval_3, level), index);
-            eval_4 = _mm256_sub_pd(_mm256_mul_pd(eval_4, level), index);
-            eval_5 = _mm256_sub_pd(_mm256_mul_pd(eval_5, level), index);
-#endif
 #endif
             eval_0 = _mm256_and_pd(mask, eval_0);
             eval_1 = _mm256_and_pd(mask, eval_1);
@@ -277,8 +306,9 @@ void OperationMultiEvalStreaming::multImpl(
 }
 #endif
 
-#if defined(__MIC__) || defined(__AVX512F__)
-void OperationMultiEvalStreaming::multImpl(
+#ifdef STREAMING_LINEAR_KERNEL_AVX512
+SGPP_TARGET("avx512f")
+void OperationMultiEvalStreaming::multImplAVX512(
     sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
     const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
@@ -296,9 +326,11 @@ void OperationMultiEvalStreaming::multImpl(
 #define _mm512_max_pd(A, B) _mm512_gmax_pd(A, B)
 #define _mm512_set1_epi64(A) _mm512_set_1to8_epi64(A)
 #define _mm512_set1_pd(A) _mm512_set_1to8_pd(A)
-#endif
-#if defined(__AVX512F__)
-#define _mm512_broadcast_sd(A) _mm512_broadcastsd_pd(_mm_load_sd(A))
+#else
+// the unmasked intrinsics of GCC pass undefined registers as merge source, which triggers
+// -Wmaybe-uninitialized when the kernel is compiled with a target attribute
+#define _mm512_broadcast_sd(A) _mm512_set1_pd(*(A))
+#define _mm512_max_pd(A, B) _mm512_maskz_max_pd(0xFF, A, B)
 #endif
 
   for (size_t i = start_index_data; i < end_index_data; i += getChunkDataPoints()) {
@@ -573,8 +605,7 @@ void OperationMultiEvalStreaming::multImpl(
 }
 #endif
 
-#if !defined(__SSE3__) && !defined(__AVX__) && !defined(__MIC__) && !defined(__AVX512F__)
-void OperationMultiEvalStreaming::multImpl(
+void OperationMultiEvalStreaming::multImplScalar(
     sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
     const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
@@ -586,8 +617,6 @@ void OperationMultiEvalStreaming::multImpl(
   size_t result_size = result.getSize();
   size_t dims = dataset->getNrows();
 
-#warning "warning: using fallback implementation for OperationMultiEvalStreaming mult kernel"
-
   for (size_t c = start_index_data; c < end_index_data;
        c += std::min<size_t>(getChunkDataPoints(), (end_index_data - c))) {
     size_t data_end = std::min<size_t>((size_t)getChunkDataPoints() + c, end_index_data);
@@ -620,7 +649,6 @@ void OperationMultiEvalStreaming::multImpl(
     }
   }
 }
-#endif
 
 }  // namespace datadriven
 }  // namespace sgpp
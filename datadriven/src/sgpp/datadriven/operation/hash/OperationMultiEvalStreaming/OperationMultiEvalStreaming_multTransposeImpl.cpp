@@ -7,17 +7,12 @@
 #include <sgpp/globaldef.hpp>
 
 #include <algorithm>
+#include <cmath>
 
-#if defined(__SSE3__) && !defined(__AVX__)
-#include <pmmintrin.h>
-#endif
-
-#if defined(__SSE3__) && defined(__AVX__)
-#include <immintrin.h>
-#endif
-
-#if defined(__MIC__)
+#if defined(STREAMING_LINEAR_KERNEL_AVX2) || defined(STREAMING_LINEAR_KERNEL_AVX512)
 #include <immintrin.h>  // NOLINT(build/include)
+#elif defined(STREAMING_LINEAR_KERNEL_SSE3)
+#include <pmmintrin.h>
 #endif
 
 namespace sgpp {
@@ -27,6 +22,50 @@ void OperationMultiEvalStreaming::multTransposeImpl(
     sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
     sgpp::base::DataVector& source, sgpp::base::DataVector& result, const size_t start_index_grid,
     const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  switch (this->instructionSet) {
+#ifdef STREAMING_LINEAR_KERNEL_AVX512
+    case base::InstructionSet::AVX512F:
+      multTransposeImplAVX512(level, index, dataset, source, result, start_index_grid,
+                              end_index_grid, start_index_data, end_index_data);
+      break;
+#endif
+#ifdef STREAMING_LINEAR_KERNEL_AVX2
+    case base::InstructionSet::AVX2:
+      multTransposeImplAVX2(level, index, dataset, source, result, start_index_grid,
+                            end_index_grid, start_index_data, end_index_data);
+      break;
+#endif
+#ifdef STREAMING_LINEAR_KERNEL_SSE3
+    case base::InstructionSet::SSE3:
+      multTransposeImplSSE3(level, index, dataset, source, result, start_index_grid,
+                            end_index_grid, start_index_data, end_index_data);
+      break;
+#endif
+    // there is no kernel for AVX without AVX2, and kernels that are not compiled are never
+    // selected (see isInstructionSetAvailable)
+    case base::InstructionSet::SCALAR:
+    case base::InstructionSet::AVX:
+#ifndef STREAMING_LINEAR_KERNEL_SSE3
+    case base::InstructionSet::SSE3:
+#endif
+#ifndef STREAMING_LINEAR_KERNEL_AVX2
+    case base::InstructionSet::AVX2:
+#endif
+#ifndef STREAMING_LINEAR_KERNEL_AVX512
+    case base::InstructionSet::AVX512F:
+#endif
+      multTransposeImplScalar(level, index, dataset, source, result, start_index_grid,
+                              end_index_grid, start_index_data, end_index_data);
+      break;
+  }
+}
+
+#ifdef STREAMING_LINEAR_KERNEL_SSE3
+SGPP_TARGET("sse3")
+void OperationMultiEvalStreaming::multTransposeImplSSE3(
+    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
+    sgpp::base::DataVector& source, sgpp::base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
   double* ptrLevel = level->getPointer();
   double* ptrIndex = index->getPointer();
   double* ptrSource = source.getPointer();
@@ -35,7 +74,6 @@ void OperationMultiEvalStreaming::multTransposeImpl(
   size_t sourceSize = source.getSize();
   size_t dims = dataset->getNrows();
 
-#if defined(__SSE3__) && !defined(__AVX__) && !defined(__AVX512F__)
 
   for (size_t k = start_index_grid; k < end_index_grid;
        k += std::min<size_t>(getChunkGridPoints(), (end_index_grid - k))) {
@@ -128,9 +166,23 @@ void OperationMultiEvalStreaming::multTransposeImpl(
       }
     }
   }
+}
 #endif
 
-#if defined(__SSE3__) && defined(__AVX__) && !defined(__AVX512F__)
+#ifdef STREAMING_LINEAR_KERNEL_AVX2
+SGPP_TARGET("avx2,fma")
+void OperationMultiEvalStreaming::multTransposeImplAVX2(
+    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
+    sgpp::base::DataVector& source, sgpp::base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  double* ptrLevel = level->getPointer();
+  double* ptrIndex = index->getPointer();
+  double* ptrSource = source.getPointer();
+  double* ptrData = dataset->getPointer();
+  double* ptrResult = result.getPointer();
+  size_t sourceSize = source.getSize();
+  size_t dims = dataset->getNrows();
+
 
   for (size_t k = start_index_grid; k < end_index_grid;
        k += std::min<size_t>(getChunkGridPoints(), (end_index_grid - k))) {
@@ -170,21 +222,12 @@ void OperationMultiEvalStreaming::multTransposeImpl(
           eval_4 = _mm256_msub_pd(eval_4, level, index);
           eval_5 = _mm256_msub_pd(eval_5, level, index);
 #else
-#ifdef __AVX2__
           eval_0 = _mm256_fmsub_pd(eval_0, level, index);
           eval_1 = _mm256_fmsub_pd(eval_1, level, index);
           eval_2 = _mm256_fmsub_pd(eval_2, level, index);
           eval_3 = _mm256_fmsub_pd(eval_3, level, index);
           eval_4 = _mm256_fmsub_pd(eval_4, level, index);
           eval_5 = _mm256_fmsub_pd(eval_5, level, index);
-#else
-          eval_0 = _mm256_sub_pd(_mm256_mul_pd(eval_0, level), index);
-          eval_1 = _mm256_sub_pd(_mm256_mul_pd(eval_1, level), index);
-          eval_2 = _mm256_sub_pd(_mm256_mul_pd(eval_2, level), index);
-          eval_3 = _mm256_sub_pd(_mm256_mul_pd(eval_3, level), index);
-          eval_4 = _mm256_sub_pd(_mm256_mul_pd(eval_4, level), index);
-          eval_5 = _mm256_sub_pd(_mm256_mul_pd(eval_5, level), index);
-#endif
 #endif
           eval_0 = _mm256_and_pd(mask, eval_0);
           eval_1 = _mm256_and_pd(mask, eval_1);
@@ -241,18 +284,35 @@ void OperationMultiEvalStreaming::multTransposeImpl(
       }
     }
   }
+}
 #endif
 
-#if defined(__MIC__) || defined(__AVX512F__)
+#ifdef STREAMING_LINEAR_KERNEL_AVX512
+SGPP_TARGET("avx512f")
+void OperationMultiEvalStreaming::multTransposeImplAVX512(
+    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
+    sgpp::base::DataVector& source, sgpp::base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  double* ptrLevel = level->getPointer();
+  double* ptrIndex = index->getPointer();
+  double* ptrSource = source.getPointer();
+  double* ptrData = dataset->getPointer();
+  double* ptrResult = result.getPointer();
+  size_t sourceSize = source.getSize();
+  size_t dims = dataset->getNrows();
+
+
 #if defined(__MIC__)
 #define _mm512_broadcast_sd(A) \
   _mm512_extload_pd(A, _MM_UPCONV_PD_NONE, _MM_BROADCAST_1X8, _MM_HINT_NONE)
 #define _mm512_max_pd(A, B) _mm512_gmax_pd(A, B)
 #define _mm512_set1_epi64(A) _mm512_set_1to8_epi64(A)
 #define _mm512_set1_pd(A) _mm512_set_1to8_pd(A)
-#endif
-#if defined(__AVX512F__)
-#define _mm512_broadcast_sd(A) _mm512_broadcastsd_pd(_mm_load_sd(A))
+#else
+// the unmasked intrinsics of GCC pass undefined registers as merge source, which triggers
+// -Wmaybe-uninitialized when the kernel is compiled with a target attribute
+#define _mm512_broadcast_sd(A) _mm512_set1_pd(*(A))
+#define _mm512_max_pd(A, B) _mm512_maskz_max_pd(0xFF, A, B)
 #endif
 
   for (size_t i = start_index_data; i < end_index_data; i += getChunkDataPoints()) {
@@ -475,14 +535,32 @@ void OperationMultiEvalStreaming::multTransposeImpl(
 #if (STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH > 64)
       support_0 = _mm512_add_pd(support_0, support_8);
 #endif
+#if defined(__MIC__)
       ptrResult[j] += _mm512_reduce_add_pd(support_0);
+#else
+      // same summation order as _mm512_reduce_add_pd
+      double reduction[8];
+      _mm512_storeu_pd(reduction, support_0);
+      ptrResult[j] += ((reduction[6] + reduction[2]) + (reduction[4] + reduction[0])) +
+                      ((reduction[7] + reduction[3]) + (reduction[5] + reduction[1]));
+#endif
     }
   }
+}
 #endif
 
-#if (!defined(__SSE3__) && !defined(__AVX__)) && !defined(__MIC__) && !defined(__AVX512F__)
-#warning \
-    "warning: using fallback implementation for OperationMultiEvalStreaming multTranspose kernel"
+void OperationMultiEvalStreaming::multTransposeImplScalar(
+    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
+    sgpp::base::DataVector& source, sgpp::base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  double* ptrLevel = level->getPointer();
+  double* ptrIndex = index->getPointer();
+  double* ptrSource = source.getPointer();
+  double* ptrData = dataset->getPointer();
+  double* ptrResult = result.getPointer();
+  size_t sourceSize = source.getSize();
+  size_t dims = dataset->getNrows();
+
 
   for (size_t k = start_index_grid; k < end_index_grid;
        k += std::min<size_t>(getChunkGridPoints(), (end_index_grid - k))) {
@@ -495,7 +573,7 @@ void OperationMultiEvalStreaming::multTransposeImpl(
         for (size_t d = 0; d < dims; d++) {
           double eval = ((ptrLevel[(j * dims) + d]) * (ptrData[(d * sourceSize) + i]));
           double index_calc = eval - (ptrIndex[(j * dims) + d]);
-          double abs = fabs(index_calc);
+          double abs = std::fabs(index_calc);
           double last = 1.0 - abs;
           double localSupport = std::max<double>(last, 0.0);
           curSupport *= localSupport;
@@ -505,7 +583,7 @@ void OperationMultiEvalStreaming::multTransposeImpl(
       }
     }
   }
-#endif
 }
+
 }  // namespace datadriven
 }  // namespace sgpp
@@ -12,12 +12,42 @@ namespace datadriven {
 
 OperationMultiEvalStreamingBSpline::OperationMultiEvalStreamingBSpline(base::Grid& grid,
                                                                        base::DataMatrix& dataset)
+    : OperationMultiEvalStreamingBSpline(grid, dataset, getBestInstructionSet()) {}
+
+OperationMultiEvalStreamingBSpline::OperationMultiEvalStreamingBSpline(
+    base::Grid& grid, base::DataMatrix& dataset, base::InstructionSet instructionSet)
     : OperationMultipleEval(grid, dataset),
       preparedDataset(dataset),
       myTimer_(sgpp::base::SGppStopwatch()),
+      instructionSet(instructionSet),
+      degree(0),
+      modified(false),
       duration(-1.0) {
+  if (!isInstructionSetAvailable(instructionSet)) {
+    throw sgpp::base::operation_exception(
+        "OperationMultiEvalStreamingBSpline: no kernel available for the requested instruction "
+        "set");
+  }
+
+  if (grid.getType() == base::GridType::Bspline) {
+    modified = false;
+  } else if (grid.getType() == base::GridType::ModBspline) {
+    modified = true;
+  } else {
+    throw sgpp::base::operation_exception(
+        "OperationMultiEvalStreamingBSpline: only B-spline and modified B-spline grids "
+        "are supported");
+  }
+
   this->storage = &grid.getStorage();
+  this->degree = grid.getBasis().getDegree();
+
+  if (this->degree > MAX_DEGREE) {
+    throw sgpp::base::operation_exception(
+        "OperationMultiEvalStreamingBSpline: B-spline degree is too high");
+  }
 
+  this->storage->getBoundingBox()->transformPointsToUnitCube(this->preparedDataset);
   this->padDataset(this->preparedDataset);
   this->preparedDataset.transpose();
 
@@ -25,11 +55,7 @@ OperationMultiEvalStreamingBSpline::OperationMultiEvalStreamingBSpline(base::Gri
   this->prepare();
 }
 
-OperationMultiEvalStreamingBSpline::~OperationMultiEvalStreamingBSpline() {
-  if (this->level_ != nullptr) delete this->level_;
-
-  if (this->index_ != nullptr) delete this->index_;
-}
+OperationMultiEvalStreamingBSpline::~OperationMultiEvalStreamingBSpline() {}
 
 void OperationMultiEvalStreamingBSpline::getPartitionSegment(size_t start, size_t end,
                                                              size_t segmentCount,
@@ -72,8 +98,12 @@ void OperationMultiEvalStreamingBSpline::getOpenMPPartitionSegment(size_t start,
                                                                    size_t* segmentStart,
                                                                    size_t* segmentEnd,
                                                                    size_t blocksize) {
-  size_t threadCount = omp_get_num_threads();
-  size_t myThreadNum = omp_get_thread_num();
+  size_t threadCount = 1;
+  size_t myThreadNum = 0;
+#ifdef _OPENMP
+  threadCount = omp_get_num_threads();
+  myThreadNum = omp_get_thread_num();
+#endif
   getPartitionSegment(start, end, threadCount, myThreadNum, segmentStart, segmentEnd, blocksize);
 }
 
@@ -82,9 +112,8 @@ size_t OperationMultiEvalStreamingBSpline::getChunkGridPoints() {
   return 12;
 }
 size_t OperationMultiEvalStreamingBSpline::getChunkDataPoints() {
-  //#else
-  return 8;  // must be divisible by 8
-  //#endif
+  // both kernels process blocks of streamingbspline::DATA_BLOCK_SIZE = 8 data points
+  return 8;
 }
 
 void OperationMultiEvalStreamingBSpline::mult(sgpp::base::DataVector& alpha,
@@ -105,8 +134,7 @@ void OperationMultiEvalStreamingBSpline::mult(sgpp::base::DataVector& alpha,
     getOpenMPPartitionSegment(0, this->preparedDataset.getNcols(), &start, &end,
                               getChunkDataPoints());
 
-    this->multImpl(level_, index_, &this->preparedDataset, alpha, result, 0, alpha.getSize(), start,
-                   end);
+    this->multImpl(alpha, result, 0, this->storage->getSize(), start, end);
   }
   result.resize(originalSize);
   this->duration = this->myTimer_.stop();
@@ -134,24 +162,53 @@ void OperationMultiEvalStreamingBSpline::multTranspose(sgpp::base::DataVector& s
 
     getOpenMPPartitionSegment(0, this->storage->getSize(), &start, &end, 1);
 
-    this->multTransposeImpl(this->level_, this->index_, &this->preparedDataset, source, result,
-                            start, end, 0, this->preparedDataset.getNcols());
+    this->multTransposeImpl(source, result, start, end, 0, this->preparedDataset.getNcols());
   }
   source.resize(originalSize);
   this->duration = this->myTimer_.stop();
 }
 
 void OperationMultiEvalStreamingBSpline::recalculateLevelAndIndex() {
-  if (this->level_ != nullptr) delete this->level_;
-
-  if (this->index_ != nullptr) delete this->index_;
-
-  this->level_ =
-      new sgpp::base::DataMatrix(this->storage->getSize(), this->storage->getDimension());
-  this->index_ =
-      new sgpp::base::DataMatrix(this->storage->getSize(), this->storage->getDimension());
-
-  this->storage->getLevelIndexArraysForEval(*(this->level_), *(this->index_));
+  const size_t gridSize = this->storage->getSize();
+  const size_t dims = this->storage->getDimension();
+  const double supportOffset = static_cast<double>(this->degree + 1) / 2.0;
+
+  this->scale_.resize(gridSize * dims);
+  this->offset_.resize(gridSize * dims);
+  this->type_.resize(gridSize * dims);
+
+  // the 1D basis function of level l and index i is evaluated at x as
+  // uniformBSpline(x * scale + offset) or modifiedBSpline(x * scale + offset)
+  for (size_t m = 0; m < gridSize; m++) {
+    const base::GridPoint& gp = (*this->storage)[m];
+
+    for (size_t d = 0; d < dims; d++) {
+      const size_t k = m * dims + d;
+      const base::level_t l = gp.getLevel(d);
+      const base::index_t i = gp.getIndex(d);
+      const base::index_t hInv = static_cast<base::index_t>(1) << l;
+      const double hInvDbl = static_cast<double>(hInv);
+
+      if (this->modified && (l == 1)) {
+        this->type_[k] = BasisFunctionType::CONSTANT;
+        this->scale_[k] = 0.0;
+        this->offset_[k] = 0.0;
+      } else if (this->modified && (i == hInv - 1)) {
+        // mirrored at x = 0.5
+        this->type_[k] = BasisFunctionType::MODIFIED;
+        this->scale_[k] = -hInvDbl;
+        this->offset_[k] = hInvDbl;
+      } else if (this->modified && (i == 1)) {
+        this->type_[k] = BasisFunctionType::MODIFIED;
+        this->scale_[k] = hInvDbl;
+        this->offset_[k] = 0.0;
+      } else {
+        this->type_[k] = BasisFunctionType::UNIFORM;
+        this->scale_[k] = hInvDbl;
+        this->offset_[k] = supportOffset - static_cast<double>(i);
+      }
+    }
+  }
 }
 
 size_t OperationMultiEvalStreamingBSpline::padDataset(sgpp::base::DataMatrix& dataset) {
@@ -177,6 +234,44 @@ size_t OperationMultiEvalStreamingBSpline::padDataset(sgpp::base::DataMatrix& da
 
 double OperationMultiEvalStreamingBSpline::getDuration() { return this->duration; }
 
+base::InstructionSet OperationMultiEvalStreamingBSpline::getInstructionSet() const {
+  return this->instructionSet;
+}
+
+bool OperationMultiEvalStreamingBSpline::isInstructionSetAvailable(
+    base::InstructionSet instructionSet) {
+  bool compiled = false;
+
+  switch (instructionSet) {
+    case base::InstructionSet::SCALAR:
+      compiled = true;
+      break;
+    case base::InstructionSet::SSE3:
+    case base::InstructionSet::AVX:
+    case base::InstructionSet::AVX512F:
+      // there are no kernels for these instruction sets (AVX-512 CPUs use the AVX2 kernel)
+      break;
+    case base::InstructionSet::AVX2:
+#ifdef STREAMING_BSPLINE_KERNEL_AVX2
+      compiled = true;
+#endif
+      break;
+  }
+
+#ifdef SGPP_RUNTIME_ISA_DISPATCH
+  return compiled && base::CPUFeatures::isSupported(instructionSet);
+#else
+  // the kernels are only compiled if the instruction set is enabled at compile time
+  return compiled && (static_cast<int>(instructionSet) <=
+                      static_cast<int>(base::CPUFeatures::getMaximumInstructionSet()));
+#endif
+}
+
+base::InstructionSet OperationMultiEvalStreamingBSpline::getBestInstructionSet() {
+  return isInstructionSetAvailable(base::InstructionSet::AVX2) ? base::InstructionSet::AVX2
+                                                                : base::InstructionSet::SCALAR;
+}
+
 void OperationMultiEvalStreamingBSpline::prepare() { this->recalculateLevelAndIndex(); }
 }  // namespace datadriven
 }  // namespace sgpp
@@ -1,38 +1,110 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
 #pragma once
 
+#ifdef _OPENMP
 #include <omp.h>
+#endif
 
 #include <sgpp/base/exception/operation_exception.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
 #include <sgpp/base/tools/SGppStopwatch.hpp>
 
 #include <sgpp/globaldef.hpp>
 
-#ifndef STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH
-//#define STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH 24
-#define STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH 96
+#include <cstdint>
+#include <vector>
+
+// kernels that are compiled into the library (with runtime dispatch, all x86 kernels are)
+#if defined(SGPP_RUNTIME_ISA_DISPATCH) || (defined(__AVX2__) && defined(__FMA__))
+#define STREAMING_BSPLINE_KERNEL_AVX2
 #endif
 
 namespace sgpp {
 namespace datadriven {
 
+/**
+ * Streaming evaluation of B-spline and modified B-spline sparse grid functions on the CPU
+ * (OpenMP and SIMD, no OpenCL required).
+ *
+ * Like OperationMultiEvalStreaming for linear grids, the kernel streams over all pairs of
+ * grid points and data points. For every pair, the 1D B-splines are evaluated without branches
+ * and multiplied to the product over the dimensions. For the compile-time degrees (see below),
+ * the point is mirrored to the left half of the support and the polynomial pieces are evaluated
+ * with Horner's scheme; the Cox-de Boor recursion is only the fallback for runtime degrees.
+ * The AVX2 kernel keeps the evaluation and the product for 8 data points in registers and
+ * skips the remaining dimensions of a grid point as soon as its basis function vanishes on all
+ * of them (vector comparison). The portable scalar kernel does the same on blocks of 8 data
+ * points, which the compiler vectorizes for the instruction sets enabled at compile time.
+ * The degrees 1, 3, 5, and 7 are instantiated with compile-time degree (fully unrolled
+ * evaluation), the other degrees up to MAX_DEGREE use the same kernels with runtime degree.
+ *
+ * The AVX2 kernel is chosen if the CPU supports it (see base::CPUFeatures), so it is
+ * also used on CPUs with AVX-512.
+ */
 class OperationMultiEvalStreamingBSpline : public base::OperationMultipleEval {
+ public:
+  /// maximal supported B-spline degree
+  static const size_t MAX_DEGREE = 15;
+
+  /**
+   * Type of a 1D basis function, determined per grid point and dimension.
+   */
+  enum class BasisFunctionType : uint8_t {
+    /// constant function (level 1 of modified B-spline grids)
+    CONSTANT,
+    /// uniform B-spline
+    UNIFORM,
+    /// modified B-spline at the boundary
+    MODIFIED
+  };
+
  protected:
   sgpp::base::DataMatrix preparedDataset;
-  /// Member to store the sparse grid's levels for better vectorization
-  sgpp::base::DataMatrix* level_ = nullptr;
-  /// Member to store the sparse grid's indices for better vectorization
-  sgpp::base::DataMatrix* index_ = nullptr;
+  /// per grid point and dimension: scaling of the coordinate of the data points
+  std::vector<double> scale_;
+  /// per grid point and dimension: offset added to the scaled coordinate
+  std::vector<double> offset_;
+  /// per grid point and dimension: type of the 1D basis function
+  std::vector<BasisFunctionType> type_;
   /// Timer object to handle time measurements
   sgpp::base::SGppStopwatch myTimer_;
 
   base::GridStorage* storage;
 
+  /// instruction set of the kernel
+  base::InstructionSet instructionSet;
+  /// B-spline degree
+  size_t degree;
+  /// whether the grid is a modified B-spline grid
+  bool modified;
+
   double duration;
 
  public:
+  /**
+   * Constructor, uses the kernel for the newest instruction set supported by the CPU.
+   *
+   * @param grid      B-spline or modified B-spline grid
+   * @param dataset   data points (one per row)
+   */
   OperationMultiEvalStreamingBSpline(base::Grid& grid, base::DataMatrix& dataset);
 
+  /**
+   * Constructor, uses the kernel for the given instruction set.
+   *
+   * @param grid            B-spline or modified B-spline grid
+   * @param dataset         data points (one per row)
+   * @param instructionSet  instruction set of the kernel (must be available,
+   *                        see isInstructionSetAvailable)
+   */
+  OperationMultiEvalStreamingBSpline(base::Grid& grid, base::DataMatrix& dataset,
+                                     base::InstructionSet instructionSet);
+
   ~OperationMultiEvalStreamingBSpline() override;
 
   size_t getChunkGridPoints();
@@ -47,6 +119,23 @@ class OperationMultiEvalStreamingBSpline : public base::OperationMultipleEval {
 
   double getDuration() override;
 
+  /**
+   * @return instruction set of the kernel that is used
+   */
+  base::InstructionSet getInstructionSet() const;
+
+  /**
+   * @param instructionSet  instruction set
+   * @return                whether there is a kernel for the instruction set that
+   *                        can be used on this CPU (SCALAR or AVX2)
+   */
+  static bool isInstructionSetAvailable(base::InstructionSet instructionSet);
+
+  /**
+   * @return newest instruction set for which a kernel is available
+   */
+  static base::InstructionSet getBestInstructionSet();
+
  private:
   void getPartitionSegment(size_t start, size_t end, size_t segmentCount, size_t segmentNumber,
                            size_t* segmentStart, size_t* segmentEnd, size_t blockSize);
@@ -56,19 +145,69 @@ class OperationMultiEvalStreamingBSpline : public base::OperationMultipleEval {
   void getOpenMPPartitionSegment(size_t start, size_t end, size_t* segmentStart, size_t* segmentEnd,
                                  size_t blocksize);
 
-  void multImpl(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
-                sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
-                sgpp::base::DataVector& result, const size_t start_index_grid,
-                const size_t end_index_grid, const size_t start_index_data,
-                const size_t end_index_data);
+  void multImpl(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                const size_t start_index_grid, const size_t end_index_grid,
+                const size_t start_index_data, const size_t end_index_data);
+
+  void multTransposeImpl(sgpp::base::DataVector& source, sgpp::base::DataVector& result,
+                         const size_t start_index_grid, const size_t end_index_grid,
+                         const size_t start_index_data, const size_t end_index_data);
+
+  /**
+   * @tparam P  B-spline degree (0 to use the runtime degree)
+   */
+  template <size_t P>
+  void multImplScalar(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                      const size_t start_index_grid, const size_t end_index_grid,
+                      const size_t start_index_data, const size_t end_index_data);
+
+  /**
+   * @tparam P  B-spline degree (0 to use the runtime degree)
+   */
+  template <size_t P>
+  void multTransposeImplScalar(sgpp::base::DataVector& source, sgpp::base::DataVector& result,
+                               const size_t start_index_grid, const size_t end_index_grid,
+                               const size_t start_index_data, const size_t end_index_data);
+
+#ifdef STREAMING_BSPLINE_KERNEL_AVX2
+  /**
+   * @tparam P  B-spline degree (0 to use the runtime degree)
+   */
+  template <size_t P>
+  SGPP_TARGET("avx2,fma")
+  void multImplAVX2(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                    const size_t start_index_grid, const size_t end_index_grid,
+                    const size_t start_index_data, const size_t end_index_data);
+
+  /**
+   * @tparam P  B-spline degree (0 to use the runtime degree)
+   */
+  template <size_t P>
+  SGPP_TARGET("avx2,fma")
+  void multTransposeImplAVX2(sgpp::base::DataVector& source, sgpp::base::DataVector& result,
+                             const size_t start_index_grid, const size_t end_index_grid,
+                             const size_t start_index_data, const size_t end_index_data);
+#endif
 
-  void multTransposeImpl(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
-                         sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
-                         sgpp::base::DataVector& result, const size_t start_index_grid,
-                         const size_t end_index_grid, const size_t start_index_data,
-                         const size_t end_index_data);
+  /**
+   * Multiplies the values of the 1D basis function of a grid point in one dimension
+   * to the values of a block of DATA_BLOCK_SIZE data points (see
+   * OperationMultiEvalStreamingBSplineKernel.hpp).
+   *
+   * @tparam P                    B-spline degree (0 to use the runtime degree)
+   * @param         gridIndex     sequence number of the grid point
+   * @param         d             dimension
+   * @param         data          coordinates of the data points in dimension d
+   * @param         coefficients  coefficients of the polynomial pieces of the B-spline
+   *                              (see streamingbspline::getPieceCoefficients)
+   * @param[in,out] values        values that are multiplied with the 1D values
+   */
+  template <size_t P>
+  inline void multiplyBasisFunction(size_t gridIndex, size_t d, const double* data,
+                                    const double* coefficients, double* values) const;
 
   void recalculateLevelAndIndex();
 };
+
 }  // namespace datadriven
 }  // namespace sgpp
@@ -0,0 +1,272 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingBSpline/OperationMultiEvalStreamingBSpline.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <cstddef>
+
+#ifdef STREAMING_BSPLINE_KERNEL_AVX2
+#include <immintrin.h>  // NOLINT(build/include)
+#endif
+
+namespace sgpp {
+namespace datadriven {
+namespace streamingbspline {
+
+/// number of data points that are processed at once by the kernels (two AVX2 registers)
+const size_t DATA_BLOCK_SIZE = 8;
+
+/**
+ * @tparam P  B-spline degree (compile-time)
+ * @return    number of coefficients of the polynomial pieces (see getPieceCoefficients)
+ */
+template <size_t P>
+constexpr size_t getNumberOfPieceCoefficients() {
+  return (P / 2 + 1) * (P + 1);
+}
+
+/**
+ * Computes the monomial coefficients of the polynomial pieces of the uniform B-spline
+ * with knots \f$\{0, 1, \dotsc, p+1\}\f$ on the left half of its support:
+ * \f$N(x) = \sum_{m=0}^p c_{k(p+1)+m} (x - k)^m\f$ for \f$x \in [k, k+1)\f$,
+ * \f$k = 0, \dotsc, \lfloor p/2 \rfloor\f$.
+ * The coefficients follow from \f$N(x) = \frac{1}{p!} \sum_{i=0}^k (-1)^i \binom{p+1}{i}
+ * (x - i)^p\f$; the sums are exact in double precision for the degrees with compile-time
+ * kernels (p <= 7).
+ *
+ * @param      p             B-spline degree
+ * @param[out] coefficients  array with (p/2 + 1) * (p + 1) entries
+ */
+inline void getPieceCoefficients(size_t p, double* coefficients) {
+  double factorial = 1.0;
+
+  for (size_t q = 2; q <= p; q++) {
+    factorial *= static_cast<double>(q);
+  }
+
+  for (size_t k = 0; k <= p / 2; k++) {
+    double binomialM = 1.0;
+
+    for (size_t m = 0; m <= p; m++) {
+      // binomialM = binom(p, m), binomialI = binom(p + 1, i)
+      double sum = 0.0;
+      double binomialI = 1.0;
+
+      for (size_t i = 0; i <= k; i++) {
+        const double sign = ((i % 2 == 0) ? 1.0 : -1.0);
+        sum += sign * binomialI * std::pow(static_cast<double>(k - i), static_cast<double>(p - m));
+        binomialI = binomialI * static_cast<double>(p + 1 - i) / static_cast<double>(i + 1);
+      }
+
+      coefficients[k * (p + 1) + m] = binomialM * sum / factorial;
+      binomialM = binomialM * static_cast<double>(p - m) / static_cast<double>(m + 1);
+    }
+  }
+}
+
+/**
+ * Evaluates the uniform B-spline with knots \f$\{0, 1, \dotsc, p+1\}\f$ without branches,
+ * such that the evaluation can be vectorized.
+ * For compile-time degrees (P > 0), the point is mirrored to the left half of the support,
+ * all \f$\lfloor P/2 \rfloor + 1\f$ polynomial pieces are evaluated with Horner's scheme,
+ * and the piece is selected by comparisons (\f$O(p^2/2)\f$ fused multiply-adds).
+ * Otherwise, the Cox-de Boor recursion is used (\f$O(p^2/2)\f$ steps with several operations
+ * each), which does not need coefficients.
+ *
+ * @tparam P            B-spline degree (0 to use the runtime degree p)
+ * @param x             evaluation point
+ * @param p             B-spline degree (at most OperationMultiEvalStreamingBSpline::MAX_DEGREE),
+ *                      ignored if P > 0
+ * @param coefficients  coefficients of the pieces (see getPieceCoefficients), ignored if P == 0
+ * @return              value of the uniform B-spline
+ */
+template <size_t P>
+inline double uniformBSpline(double x, size_t p, const double* coefficients) {
+  if (P > 0) {
+    const double center = static_cast<double>(P + 1) / 2.0;
+    const double y = center - std::abs(x - center);
+    double result = 0.0;
+
+    for (size_t k = 0; k <= P / 2; k++) {
+      const double s = y - static_cast<double>(k);
+      double value = coefficients[k * (P + 1) + P];
+
+      for (size_t m = P; m-- > 0;) {
+        value = value * s + coefficients[k * (P + 1) + m];
+      }
+
+      // outside of the support, y < 0
+      result = ((y >= static_cast<double>(k)) ? value : result);
+    }
+
+    return result;
+  }
+
+  double n[OperationMultiEvalStreamingBSpline::MAX_DEGREE + 1];
+
+  for (size_t k = 0; k <= p; k++) {
+    const double kDbl = static_cast<double>(k);
+    n[k] = static_cast<double>((x >= kDbl) & (x < kDbl + 1.0));
+  }
+
+  for (size_t q = 1; q <= p; q++) {
+    const double qInv = 1.0 / static_cast<double>(q);
+
+    // only k <= p - q is needed, but a trip count that does not depend on q allows
+    // the compiler to vectorize the loop over the data points
+    for (size_t k = 0; k < p; k++) {
+      const double kDbl = static_cast<double>(k);
+      n[k] = ((x - kDbl) * n[k] + (kDbl + static_cast<double>(q + 1) - x) * n[k + 1]) * qInv;
+    }
+  }
+
+  return n[0];
+}
+
+/**
+ * Evaluates the modified B-spline at the left boundary (index 1) as the weighted sum of
+ * uniform B-splines (see BsplineModifiedBasis::modifiedBSpline).
+ *
+ * @tparam P            B-spline degree (0 to use the runtime degree p)
+ * @param x             evaluation point (scaled by \f$2^\ell\f$)
+ * @param p             B-spline degree, ignored if P > 0
+ * @param coefficients  coefficients of the pieces (see getPieceCoefficients), ignored if P == 0
+ * @return              value of the modified B-spline
+ */
+template <size_t P>
+inline double modifiedBSpline(double x, size_t p, const double* coefficients) {
+  const size_t deg = (P == 0) ? p : P;
+  double result = 0.0;
+  const double x2 = x + static_cast<double>(deg - 1) / 2.0;
+
+  for (size_t k = 0; k <= (deg + 2) / 2; k++) {
+    result += static_cast<double>(k + 1) *
+              uniformBSpline<P>(x2 + static_cast<double>(k), deg, coefficients);
+  }
+
+  return result;
+}
+
+#ifdef STREAMING_BSPLINE_KERNEL_AVX2
+/**
+ * AVX2 version of uniformBSpline for four evaluation points. All intermediate values
+ * are kept in registers.
+ *
+ * @tparam P            B-spline degree (0 to use the runtime degree p)
+ * @param x             evaluation points
+ * @param p             B-spline degree, ignored if P > 0
+ * @param coefficients  broadcasted coefficients of the pieces (see getPieceCoefficients),
+ *                      ignored if P == 0
+ * @return              values of the uniform B-spline
+ */
+template <size_t P>
+SGPP_TARGET("avx2,fma")
+inline __m256d uniformBSplineAVX2(__m256d x, size_t p, const __m256d* coefficients) {
+  if (P > 0) {
+    const __m256d center = _mm256_set1_pd(static_cast<double>(P + 1) / 2.0);
+    const __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFF));
+    const __m256d y = _mm256_sub_pd(center, _mm256_and_pd(absMask, _mm256_sub_pd(x, center)));
+    __m256d result = _mm256_setzero_pd();
+
+    for (size_t k = 0; k <= P / 2; k++) {
+      const __m256d kVec = _mm256_set1_pd(static_cast<double>(k));
+      const __m256d s = _mm256_sub_pd(y, kVec);
+      __m256d value = coefficients[k * (P + 1) + P];
+
+      for (size_t m = P; m-- > 0;) {
+        value = _mm256_fmadd_pd(value, s, coefficients[k * (P + 1) + m]);
+      }
+
+      // outside of the support, y < 0
+      result = _mm256_blendv_pd(result, value, _mm256_cmp_pd(y, kVec, _CMP_GE_OQ));
+    }
+
+    return result;
+  }
+
+  const __m256d one = _mm256_set1_pd(1.0);
+  __m256d n[OperationMultiEvalStreamingBSpline::MAX_DEGREE + 1];
+
+  for (size_t k = 0; k <= p; k++) {
+    const __m256d kVec = _mm256_set1_pd(static_cast<double>(k));
+    const __m256d isInside = _mm256_and_pd(_mm256_cmp_pd(x, kVec, _CMP_GE_OQ),
+                                           _mm256_cmp_pd(x, _mm256_add_pd(kVec, one), _CMP_LT_OQ));
+    n[k] = _mm256_and_pd(isInside, one);
+  }
+
+  for (size_t q = 1; q <= p; q++) {
+    const __m256d qInv = _mm256_set1_pd(1.0 / static_cast<double>(q));
+
+    for (size_t k = 0; k <= p - q; k++) {
+      const __m256d left = _mm256_sub_pd(x, _mm256_set1_pd(static_cast<double>(k)));
+      const __m256d right = _mm256_sub_pd(_mm256_set1_pd(static_cast<double>(k + q + 1)), x);
+      n[k] = _mm256_mul_pd(_mm256_fmadd_pd(left, n[k], _mm256_mul_pd(right, n[k + 1])), qInv);
+    }
+  }
+
+  return n[0];
+}
+
+/**
+ * AVX2 version of modifiedBSpline for four evaluation points.
+ *
+ * @tparam P            B-spline degree (0 to use the runtime degree p)
+ * @param x             evaluation points (scaled by \f$2^\ell\f$)
+ * @param p             B-spline degree, ignored if P > 0
+ * @param coefficients  broadcasted coefficients of the pieces (see getPieceCoefficients),
+ *                      ignored if P == 0
+ * @return              values of the modified B-spline
+ */
+template <size_t P>
+SGPP_TARGET("avx2,fma")
+inline __m256d modifiedBSplineAVX2(__m256d x, size_t p, const __m256d* coefficients) {
+  const size_t deg = (P == 0) ? p : P;
+  __m256d result = _mm256_setzero_pd();
+  const __m256d x2 = _mm256_add_pd(x, _mm256_set1_pd(static_cast<double>(deg - 1) / 2.0));
+
+  for (size_t k = 0; k <= (deg + 2) / 2; k++) {
+    result = _mm256_fmadd_pd(
+        _mm256_set1_pd(static_cast<double>(k + 1)),
+        uniformBSplineAVX2<P>(_mm256_add_pd(x2, _mm256_set1_pd(static_cast<double>(k))), deg,
+                              coefficients),
+        result);
+  }
+
+  return result;
+}
+#endif
+
+}  // namespace streamingbspline
+
+template <size_t P>
+inline void OperationMultiEvalStreamingBSpline::multiplyBasisFunction(
+    size_t gridIndex, size_t d, const double* data, const double* coefficients,
+    double* values) const {
+  const size_t p = (P == 0) ? degree : P;
+  const size_t dims = storage->getDimension();
+  const size_t k = gridIndex * dims + d;
+  const double scale = scale_[k];
+  const double offset = offset_[k];
+
+  if (type_[k] == BasisFunctionType::UNIFORM) {
+#pragma omp simd
+    for (size_t i = 0; i < streamingbspline::DATA_BLOCK_SIZE; i++) {
+      values[i] *= streamingbspline::uniformBSpline<P>(data[i] * scale + offset, p, coefficients);
+    }
+  } else if (type_[k] == BasisFunctionType::MODIFIED) {
+#pragma omp simd
+    for (size_t i = 0; i < streamingbspline::DATA_BLOCK_SIZE; i++) {
+      values[i] *= streamingbspline::modifiedBSpline<P>(data[i] * scale + offset, p, coefficients);
+    }
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -4,314 +4,210 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingBSpline/OperationMultiEvalStreamingBSpline.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingBSpline/OperationMultiEvalStreamingBSplineKernel.hpp>
 
 #include <sgpp/globaldef.hpp>
 
-#if defined(__SSE3__) && !defined(__AVX__)
-#include <pmmintrin.h>
-#endif
+namespace sgpp {
+namespace datadriven {
 
-#if defined(__SSE3__) && defined(__AVX__)
-#include <immintrin.h>
-#endif
+void OperationMultiEvalStreamingBSpline::multTransposeImpl(sgpp::base::DataVector& source,
+                                                           sgpp::base::DataVector& result,
+                                                           const size_t start_index_grid,
+                                                           const size_t end_index_grid,
+                                                           const size_t start_index_data,
+                                                           const size_t end_index_data) {
+#ifdef STREAMING_BSPLINE_KERNEL_AVX2
+  if (this->instructionSet == base::InstructionSet::AVX2) {
+    switch (this->degree) {
+      case 1:
+        multTransposeImplAVX2<1>(source, result, start_index_grid, end_index_grid, start_index_data,
+                                 end_index_data);
+        break;
+      case 3:
+        multTransposeImplAVX2<3>(source, result, start_index_grid, end_index_grid, start_index_data,
+                                 end_index_data);
+        break;
+      case 5:
+        multTransposeImplAVX2<5>(source, result, start_index_grid, end_index_grid, start_index_data,
+                                 end_index_data);
+        break;
+      case 7:
+        multTransposeImplAVX2<7>(source, result, start_index_grid, end_index_grid, start_index_data,
+                                 end_index_data);
+        break;
+      default:
+        multTransposeImplAVX2<0>(source, result, start_index_grid, end_index_grid, start_index_data,
+                                 end_index_data);
+        break;
+    }
 
-#if defined(__MIC__)
-#include <immintrin.h>
+    return;
+  }
 #endif
 
-namespace sgpp {
-namespace datadriven {
+  switch (this->degree) {
+    case 1:
+      multTransposeImplScalar<1>(source, result, start_index_grid, end_index_grid, start_index_data,
+                                 end_index_data);
+      break;
+    case 3:
+      multTransposeImplScalar<3>(source, result, start_index_grid, end_index_grid, start_index_data,
+                                 end_index_data);
+      break;
+    case 5:
+      multTransposeImplScalar<5>(source, result, start_index_grid, end_index_grid, start_index_data,
+                                 end_index_data);
+      break;
+    case 7:
+      multTransposeImplScalar<7>(source, result, start_index_grid, end_index_grid, start_index_data,
+                                 end_index_data);
+      break;
+    default:
+      multTransposeImplScalar<0>(source, result, start_index_grid, end_index_grid, start_index_data,
+                                 end_index_data);
+      break;
+  }
+}
 
-void OperationMultiEvalStreamingBSpline::multTransposeImpl(
-    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
+template <size_t P>
+void OperationMultiEvalStreamingBSpline::multTransposeImplScalar(
     sgpp::base::DataVector& source, sgpp::base::DataVector& result, const size_t start_index_grid,
     const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
-  double* ptrLevel = level->getPointer();
-  double* ptrIndex = index->getPointer();
-  double* ptrSource = source.getPointer();
-  double* ptrData = dataset->getPointer();
+  const double* ptrSource = source.getPointer();
+  const double* ptrData = this->preparedDataset.getPointer();
   double* ptrResult = result.getPointer();
-  size_t sourceSize = source.getSize();
-  size_t dims = dataset->getNrows();
-
-#if defined(__SSE3__) && defined(__AVX2__) && !defined(__AVX512F__)
-
-  for (size_t k = start_index_grid; k < end_index_grid; k++) {
-    for (size_t i = start_index_data; i < end_index_data; i = i + 8) {
-      // double support = ptrSource[i];
-      __m256d support_0 = _mm256_load_pd(&ptrSource[i]);
-      __m256d support_1 = _mm256_load_pd(&ptrSource[i + 4]);
-
-      __m256d zero = _mm256_set1_pd(0.0);
-      __m256d one = _mm256_set1_pd(1.0);
-      __m256d two = _mm256_set1_pd(2.0);
-      __m256d three = _mm256_set1_pd(3.0);
-      __m256d four = _mm256_set1_pd(4.0);
-
-      for (size_t d = 0; d < dims; d++) {
-        __m256d levels = _mm256_broadcast_sd(&ptrLevel[(k * dims) + d]);
-        __m256d indexs = _mm256_broadcast_sd(&ptrIndex[(k * dims) + d]);
-
-        __m256d evals_0;
-        __m256d evals_1;
-
-        __m256d ptrData_0 = _mm256_load_pd(&ptrData[(d * sourceSize) + i]);
-        __m256d ptrData_1 = _mm256_load_pd(&ptrData[(d * sourceSize) + i + 4]);
-
-        __m256d x_0 = _mm256_fmsub_pd(ptrData_0, levels, indexs);
-        __m256d x_1 = _mm256_fmsub_pd(ptrData_1, levels, indexs);
-
-        x_0 = _mm256_add_pd(x_0, two);
-        x_1 = _mm256_add_pd(x_1, two);
-
-        __m256d n_0_0;
-        __m256d n_0_1;
-        __m256d n_0_0_temp;
-        __m256d n_0_1_temp;
-
-        __m256d result0_0;
-        __m256d result0_1;
-
-        // x>=0
-        n_0_0 = _mm256_cmp_pd(x_0, zero, 13);
-        n_0_1 = _mm256_cmp_pd(x_1, zero, 13);
-
-        // x<1
-        n_0_0_temp = _mm256_cmp_pd(x_0, one, 1);
-        n_0_1_temp = _mm256_cmp_pd(x_1, one, 1);
-
-        n_0_0 = _mm256_and_pd(n_0_0_temp, n_0_0);
-        n_0_1 = _mm256_and_pd(n_0_1_temp, n_0_1);
-
-        n_0_0 = _mm256_and_pd(n_0_0, one);
-        n_0_1 = _mm256_and_pd(n_0_1, one);
-
-        __m256d pow_x_2_0 = _mm256_mul_pd(x_0, x_0);
-        __m256d pow_x_2_1 = _mm256_mul_pd(x_1, x_1);
-
-        __m256d pow_x_3_0 = _mm256_mul_pd(pow_x_2_0, x_0);
-        __m256d pow_x_3_1 = _mm256_mul_pd(pow_x_2_1, x_1);
-
-        result0_0 = _mm256_mul_pd(pow_x_3_0, _mm256_set1_pd(1.0 / 6.0));
-        result0_1 = _mm256_mul_pd(pow_x_3_1, _mm256_set1_pd(1.0 / 6.0));
-
-        evals_0 = _mm256_mul_pd(result0_0, n_0_0);
-        evals_1 = _mm256_mul_pd(result0_1, n_0_1);
-
-        // n_1
-        // x>=1
-        n_0_0 = _mm256_cmp_pd(x_0, one, 13);
-        n_0_1 = _mm256_cmp_pd(x_1, one, 13);
-
-        // x<2
-        n_0_0_temp = _mm256_cmp_pd(x_0, two, 1);
-        n_0_1_temp = _mm256_cmp_pd(x_1, two, 1);
-        n_0_0 = _mm256_and_pd(n_0_0_temp, n_0_0);
-        n_0_1 = _mm256_and_pd(n_0_1_temp, n_0_1);
+  const size_t dataSize = this->preparedDataset.getNcols();
+  const size_t dims = this->preparedDataset.getNrows();
 
-        n_0_0 = _mm256_and_pd(n_0_0, one);
-        n_0_1 = _mm256_and_pd(n_0_1, one);
+  double coefficients[streamingbspline::getNumberOfPieceCoefficients<P>()];
+  streamingbspline::getPieceCoefficients(P, coefficients);
 
-        result0_0 = _mm256_fmadd_pd(_mm256_set1_pd(-0.5), x_0, two);
-        result0_1 = _mm256_fmadd_pd(_mm256_set1_pd(-0.5), x_1, two);
-        result0_0 = _mm256_fmadd_pd(result0_0, x_0, _mm256_set1_pd(-2.0));
-        result0_1 = _mm256_fmadd_pd(result0_1, x_1, _mm256_set1_pd(-2.0));
-        result0_0 = _mm256_fmadd_pd(result0_0, x_0, _mm256_set1_pd(2.0 / 3.0));
-        result0_1 = _mm256_fmadd_pd(result0_1, x_1, _mm256_set1_pd(2.0 / 3.0));
+  double values[streamingbspline::DATA_BLOCK_SIZE];
 
-        evals_0 = _mm256_fmadd_pd(result0_0, n_0_0, evals_0);
-        evals_1 = _mm256_fmadd_pd(result0_1, n_0_1, evals_1);
+  for (size_t m = start_index_grid; m < end_index_grid; m++) {
+    double gridResult = 0.0;
 
-        // n2
-        // x>=2
-        n_0_0 = _mm256_cmp_pd(x_0, two, 13);
-        n_0_1 = _mm256_cmp_pd(x_1, two, 13);
+    // the data points are padded to multiples of DATA_BLOCK_SIZE (see getChunkDataPoints)
+    for (size_t c = start_index_data; c < end_index_data;
+         c += streamingbspline::DATA_BLOCK_SIZE) {
+      for (size_t i = 0; i < streamingbspline::DATA_BLOCK_SIZE; i++) {
+        values[i] = ptrSource[c + i];
+      }
 
-        // x<3
-        n_0_0_temp = _mm256_cmp_pd(x_0, three, 1);
-        n_0_1_temp = _mm256_cmp_pd(x_1, three, 1);
-        n_0_0 = _mm256_and_pd(n_0_0_temp, n_0_0);
-        n_0_1 = _mm256_and_pd(n_0_1_temp, n_0_1);
+      for (size_t d = 0; d < dims; d++) {
+        this->multiplyBasisFunction<P>(m, d, &ptrData[d * dataSize + c], coefficients, values);
 
-        n_0_0 = _mm256_and_pd(n_0_0, one);
-        n_0_1 = _mm256_and_pd(n_0_1, one);
+        // skip the remaining dimensions if the basis function vanishes on the whole block
+        bool isNonZero = false;
 
-        result0_0 = _mm256_fmadd_pd(_mm256_set1_pd(0.5), x_0, _mm256_set1_pd(-4.0));
-        result0_1 = _mm256_fmadd_pd(_mm256_set1_pd(0.5), x_1, _mm256_set1_pd(-4.0));
-        result0_0 = _mm256_fmadd_pd(result0_0, x_0, _mm256_set1_pd(10.0));
-        result0_1 = _mm256_fmadd_pd(result0_1, x_1, _mm256_set1_pd(10.0));
-        result0_0 = _mm256_fmadd_pd(result0_0, x_0, _mm256_set1_pd(-22.0 / 3.0));
-        result0_1 = _mm256_fmadd_pd(result0_1, x_1, _mm256_set1_pd(-22.0 / 3.0));
+#pragma omp simd reduction(|| : isNonZero)
+        for (size_t i = 0; i < streamingbspline::DATA_BLOCK_SIZE; i++) {
+          isNonZero = isNonZero || (values[i] != 0.0);
+        }
 
-        evals_0 = _mm256_fmadd_pd(result0_0, n_0_0, evals_0);
-        evals_1 = _mm256_fmadd_pd(result0_1, n_0_1, evals_1);
+        if (!isNonZero) {
+          break;
+        }
+      }
 
-        // n3
-        // x>=3
-        n_0_0 = _mm256_cmp_pd(x_0, three, 13);
-        n_0_1 = _mm256_cmp_pd(x_1, three, 13);
+      double blockResult = 0.0;
 
-        // x<4
-        n_0_0_temp = _mm256_cmp_pd(x_0, four, 1);
-        n_0_1_temp = _mm256_cmp_pd(x_1, four, 1);
-        n_0_0 = _mm256_and_pd(n_0_0_temp, n_0_0);
-        n_0_1 = _mm256_and_pd(n_0_1_temp, n_0_1);
-
-        n_0_0 = _mm256_and_pd(n_0_0, one);
-        n_0_1 = _mm256_and_pd(n_0_1, one);
-
-        result0_0 = _mm256_fmadd_pd(_mm256_set1_pd(-1.0 / 6.0), x_0, two);
-        result0_1 = _mm256_fmadd_pd(_mm256_set1_pd(-1.0 / 6.0), x_1, two);
-        result0_0 = _mm256_fmadd_pd(result0_0, x_0, _mm256_set1_pd(-8.0));
-        result0_1 = _mm256_fmadd_pd(result0_1, x_1, _mm256_set1_pd(-8.0));
-        result0_0 = _mm256_fmadd_pd(result0_0, x_0, _mm256_set1_pd(32.0 / 3.0));
-        result0_1 = _mm256_fmadd_pd(result0_1, x_1, _mm256_set1_pd(32.0 / 3.0));
-
-        evals_0 = _mm256_fmadd_pd(result0_0, n_0_0, evals_0);
-        evals_1 = _mm256_fmadd_pd(result0_1, n_0_1, evals_1);
-
-        support_0 = _mm256_mul_pd(support_0, evals_0);
-        support_1 = _mm256_mul_pd(support_1, evals_1);
+#pragma omp simd reduction(+ : blockResult)
+      for (size_t i = 0; i < streamingbspline::DATA_BLOCK_SIZE; i++) {
+        blockResult += values[i];
       }
-      //
-      // ptrResult[k] += support;
 
-      support_0 = _mm256_add_pd(support_0, support_1);
+      gridResult += blockResult;
+    }
 
-      support_0 = _mm256_hadd_pd(support_0, support_0);
-      __m256d temp = _mm256_permute2f128_pd(support_0, support_0, 0x81);
-      support_0 = _mm256_add_pd(support_0, temp);
+    ptrResult[m] = gridResult;
+  }
+}
 
-      double support_temp[4];
+#ifdef STREAMING_BSPLINE_KERNEL_AVX2
+template <size_t P>
+SGPP_TARGET("avx2,fma")
+void OperationMultiEvalStreamingBSpline::multTransposeImplAVX2(
+    sgpp::base::DataVector& source, sgpp::base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  const double* ptrSource = source.getPointer();
+  const double* ptrData = this->preparedDataset.getPointer();
+  const double* ptrScale = this->scale_.data();
+  const double* ptrOffset = this->offset_.data();
+  const BasisFunctionType* ptrType = this->type_.data();
+  double* ptrResult = result.getPointer();
+  const size_t dataSize = this->preparedDataset.getNcols();
+  const size_t dims = this->preparedDataset.getNrows();
+  const size_t p = (P == 0) ? this->degree : P;
 
-      _mm256_store_pd(&support_temp[0], support_0);
+  double coefficients[streamingbspline::getNumberOfPieceCoefficients<P>()];
+  __m256d coefficientsAVX2[streamingbspline::getNumberOfPieceCoefficients<P>()];
+  streamingbspline::getPieceCoefficients(P, coefficients);
 
-      ptrResult[k] += support_temp[0];
-    }
+  for (size_t k = 0; k < streamingbspline::getNumberOfPieceCoefficients<P>(); k++) {
+    coefficientsAVX2[k] = _mm256_broadcast_sd(&(coefficients[k]));
   }
 
-#elif defined(__SSE3__) && defined(__AVX__) && !defined(__AVX512F__)
+  const __m256d zero = _mm256_setzero_pd();
 
-  for (size_t k = start_index_grid; k < end_index_grid; k++) {
-    for (size_t i = start_index_data; i < end_index_data; i = i + 4) {
-      // double support = ptrSource[i];
-      __m256d support = _mm256_load_pd(&ptrSource[i]);
+  for (size_t j = start_index_grid; j < end_index_grid; j++) {
+    __m256d res_0 = _mm256_setzero_pd();
+    __m256d res_1 = _mm256_setzero_pd();
 
-      __m256d zero = _mm256_set1_pd(0.0);
-      __m256d one = _mm256_set1_pd(1.0);
-      __m256d two = _mm256_set1_pd(2.0);
-      __m256d three = _mm256_set1_pd(3.0);
-      __m256d four = _mm256_set1_pd(4.0);
+    // the data points are padded to multiples of DATA_BLOCK_SIZE (see getChunkDataPoints)
+    for (size_t i = start_index_data; i < end_index_data;
+         i += streamingbspline::DATA_BLOCK_SIZE) {
+      __m256d support_0 = _mm256_loadu_pd(&(ptrSource[i]));
+      __m256d support_1 = _mm256_loadu_pd(&(ptrSource[i + 4]));
 
       for (size_t d = 0; d < dims; d++) {
-        __m256d levels = _mm256_broadcast_sd(&ptrLevel[(k * dims) + d]);
-        __m256d indexs = _mm256_broadcast_sd(&ptrIndex[(k * dims) + d]);
-
-        __m256d ptrDatas = _mm256_load_pd(&ptrData[(d * sourceSize) + i]);
-
-        __m256d x = _mm256_sub_pd(_mm256_mul_pd(ptrDatas, levels), indexs);
-        x = _mm256_add_pd(x, two);
-
-        __m256d n;
-        __m256d result;
-        __m256d eval;
-        __m256d pow_x_2 = _mm256_mul_pd(x, x);
-        __m256d pow_x_3 = _mm256_mul_pd(pow_x_2, x);
-
-        // x>=0
-        n = _mm256_cmp_pd(x, zero, 13);
-        // x<1
-        n = _mm256_and_pd(_mm256_cmp_pd(x, one, 1), n);
-        n = _mm256_and_pd(n, one);
-
-        result = _mm256_mul_pd(n, _mm256_mul_pd(pow_x_3, _mm256_set1_pd(1.0 / 6.0)));
-        eval = _mm256_mul_pd(result, n);
-
-        // x>=1
-        n = _mm256_cmp_pd(x, one, 13);
-        // x<2
-        n = _mm256_and_pd(_mm256_cmp_pd(x, two, 1), n);
-        n = _mm256_and_pd(n, one);
-
-        result = _mm256_mul_pd(_mm256_set1_pd(-0.5), pow_x_3);
-        result = _mm256_add_pd(result, _mm256_mul_pd(two, pow_x_2));  // 10
-        result = _mm256_sub_pd(result, _mm256_mul_pd(x, _mm256_set1_pd(2.0)));
-        result = _mm256_add_pd(result, _mm256_set1_pd(2.0 / 3.0));
-        result = _mm256_mul_pd(result, n);
-        eval = _mm256_add_pd(result, eval);
-
-        // x>=2
-        n = _mm256_cmp_pd(x, two, 13);
-        // x<3
-        n = _mm256_and_pd(_mm256_cmp_pd(x, three, 1), n);
-        n = _mm256_and_pd(n, one);
-
-        result = _mm256_mul_pd(_mm256_set1_pd(0.5), pow_x_3);
-        result = _mm256_sub_pd(result, _mm256_mul_pd(four, pow_x_2));
-        result = _mm256_add_pd(result, _mm256_mul_pd(_mm256_set1_pd(10.0), x));
-        result = _mm256_sub_pd(result, _mm256_set1_pd(22.0 / 3.0));
-        result = _mm256_mul_pd(n, result);
-        eval = _mm256_add_pd(result, eval);
-
-        // x>=3
-        n = _mm256_cmp_pd(x, three, 13);
-        // x<4
-        n = _mm256_and_pd(_mm256_cmp_pd(x, four, 1), n);
-        n = _mm256_and_pd(n, one);
-        result = _mm256_mul_pd(_mm256_set1_pd(-1.0 / 6.0), pow_x_3);
-        result = _mm256_add_pd(result, _mm256_mul_pd(two, pow_x_2));
-        result = _mm256_sub_pd(result, _mm256_mul_pd(_mm256_set1_pd(8.0), x));
-        result = _mm256_add_pd(result, _mm256_set1_pd(32.0 / 3.0));
-        result = _mm256_mul_pd(result, n);
-        eval = _mm256_add_pd(result, eval);
-
-        support = _mm256_mul_pd(support, eval);
-      }
-
-      support = _mm256_hadd_pd(support, support);
-      __m256d temp = _mm256_permute2f128_pd(support, support, 0x81);
-      support = _mm256_add_pd(support, temp);
-
-      double support_temp[4];
+        const size_t k = j * dims + d;
 
-      _mm256_store_pd(&support_temp[0], support);
+        if (ptrType[k] == BasisFunctionType::CONSTANT) {
+          continue;
+        }
 
-      ptrResult[k] += support_temp[0];
-    }
-  }
+        const __m256d scale = _mm256_broadcast_sd(&(ptrScale[k]));
+        const __m256d offset = _mm256_broadcast_sd(&(ptrOffset[k]));
+        const __m256d eval_0 =
+            _mm256_fmadd_pd(_mm256_loadu_pd(&(ptrData[(d * dataSize) + i])), scale, offset);
+        const __m256d eval_1 =
+            _mm256_fmadd_pd(_mm256_loadu_pd(&(ptrData[(d * dataSize) + i + 4])), scale, offset);
+
+        if (ptrType[k] == BasisFunctionType::UNIFORM) {
+          support_0 = _mm256_mul_pd(
+              support_0, streamingbspline::uniformBSplineAVX2<P>(eval_0, p, coefficientsAVX2));
+          support_1 = _mm256_mul_pd(
+              support_1, streamingbspline::uniformBSplineAVX2<P>(eval_1, p, coefficientsAVX2));
+        } else {
+          support_0 = _mm256_mul_pd(
+              support_0, streamingbspline::modifiedBSplineAVX2<P>(eval_0, p, coefficientsAVX2));
+          support_1 = _mm256_mul_pd(
+              support_1, streamingbspline::modifiedBSplineAVX2<P>(eval_1, p, coefficientsAVX2));
+        }
 
-#else
-  // For-Schleife über Grid
-  for (size_t k = start_index_grid; k < end_index_grid; k++) {
-    for (size_t i = start_index_data; i < end_index_data; i++) {
-      double support = ptrSource[i];
+        // skip the remaining dimensions if the basis function vanishes on all data points;
+        // the test is done only every second dimension, as the branch is hard to predict
+        const __m256d isNonZero = _mm256_or_pd(_mm256_cmp_pd(support_0, zero, _CMP_NEQ_UQ),
+                                               _mm256_cmp_pd(support_1, zero, _CMP_NEQ_UQ));
 
-      for (size_t d = 0; d < dims; d++) {
-        double level = ptrLevel[(k * dims) + d];
-        double index = ptrIndex[(k * dims) + d];
-        double x = ptrData[(d * sourceSize) + i] * level - index + 2.0;
-
-        double eval = 0.0;
-
-        if ((x < 0.0) || (x >= 4.0)) {
-          eval = 0.0;
-        } else if (x < 1.0) {
-          eval = 1.0 / 6.0 * x * x * x;
-        } else if (x < 2.0) {
-          eval = -0.5 * x * x * x + 2.0 * x * x - 2.0 * x + 2.0 / 3.0;
-        } else if (x < 3.0) {
-          eval = 0.5 * x * x * x - 4.0 * x * x + 10.0 * x - 22.0 / 3.0;
-        } else {
-          eval = -1.0 / 6.0 * x * x * x + 2.0 * x * x - 8.0 * x + 32.0 / 3.0;
+        if (((d & 1) != 0) && _mm256_testz_pd(isNonZero, isNonZero)) {
+          break;
         }
-        support *= eval;
       }
-      ptrResult[k] += support;
+
+      res_0 = _mm256_add_pd(res_0, support_0);
+      res_1 = _mm256_add_pd(res_1, support_1);
     }
-  }
 
-#endif
+    const __m256d res = _mm256_add_pd(res_0, res_1);
+    const __m128d sum =
+        _mm_add_pd(_mm256_castpd256_pd128(res), _mm256_extractf128_pd(res, 1));
+    ptrResult[j] = _mm_cvtsd_f64(_mm_hadd_pd(sum, sum));
+  }
 }
+#endif
+
 }  // namespace datadriven
 }  // namespace sgpp
-
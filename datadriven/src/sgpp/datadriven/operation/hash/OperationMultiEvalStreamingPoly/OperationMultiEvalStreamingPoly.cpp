@@ -0,0 +1,416 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingPoly/OperationMultiEvalStreamingPoly.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/datadriven/tools/mortonOrder/MortonOrder.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+OperationMultiEvalStreamingPoly::OperationMultiEvalStreamingPoly(base::Grid& grid,
+                                                                 base::DataMatrix& dataset,
+                                                                 bool mortonOrder)
+    : OperationMultipleEval(grid, dataset),
+      myTimer_(sgpp::base::SGppStopwatch()),
+      degree(0),
+      modified(false),
+      mortonOrder(mortonOrder),
+      numberDataPoints(dataset.getNrows()),
+      duration(-1.0) {
+  if (grid.getType() == base::GridType::Poly) {
+    modified = false;
+  } else if (grid.getType() == base::GridType::ModPoly) {
+    modified = true;
+  } else {
+    throw sgpp::base::operation_exception(
+        "OperationMultiEvalStreamingPoly: only polynomial and modified polynomial grids "
+        "are supported");
+  }
+
+  this->storage = &grid.getStorage();
+  this->degree = grid.getBasis().getDegree();
+
+  if (this->degree > MAX_DEGREE) {
+    throw sgpp::base::operation_exception(
+        "OperationMultiEvalStreamingPoly: polynomial degree is too high");
+  }
+
+  this->prepareDataset(dataset);
+
+  // create the kernel specific data structures for the current grid
+  this->prepare();
+}
+
+OperationMultiEvalStreamingPoly::~OperationMultiEvalStreamingPoly() {}
+
+void OperationMultiEvalStreamingPoly::prepareDataset(const sgpp::base::DataMatrix& dataset) {
+  const size_t dims = dataset.getNcols();
+  sgpp::base::DataMatrix data(dataset);
+  this->storage->getBoundingBox()->transformPointsToUnitCube(data);
+
+  this->permutation.resize(numberDataPoints);
+
+  if (mortonOrder) {
+    Dataset sortedDataset(numberDataPoints, dims);
+    sortedDataset.getData() = data;
+    MortonOrder order(&sortedDataset);
+    this->permutation = order.getPermutation();
+  } else {
+    for (size_t k = 0; k < numberDataPoints; k++) {
+      this->permutation[k] = k;
+    }
+  }
+
+  // pad with copies of the last data point, which does not change the bounding boxes
+  const size_t blockCount = (numberDataPoints + DATA_BLOCK_SIZE - 1) / DATA_BLOCK_SIZE;
+  const size_t paddedSize = blockCount * DATA_BLOCK_SIZE;
+
+  this->preparedDataset.resize(dims, paddedSize);
+  this->blockMin.assign(blockCount * dims, 0.0);
+  this->blockMax.assign(blockCount * dims, 0.0);
+
+  for (size_t d = 0; d < dims; d++) {
+    double* row = this->preparedDataset.getPointer() + d * paddedSize;
+
+    for (size_t k = 0; k < paddedSize; k++) {
+      row[k] = data(this->permutation[std::min(k, numberDataPoints - 1)], d);
+    }
+
+    for (size_t b = 0; b < blockCount; b++) {
+      const double* blockBegin = row + b * DATA_BLOCK_SIZE;
+      const auto minMax = std::minmax_element(blockBegin, blockBegin + DATA_BLOCK_SIZE);
+      this->blockMin[b * dims + d] = *minMax.first;
+      this->blockMax[b * dims + d] = *minMax.second;
+    }
+  }
+}
+
+void OperationMultiEvalStreamingPoly::recalculateLevelAndIndex() {
+  const size_t gridSize = this->storage->getSize();
+  const size_t dims = this->storage->getDimension();
+  // see PolyBasis::evalBasis
+  const int64_t idxtable[4] = {1, 2, -2, -1};
+
+  this->scale_.resize(gridSize * dims);
+  this->index_.resize(gridSize * dims);
+  this->type_.resize(gridSize * dims);
+  this->coefficients.assign(gridSize * dims * degree, 0.0);
+
+  // in the coordinate y = 2^l * x - i, the 1D basis function of level l and index i is
+  // prod_k (1 + c_k * y) for |y| < 1 (Lagrange polynomial with the roots i + 1 / c_k)
+  for (size_t m = 0; m < gridSize; m++) {
+    const base::GridPoint& gp = (*this->storage)[m];
+
+    for (size_t d = 0; d < dims; d++) {
+      const size_t k = m * dims + d;
+      const base::level_t l = gp.getLevel(d);
+      const base::index_t i = gp.getIndex(d);
+      const base::index_t hInv = static_cast<base::index_t>(1) << l;
+      double* c = &this->coefficients[k * degree];
+
+      this->scale_[k] = static_cast<double>(hInv);
+      this->index_[k] = static_cast<double>(i);
+
+      if (this->modified && (l == 1)) {
+        this->type_[k] = BasisFunctionType::CONSTANT;
+      } else if (this->modified && (i == 1)) {
+        // 2 - 2^l * x
+        this->type_[k] = BasisFunctionType::LINEAR;
+        c[0] = -1.0;
+      } else if (this->modified && (i == hInv - 1)) {
+        // 2^l * x - i + 1
+        this->type_[k] = BasisFunctionType::LINEAR;
+        c[0] = 1.0;
+      } else {
+        this->type_[k] = BasisFunctionType::POLYNOMIAL;
+
+        // roots of the Lagrange polynomial (relative to i) in the same order as in
+        // PolyBasis::evalBasis: the right neighbor, the left neighbor and the ancestors
+        const size_t deg = std::min<size_t>(degree, l + 1);
+        const int64_t index = static_cast<int64_t>(i);
+        int64_t root = index - 1;
+        int64_t id = index;
+        c[0] = -1.0;
+
+        for (size_t r = 1; r < deg; r++) {
+          c[r] = -1.0 / static_cast<double>(root - index);
+          root += idxtable[id & 3] * (static_cast<int64_t>(1) << r);
+          id >>= 1;
+        }
+      }
+    }
+  }
+}
+
+inline bool OperationMultiEvalStreamingPoly::intersectsBlock(size_t gridIndex,
+                                                             size_t block) const {
+  const size_t dims = this->preparedDataset.getNrows();
+
+  for (size_t d = 0; d < dims; d++) {
+    const size_t k = gridIndex * dims + d;
+
+    if (type_[k] == BasisFunctionType::CONSTANT) {
+      continue;
+    }
+
+    // all basis functions vanish outside of |y| <= 1
+    const double yMin = blockMin[block * dims + d] * scale_[k] - index_[k];
+    const double yMax = blockMax[block * dims + d] * scale_[k] - index_[k];
+
+    if ((yMax < -1.0) || (yMin > 1.0)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <size_t P>
+inline bool OperationMultiEvalStreamingPoly::multiplyBasisFunction(size_t gridIndex, size_t d,
+                                                                   const double* data,
+                                                                   double* values) const {
+  const size_t p = (P == 0) ? degree : P;
+  const size_t dims = this->preparedDataset.getNrows();
+  const size_t k = gridIndex * dims + d;
+  const double scale = scale_[k];
+  const double index = index_[k];
+  const double* c = &coefficients[k * p];
+
+  if (type_[k] == BasisFunctionType::CONSTANT) {
+    return true;
+  } else if (type_[k] == BasisFunctionType::LINEAR) {
+    const double c0 = c[0];
+
+#pragma omp simd
+    for (size_t i = 0; i < DATA_BLOCK_SIZE; i++) {
+      const double y = data[i] * scale - index;
+      values[i] *= (std::abs(y) <= 1.0) ? (1.0 + c0 * y) : 0.0;
+    }
+  } else {
+#pragma omp simd
+    for (size_t i = 0; i < DATA_BLOCK_SIZE; i++) {
+      const double y = data[i] * scale - index;
+      double value = (std::abs(y) < 1.0) ? 1.0 : 0.0;
+
+      // the unused coefficients of lower levels are zero
+      for (size_t r = 0; r < p; r++) {
+        value *= 1.0 + c[r] * y;
+      }
+
+      values[i] *= value;
+    }
+  }
+
+  bool isNonZero = false;
+
+  for (size_t i = 0; i < DATA_BLOCK_SIZE; i++) {
+    isNonZero = isNonZero || (values[i] != 0.0);
+  }
+
+  return isNonZero;
+}
+
+void OperationMultiEvalStreamingPoly::mult(sgpp::base::DataVector& alpha,
+                                           sgpp::base::DataVector& result) {
+  this->myTimer_.start();
+
+  const size_t paddedSize = this->preparedDataset.getNcols();
+  const size_t blockCount = paddedSize / DATA_BLOCK_SIZE;
+  sgpp::base::DataVector sortedResult(paddedSize);
+  const double* ptrAlpha = alpha.getPointer();
+  double* ptrSortedResult = sortedResult.getPointer();
+
+#pragma omp parallel for schedule(dynamic)
+  for (size_t b = 0; b < blockCount; b++) {
+    this->multImpl(ptrAlpha, ptrSortedResult, b);
+  }
+
+  result.resize(numberDataPoints);
+
+  for (size_t k = 0; k < numberDataPoints; k++) {
+    result[this->permutation[k]] = sortedResult[k];
+  }
+
+  this->duration = this->myTimer_.stop();
+}
+
+void OperationMultiEvalStreamingPoly::multTranspose(sgpp::base::DataVector& source,
+                                                    sgpp::base::DataVector& result) {
+  this->myTimer_.start();
+
+  const size_t gridSize = this->storage->getSize();
+  // the padding area is zero
+  sgpp::base::DataVector sortedSource(this->preparedDataset.getNcols(), 0.0);
+
+  for (size_t k = 0; k < numberDataPoints; k++) {
+    sortedSource[k] = source[this->permutation[k]];
+  }
+
+  result.resize(gridSize);
+  const double* ptrSortedSource = sortedSource.getPointer();
+  double* ptrResult = result.getPointer();
+
+#pragma omp parallel for schedule(dynamic, 16)
+  for (size_t m = 0; m < gridSize; m++) {
+    this->multTransposeImpl(ptrSortedSource, ptrResult, m);
+  }
+
+  this->duration = this->myTimer_.stop();
+}
+
+void OperationMultiEvalStreamingPoly::multImpl(const double* alpha, double* result,
+                                               size_t block) {
+  switch (this->degree) {
+    case 2:
+      multImplDegree<2>(alpha, result, block);
+      break;
+    case 3:
+      multImplDegree<3>(alpha, result, block);
+      break;
+    case 4:
+      multImplDegree<4>(alpha, result, block);
+      break;
+    case 5:
+      multImplDegree<5>(alpha, result, block);
+      break;
+    default:
+      multImplDegree<0>(alpha, result, block);
+      break;
+  }
+}
+
+void OperationMultiEvalStreamingPoly::multTransposeImpl(const double* source, double* result,
+                                                        size_t gridIndex) {
+  switch (this->degree) {
+    case 2:
+      multTransposeImplDegree<2>(source, result, gridIndex);
+      break;
+    case 3:
+      multTransposeImplDegree<3>(source, result, gridIndex);
+      break;
+    case 4:
+      multTransposeImplDegree<4>(source, result, gridIndex);
+      break;
+    case 5:
+      multTransposeImplDegree<5>(source, result, gridIndex);
+      break;
+    default:
+      multTransposeImplDegree<0>(source, result, gridIndex);
+      break;
+  }
+}
+
+template <size_t P>
+void OperationMultiEvalStreamingPoly::multImplDegree(const double* alpha, double* result,
+                                                     size_t block) {
+  const double* ptrData = this->preparedDataset.getPointer();
+  const size_t dataSize = this->preparedDataset.getNcols();
+  const size_t dims = this->preparedDataset.getNrows();
+  const size_t gridSize = this->storage->getSize();
+  const size_t c = block * DATA_BLOCK_SIZE;
+
+  double values[DATA_BLOCK_SIZE];
+  double blockResult[DATA_BLOCK_SIZE] = {0.0};
+
+  for (size_t m = 0; m < gridSize; m++) {
+    const double support = alpha[m];
+
+    if ((support == 0.0) || !this->intersectsBlock(m, block)) {
+      continue;
+    }
+
+    for (size_t i = 0; i < DATA_BLOCK_SIZE; i++) {
+      values[i] = support;
+    }
+
+    bool isZero = false;
+
+    for (size_t d = 0; d < dims; d++) {
+      // skip the remaining dimensions if the basis function vanishes on the whole block
+      if (!this->multiplyBasisFunction<P>(m, d, &ptrData[d * dataSize + c], values)) {
+        isZero = true;
+        break;
+      }
+    }
+
+    if (isZero) {
+      continue;
+    }
+
+#pragma omp simd
+    for (size_t i = 0; i < DATA_BLOCK_SIZE; i++) {
+      blockResult[i] += values[i];
+    }
+  }
+
+  for (size_t i = 0; i < DATA_BLOCK_SIZE; i++) {
+    result[c + i] = blockResult[i];
+  }
+}
+
+template <size_t P>
+void OperationMultiEvalStreamingPoly::multTransposeImplDegree(const double* source,
+                                                              double* result, size_t gridIndex) {
+  const double* ptrData = this->preparedDataset.getPointer();
+  const size_t dataSize = this->preparedDataset.getNcols();
+  const size_t dims = this->preparedDataset.getNrows();
+  const size_t blockCount = dataSize / DATA_BLOCK_SIZE;
+
+  double values[DATA_BLOCK_SIZE];
+  double gridResult = 0.0;
+
+  for (size_t b = 0; b < blockCount; b++) {
+    if (!this->intersectsBlock(gridIndex, b)) {
+      continue;
+    }
+
+    const size_t c = b * DATA_BLOCK_SIZE;
+
+    for (size_t i = 0; i < DATA_BLOCK_SIZE; i++) {
+      values[i] = source[c + i];
+    }
+
+    bool isZero = false;
+
+    for (size_t d = 0; d < dims; d++) {
+      if (!this->multiplyBasisFunction<P>(gridIndex, d, &ptrData[d * dataSize + c], values)) {
+        isZero = true;
+        break;
+      }
+    }
+
+    if (isZero) {
+      continue;
+    }
+
+    double blockResult = 0.0;
+
+#pragma omp simd reduction(+ : blockResult)
+    for (size_t i = 0; i < DATA_BLOCK_SIZE; i++) {
+      blockResult += values[i];
+    }
+
+    gridResult += blockResult;
+  }
+
+  result[gridIndex] = gridResult;
+}
+
+double OperationMultiEvalStreamingPoly::getDuration() { return this->duration; }
+
+bool OperationMultiEvalStreamingPoly::isMortonOrdered() const { return this->mortonOrder; }
+
+void OperationMultiEvalStreamingPoly::prepare() { this->recalculateLevelAndIndex(); }
+
+}  // namespace datadriven
+}  // namespace sgpp
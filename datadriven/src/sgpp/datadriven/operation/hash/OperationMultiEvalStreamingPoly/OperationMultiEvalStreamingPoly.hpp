@@ -0,0 +1,163 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Streaming evaluation of polynomial and modified polynomial sparse grid functions on the CPU
+ * (OpenMP and SIMD, no CUDA required).
+ *
+ * The 1D basis function of a grid point is a Lagrange polynomial whose roots are the
+ * hierarchical ancestors of the grid point. In the coordinate \f$y = 2^\ell x - i\f$, all
+ * factors have the form \f$1 + c_k y\f$, so only the coefficients \f$c_k\f$ are precomputed
+ * per grid point and dimension. The evaluation of a block of data points is then free of
+ * branches and vectorizes.
+ *
+ * The data points are processed in blocks of DATA_BLOCK_SIZE. For every block, the bounding
+ * box of the data points is stored; grid points whose support does not intersect the bounding
+ * box are skipped without evaluating any basis function. If the data points are sorted along
+ * a Morton order curve (Z-curve), the bounding boxes are small and most of the grid points
+ * of the finer levels are skipped. The results of mult and the input of multTranspose are
+ * permuted accordingly, so the sorting is transparent to the caller.
+ */
+class OperationMultiEvalStreamingPoly : public base::OperationMultipleEval {
+ public:
+  /// maximal supported polynomial degree (same as for PolyBasis)
+  static const size_t MAX_DEGREE = 20;
+
+  /// number of data points that are processed at once by the kernels
+  static const size_t DATA_BLOCK_SIZE = 16;
+
+  /**
+   * Type of a 1D basis function, determined per grid point and dimension.
+   */
+  enum class BasisFunctionType : uint8_t {
+    /// constant function (level 1 of modified polynomial grids)
+    CONSTANT,
+    /// linear function at the boundary of modified polynomial grids
+    LINEAR,
+    /// Lagrange polynomial
+    POLYNOMIAL
+  };
+
+ protected:
+  /// transposed and padded dataset (sorted along the Morton order curve if enabled)
+  sgpp::base::DataMatrix preparedDataset;
+  /// position of the k-th data point of preparedDataset in the original dataset
+  std::vector<size_t> permutation;
+  /// per data block and dimension: smallest coordinate of the data points in the block
+  std::vector<double> blockMin;
+  /// per data block and dimension: largest coordinate of the data points in the block
+  std::vector<double> blockMax;
+  /// per grid point and dimension: \f$2^\ell\f$
+  std::vector<double> scale_;
+  /// per grid point and dimension: index \f$i\f$
+  std::vector<double> index_;
+  /// per grid point and dimension: type of the 1D basis function
+  std::vector<BasisFunctionType> type_;
+  /// per grid point, dimension and root: coefficients \f$c_k\f$ (padded with zeros)
+  std::vector<double> coefficients;
+  /// Timer object to handle time measurements
+  sgpp::base::SGppStopwatch myTimer_;
+
+  base::GridStorage* storage;
+
+  /// polynomial degree
+  size_t degree;
+  /// whether the grid is a modified polynomial grid
+  bool modified;
+  /// whether the data points are sorted along a Morton order curve
+  bool mortonOrder;
+  /// number of data points of the original dataset
+  size_t numberDataPoints;
+
+  double duration;
+
+ public:
+  /**
+   * Constructor.
+   *
+   * @param grid          polynomial or modified polynomial grid
+   * @param dataset       data points (one per row)
+   * @param mortonOrder   whether to sort the data points along a Morton order curve
+   */
+  OperationMultiEvalStreamingPoly(base::Grid& grid, base::DataMatrix& dataset,
+                                  bool mortonOrder = false);
+
+  ~OperationMultiEvalStreamingPoly() override;
+
+  void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) override;
+
+  void multTranspose(sgpp::base::DataVector& source, sgpp::base::DataVector& result) override;
+
+  void prepare() override;
+
+  double getDuration() override;
+
+  /**
+   * @return whether the data points are sorted along a Morton order curve
+   */
+  bool isMortonOrdered() const;
+
+ private:
+  void prepareDataset(const sgpp::base::DataMatrix& dataset);
+
+  void recalculateLevelAndIndex();
+
+  void multImpl(const double* alpha, double* result, size_t block);
+
+  void multTransposeImpl(const double* source, double* result, size_t gridIndex);
+
+  /**
+   * @tparam P  polynomial degree (0 to use the runtime degree)
+   */
+  template <size_t P>
+  void multImplDegree(const double* alpha, double* result, size_t block);
+
+  /**
+   * @tparam P  polynomial degree (0 to use the runtime degree)
+   */
+  template <size_t P>
+  void multTransposeImplDegree(const double* source, double* result, size_t gridIndex);
+
+  /**
+   * @param gridIndex sequence number of the grid point
+   * @param block     number of the data block
+   * @return          whether the support of the basis function of the grid point intersects
+   *                  the bounding box of the data block
+   */
+  inline bool intersectsBlock(size_t gridIndex, size_t block) const;
+
+  /**
+   * Multiplies the values of the 1D basis function of a grid point in one dimension
+   * to the values of a block of data points.
+   *
+   * @tparam P                polynomial degree (0 to use the runtime degree)
+   * @param         gridIndex sequence number of the grid point
+   * @param         d         dimension
+   * @param         data      coordinates of the data points in dimension d
+   * @param[in,out] values    values that are multiplied with the 1D values
+   *                          (DATA_BLOCK_SIZE entries)
+   * @return                  whether any of the resulting values is non-zero
+   */
+  template <size_t P>
+  inline bool multiplyBasisFunction(size_t gridIndex, size_t d, const double* data,
+                                    double* values) const;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
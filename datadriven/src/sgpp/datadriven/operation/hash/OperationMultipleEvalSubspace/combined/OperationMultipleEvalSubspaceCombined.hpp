@@ -3,10 +3,13 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#ifdef __AVX__
-
 #pragma once
 
+#include <sgpp/base/tools/CPUFeatures.hpp>
+
+// with runtime dispatch, the AVX code is compiled independently of the compiler flags
+#if defined(__AVX__) || defined(SGPP_RUNTIME_ISA_DISPATCH)
+
 #include <assert.h>
 #include <immintrin.h>
 #include <omp.h>
@@ -89,6 +92,7 @@ class OperationMultipleEvalSubspaceCombined : public AbstractOperationMultipleEv
   uint32_t flattenLevel(size_t dim, size_t maxLevel, std::vector<uint32_t>& level);
 
  public:
+  SGPP_TARGET("avx")
   static inline void calculateIndexCombined(size_t dim, size_t nextIterationToRecalc,
                                             const double* const (&dataTuplePtr)[4],
                                             std::vector<uint32_t>& hInversePtr,
@@ -203,6 +207,7 @@ class OperationMultipleEvalSubspaceCombined : public AbstractOperationMultipleEv
     _mm256_storeu_pd(phiEval, phiEvalReg);
   }
 
+  SGPP_TARGET("avx")
   static inline void calculateIndexCombined2(size_t dim, size_t nextIterationToRecalc,
                                              // rep
                                              const double* const (&dataTuplePtr)[4],
@@ -10,6 +10,7 @@
 namespace sgpp {
 namespace datadriven {
 
+SGPP_TARGET("avx")
 void OperationMultipleEvalSubspaceCombined::listMultInner(
     size_t dim, const double* const datasetPtr, sgpp::base::DataVector& alpha, size_t dataIndexBase,
     size_t end_index_data, SubspaceNodeCombined& subspace, double* levelArrayContinuous,
@@ -10,6 +10,7 @@
 namespace sgpp {
 namespace datadriven {
 
+SGPP_TARGET("avx")
 void OperationMultipleEvalSubspaceCombined::uncachedMultTransposeInner(
     size_t dim, const double* const datasetPtr, size_t dataIndexBase, size_t end_index_data,
     SubspaceNodeCombined& subspace, double* levelArrayContinuous, size_t validIndicesCount,
@@ -3,10 +3,13 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#ifdef __AVX__
-
 #pragma once
 
+#include <sgpp/base/tools/CPUFeatures.hpp>
+
+// with runtime dispatch, the AVX code is compiled independently of the compiler flags
+#if defined(__AVX__) || defined(SGPP_RUNTIME_ISA_DISPATCH)
+
 #include <iostream>
 #include <map>
 #include <vector>
@@ -5,13 +5,16 @@
 
 #include <sgpp/base/exception/file_exception.hpp>
 #include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/datadriven/tools/ParallelDataParser.hpp>
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
 #include <sgpp/base/tools/StringTokenizer.hpp>
 
 #include <math.h>
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <cstring>
@@ -50,6 +53,21 @@ Dataset ARFFTools::readARFFFromFile(const std::string& filename,
                                     size_t instanceCutoff,
                                     std::vector<size_t> selectedCols,
                                     std::vector<double> selectedTargets) {
+  std::unique_ptr<sgpp::base::MemoryMappedFile> file;
+
+  try {
+    file.reset(new sgpp::base::MemoryMappedFile(filename));
+  } catch (sgpp::base::file_exception&) {
+    // fall back to the stream (e.g., for empty files, which cannot be mapped)
+    file.reset();
+  }
+
+  if (file != nullptr) {
+    return ParallelDataParser::parse(file->getData(), file->getData() + file->getSize(), true,
+                                     false, hasTargets, instanceCutoff, selectedCols,
+                                     selectedTargets);
+  }
+
   std::ifstream stream(filename.c_str());
   if (!stream) {
     std::string msg = "readARFFFromFile: Unable to open file: " + filename;
@@ -65,8 +83,8 @@ Dataset ARFFTools::readARFFFromString(const std::string& content,
                                       size_t instanceCutoff,
                                       std::vector<size_t> selectedCols,
                                       std::vector<double> selectedTargets) {
-  std::istringstream stream(content);
-  return readARFF(stream, hasTargets, instanceCutoff, selectedCols, selectedTargets);
+  return ParallelDataParser::parse(content.data(), content.data() + content.size(), true, false,
+                                   hasTargets, instanceCutoff, selectedCols, selectedTargets);
 }
 
 void ARFFTools::readARFFSize(std::istream& stream,
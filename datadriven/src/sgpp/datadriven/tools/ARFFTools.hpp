@@ -99,7 +99,8 @@ class ARFFTools {
                                      std::vector<double> selectedTargets = std::vector<double>());
 
   /**
-   * Wrapper from input type: File. See readARFF for more details
+   * Wrapper from input type: File. See readARFF for more details. The file is memory-mapped and
+   * parsed in parallel (see ParallelDataParser).
    */
   static Dataset readARFFFromFile(const std::string& filename,
                                   bool hasTargets = true,
@@ -108,7 +109,8 @@ class ARFFTools {
                                   std::vector<double> selectedTargets = std::vector<double>());
 
   /**
-   * Wrapper from input type: String. See readARFF for more details
+   * Wrapper from input type: String. See readARFF for more details. The string is parsed in
+   * parallel (see ParallelDataParser).
    */
   static Dataset readARFFFromString(const std::string& content,
                                     bool hasTargets = true,
@@ -4,7 +4,9 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <sgpp/datadriven/tools/ParallelDataParser.hpp>
 #include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
 #include <sgpp/base/tools/StringTokenizer.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -12,6 +14,7 @@
 #include <math.h>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <algorithm>
 #include <sstream>
 #include <string>
@@ -28,6 +31,21 @@ Dataset CSVTools::readCSVFromFile(const std::string& filename,
                                   size_t instanceCutoff,
                                   std::vector<size_t> selectedCols,
                                   std::vector<double> selectedTargets) {
+  std::unique_ptr<sgpp::base::MemoryMappedFile> file;
+
+  try {
+    file.reset(new sgpp::base::MemoryMappedFile(filename));
+  } catch (sgpp::base::file_exception&) {
+    // fall back to the stream (e.g., for empty files, which cannot be mapped)
+    file.reset();
+  }
+
+  if (file != nullptr) {
+    return ParallelDataParser::parse(file->getData(), file->getData() + file->getSize(), false,
+                                     skipFirstLine, hasTargets, instanceCutoff, selectedCols,
+                                     selectedTargets);
+  }
+
   std::ifstream stream(filename.c_str());
   if (!stream.is_open()) {
     std::string msg = "Unable to open file: " + filename;
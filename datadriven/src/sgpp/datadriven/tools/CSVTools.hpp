@@ -86,7 +86,8 @@ class CSVTools {
                           std::vector<double> selectedTargets = std::vector<double>());
 
   /**
-   * Wrapper from input type: File. See readCSV for more details
+   * Wrapper from input type: File. See readCSV for more details. The file is memory-mapped and
+   * parsed in parallel (see ParallelDataParser).
    */
   static Dataset readCSVFromFile(const std::string& filename,
                                  bool skipFirstLine = false,
@@ -0,0 +1,235 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/FloatParser.hpp>
+
+#include <algorithm>
+#include <clocale>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/// powers of ten that are exactly representable as double
+const double POWERS_OF_TEN[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/// maximal decimal exponent of the fast path
+const int MAX_FAST_EXPONENT = 22;
+
+/// maximal mantissa of the fast path (2^53, i.e., exactly representable)
+const uint64_t MAX_FAST_MANTISSA = static_cast<uint64_t>(1) << 53;
+
+/// maximal number of significant digits that fit into the 64-bit mantissa
+const int MAX_SIGNIFICANT_DIGITS = 19;
+
+inline bool isDigit(char c) { return (c >= '0') && (c <= '9'); }
+
+inline bool isSpace(char c) {
+  return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r') || (c == '\f') || (c == '\v');
+}
+
+/**
+ * Case-insensitive check if [first, last) starts with the lower case string word.
+ */
+inline bool startsWith(const char* first, const char* last, const char* word) {
+  const size_t length = std::strlen(word);
+
+  if (static_cast<size_t>(last - first) < length) {
+    return false;
+  }
+
+  for (size_t i = 0; i < length; i++) {
+    if ((first[i] | 0x20) != word[i]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Correctly rounded conversion of the unsigned number [first, last) by the standard library.
+ */
+double parseSlow(const char* first, const char* last) {
+  const size_t length = static_cast<size_t>(last - first);
+  double value;
+
+  if (*std::localeconv()->decimal_point == '.') {
+    // strtod needs a null-terminated string, which is on the stack for typical numbers
+    char buffer[64];
+    std::string longBuffer;
+    char* string = buffer;
+
+    if (length >= sizeof(buffer)) {
+      longBuffer.assign(first, last);
+      string = &longBuffer[0];
+    } else {
+      std::memcpy(buffer, first, length);
+      buffer[length] = '\0';
+    }
+
+    value = std::strtod(string, nullptr);
+  } else {
+    // the global C locale uses a different decimal separator
+    std::istringstream stream(std::string(first, last));
+    stream.imbue(std::locale::classic());
+    stream >> value;
+
+    if (stream.fail()) {
+      // out of range
+      const char* exponent = std::find_if(first, last, [](char c) { return (c | 0x20) == 'e'; });
+      const bool isUnderflow = (exponent != last) && (*(exponent + 1) == '-');
+      value = (isUnderflow ? 0.0 : std::numeric_limits<double>::infinity());
+    }
+  }
+
+  return value;
+}
+
+}  // namespace
+
+const char* FloatParser::parse(const char* first, const char* last, double& value) {
+  const char* p = first;
+
+  while ((p < last) && isSpace(*p)) {
+    p++;
+  }
+
+  bool isNegative = false;
+
+  if ((p < last) && ((*p == '+') || (*p == '-'))) {
+    isNegative = (*p == '-');
+    p++;
+  }
+
+  const char* digitsBegin = p;
+
+  // special values
+  if (startsWith(p, last, "nan")) {
+    value = std::numeric_limits<double>::quiet_NaN();
+    return p + 3;
+  } else if (startsWith(p, last, "inf")) {
+    value = (isNegative ? -std::numeric_limits<double>::infinity()
+                        : std::numeric_limits<double>::infinity());
+    return p + (startsWith(p, last, "infinity") ? 8 : 3);
+  }
+
+  uint64_t mantissa = 0;
+  int numberOfSignificantDigits = 0;
+  int exponent = 0;
+  bool hasDigits = false;
+  bool isFast = true;
+
+  // integer part
+  while ((p < last) && isDigit(*p)) {
+    hasDigits = true;
+
+    if (numberOfSignificantDigits < MAX_SIGNIFICANT_DIGITS) {
+      mantissa = 10 * mantissa + static_cast<uint64_t>(*p - '0');
+      numberOfSignificantDigits += (mantissa > 0) ? 1 : 0;
+    } else {
+      isFast = false;
+    }
+
+    p++;
+  }
+
+  // fractional part
+  if ((p < last) && (*p == '.')) {
+    p++;
+
+    while ((p < last) && isDigit(*p)) {
+      hasDigits = true;
+
+      if (numberOfSignificantDigits < MAX_SIGNIFICANT_DIGITS) {
+        mantissa = 10 * mantissa + static_cast<uint64_t>(*p - '0');
+        numberOfSignificantDigits += (mantissa > 0) ? 1 : 0;
+        exponent--;
+      } else {
+        isFast = false;
+      }
+
+      p++;
+    }
+  }
+
+  if (!hasDigits) {
+    value = 0.0;
+    return first;
+  }
+
+  // exponent (only if followed by at least one digit)
+  if ((p < last) && ((*p | 0x20) == 'e')) {
+    const char* q = p + 1;
+    bool isExponentNegative = false;
+
+    if ((q < last) && ((*q == '+') || (*q == '-'))) {
+      isExponentNegative = (*q == '-');
+      q++;
+    }
+
+    if ((q < last) && isDigit(*q)) {
+      int explicitExponent = 0;
+
+      while ((q < last) && isDigit(*q)) {
+        if (explicitExponent < 100000) {
+          explicitExponent = 10 * explicitExponent + (*q - '0');
+        }
+
+        q++;
+      }
+
+      exponent += (isExponentNegative ? -explicitExponent : explicitExponent);
+      p = q;
+    }
+  }
+
+  if (mantissa == 0) {
+    value = 0.0;
+  } else if (isFast && (mantissa <= MAX_FAST_MANTISSA) && (exponent >= -MAX_FAST_EXPONENT) &&
+             (exponent <= MAX_FAST_EXPONENT)) {
+    // both the mantissa and the power of ten are exact, hence the result is correctly rounded
+    value = static_cast<double>(mantissa);
+    value = ((exponent < 0) ? value / POWERS_OF_TEN[-exponent] : value * POWERS_OF_TEN[exponent]);
+  } else {
+    value = parseSlow(digitsBegin, p);
+  }
+
+  value = (isNegative ? -value : value);
+  return p;
+}
+
+void FloatParser::parseLine(const char* first, const char* last, std::vector<double>& values) {
+  values.clear();
+
+  while (true) {
+    const char* separator =
+        static_cast<const char*>(std::memchr(first, ',', static_cast<size_t>(last - first)));
+    const char* fieldLast = ((separator == nullptr) ? last : separator);
+    double value;
+    parse(first, fieldLast, value);
+    values.push_back(value);
+
+    if (separator == nullptr) {
+      break;
+    }
+
+    first = separator + 1;
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
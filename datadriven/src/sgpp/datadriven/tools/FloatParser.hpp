@@ -0,0 +1,54 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Fast, locale-independent parsing of floating point numbers in text data files (ARFF, CSV).
+ *
+ * In contrast to atof/strtod, the decimal separator is always '.' (regardless of the global
+ * locale), and the input does not have to be null-terminated. Numbers with at most 19
+ * significant digits and a small decimal exponent (which is the case for most data files) are
+ * converted exactly with a single floating point multiplication or division (Clinger's fast
+ * path). All other numbers (e.g., with 17 significant digits) fall back to strtod, or to a stream
+ * with the classic "C" locale if the global locale has a different decimal separator, such that
+ * the result is always correctly rounded.
+ */
+class FloatParser {
+ public:
+  /**
+   * Parses a floating point number like atof, i.e., leading whitespace is skipped, the number
+   * may be followed by arbitrary characters, and the value is 0 if there is no number.
+   * Accepts an optional sign, decimal digits with an optional '.', an optional exponent
+   * ('e' or 'E'), and the special values "inf", "infinity", and "nan" (case-insensitive).
+   *
+   * @param first       pointer to the first character
+   * @param last        pointer past the last character
+   * @param[out] value  the parsed number
+   * @return pointer past the last character of the number
+   *         (first if there is no number)
+   */
+  static const char* parse(const char* first, const char* last, double& value);
+
+  /**
+   * Parses a line of comma-separated floating point numbers. Every field is parsed with
+   * #parse, i.e., empty fields are 0.
+   *
+   * @param first        pointer to the first character of the line
+   * @param last         pointer past the last character of the line (without newline)
+   * @param[out] values  the parsed numbers (one per field)
+   */
+  static void parseLine(const char* first, const char* last, std::vector<double>& values);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
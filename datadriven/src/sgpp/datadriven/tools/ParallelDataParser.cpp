@@ -0,0 +1,249 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/ParallelDataParser.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/tools/FloatParser.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+const size_t ParallelDataParser::DEFAULT_CHUNK_SIZE;
+
+namespace {
+
+/**
+ * Line-aligned part of the data and the results of the scan.
+ */
+struct Chunk {
+  /// pointer to the first character
+  const char* first;
+  /// pointer past the last character
+  const char* last;
+  /// number of data lines
+  size_t numberOfDataLines;
+  /// number of accepted instances (data lines with selected targets)
+  size_t numberOfInstances;
+  /// index of the first data line with a wrong number of columns (-1 if there is none)
+  size_t invalidDataLine;
+  /// index of the first instance in the dataset
+  size_t offset;
+};
+
+/**
+ * Reads the next line (without line break) and advances first to the beginning of the next line.
+ */
+inline void getLine(const char*& first, const char* last, const char*& lineFirst,
+                    const char*& lineLast) {
+  const char* newline =
+      static_cast<const char*>(std::memchr(first, '\n', static_cast<size_t>(last - first)));
+  lineFirst = first;
+  lineLast = ((newline == nullptr) ? last : newline);
+  first = ((newline == nullptr) ? last : newline + 1);
+
+  if ((lineLast > lineFirst) && (*(lineLast - 1) == '\r')) {
+    lineLast--;
+  }
+}
+
+/**
+ * Whether a line is a data line (not empty and, for ARFF, no header or comment line).
+ */
+inline bool isDataLine(const char* first, const char* last, bool isARFF) {
+  const size_t length = static_cast<size_t>(last - first);
+  return (length > 0) && (!isARFF || ((std::memchr(first, '%', length) == nullptr) &&
+                                      (std::memchr(first, '@', length) == nullptr)));
+}
+
+/**
+ * Parses the target (last column) of a data line.
+ */
+inline double parseTarget(const char* first, const char* last) {
+  const char* targetFirst = last;
+
+  while ((targetFirst > first) && (*(targetFirst - 1) != ',')) {
+    targetFirst--;
+  }
+
+  double target;
+  FloatParser::parse(targetFirst, last, target);
+  return target;
+}
+
+/**
+ * Whether the target is one of the selected targets (all targets if empty).
+ */
+inline bool isSelectedTarget(double target, const std::vector<double>& selectedTargets) {
+  // if no classes are specified, always accept the line
+  bool isSelected = selectedTargets.empty();
+
+  for (size_t i = 0; i < selectedTargets.size(); i++) {
+    isSelected = isSelected || (std::fabs(target - selectedTargets[i]) < 0.001);
+  }
+
+  return isSelected;
+}
+
+}  // namespace
+
+Dataset ParallelDataParser::parse(const char* first, const char* last, bool isARFF,
+                                  bool skipFirstLine, bool hasTargets, size_t instanceCutoff,
+                                  const std::vector<size_t>& selectedCols,
+                                  const std::vector<double>& selectedTargets, size_t chunkSize) {
+  const char* lineFirst;
+  const char* lineLast;
+
+  if (skipFirstLine && (first < last)) {
+    getLine(first, last, lineFirst, lineLast);
+  }
+
+  // the number of columns is determined by the first data line
+  size_t numberOfColumns = 0;
+
+  for (const char* p = first; p < last;) {
+    getLine(p, last, lineFirst, lineLast);
+
+    if (isDataLine(lineFirst, lineLast, isARFF)) {
+      numberOfColumns = std::count(lineFirst, lineLast, ',') + 1;
+      break;
+    }
+  }
+
+  const size_t maxDimension =
+      ((numberOfColumns == 0) ? 0 : numberOfColumns - (hasTargets ? 1 : 0));
+
+  // make sure selectedCols has admissible values if it is not empty
+  if (!selectedCols.empty() &&
+      (*std::max_element(selectedCols.begin(), selectedCols.end()) >= maxDimension)) {
+    throw sgpp::base::file_exception("ParallelDataParser: invalid column selection");
+  }
+
+  const size_t dimension = (selectedCols.empty() ? maxDimension : selectedCols.size());
+
+  // split into line-aligned chunks
+  std::vector<Chunk> chunks;
+  chunkSize = std::max(chunkSize, static_cast<size_t>(1));
+
+  for (const char* chunkFirst = first; chunkFirst < last;) {
+    const char* chunkLast =
+        chunkFirst + std::min(chunkSize, static_cast<size_t>(last - chunkFirst));
+    const char* newline = static_cast<const char*>(
+        std::memchr(chunkLast - 1, '\n', static_cast<size_t>(last - chunkLast + 1)));
+    chunkLast = ((newline == nullptr) ? last : newline + 1);
+    chunks.push_back(Chunk{chunkFirst, chunkLast, 0, 0, static_cast<size_t>(-1), 0});
+    chunkFirst = chunkLast;
+  }
+
+  const size_t numberOfChunks = chunks.size();
+
+  // 1. count the instances of every chunk and validate the number of columns
+#pragma omp parallel for schedule(dynamic) private(lineFirst, lineLast)
+  for (size_t c = 0; c < numberOfChunks; c++) {
+    Chunk& chunk = chunks[c];
+
+    for (const char* p = chunk.first; p < chunk.last;) {
+      getLine(p, chunk.last, lineFirst, lineLast);
+
+      if (!isDataLine(lineFirst, lineLast, isARFF)) {
+        continue;
+      }
+
+      if (static_cast<size_t>(std::count(lineFirst, lineLast, ',')) + 1 != numberOfColumns) {
+        chunk.invalidDataLine = chunk.numberOfDataLines;
+        break;
+      }
+
+      if (!hasTargets || selectedTargets.empty() ||
+          isSelectedTarget(parseTarget(lineFirst, lineLast), selectedTargets)) {
+        chunk.numberOfInstances++;
+      }
+
+      chunk.numberOfDataLines++;
+    }
+  }
+
+  size_t numberOfDataLines = 0;
+  size_t numberOfInstances = 0;
+
+  for (Chunk& chunk : chunks) {
+    if (chunk.invalidDataLine != static_cast<size_t>(-1)) {
+      std::string msg = "ParallelDataParser: Columns missing in line ";
+      msg.append(std::to_string(numberOfDataLines + chunk.invalidDataLine));
+      throw sgpp::base::file_exception(msg.c_str());
+    }
+
+    chunk.offset = numberOfInstances;
+    numberOfDataLines += chunk.numberOfDataLines;
+    numberOfInstances += chunk.numberOfInstances;
+  }
+
+  numberOfInstances = std::min(numberOfInstances, instanceCutoff);
+  Dataset dataset(numberOfInstances, dimension);
+  double* data = dataset.getData().getPointer();
+  double* targets = dataset.getTargets().getPointer();
+
+  // 2. parse the instances of every chunk into the rows of the dataset
+#pragma omp parallel private(lineFirst, lineLast)
+  {
+    std::vector<double> values;
+
+#pragma omp for schedule(dynamic)
+    for (size_t c = 0; c < numberOfChunks; c++) {
+      const Chunk& chunk = chunks[c];
+      size_t row = chunk.offset;
+
+      // chunks beyond the cutoff are not parsed
+      if (row >= numberOfInstances) {
+        continue;
+      }
+
+      for (const char* p = chunk.first; (p < chunk.last) && (row < numberOfInstances);) {
+        getLine(p, chunk.last, lineFirst, lineLast);
+
+        if (!isDataLine(lineFirst, lineLast, isARFF)) {
+          continue;
+        }
+
+        FloatParser::parseLine(lineFirst, lineLast, values);
+
+        // if we want a target, we remove it from line as we process it
+        if (hasTargets) {
+          const double target = values.back();
+          values.pop_back();
+
+          if (!isSelectedTarget(target, selectedTargets)) {
+            continue;
+          }
+
+          targets[row] = target;
+        }
+
+        double* rowData = data + row * dimension;
+
+        if (selectedCols.empty()) {
+          std::copy(values.begin(), values.end(), rowData);
+        } else {
+          for (size_t i = 0; i < selectedCols.size(); i++) {
+            rowData[i] = values[selectedCols[i]];
+          }
+        }
+
+        row++;
+      }
+    }
+  }
+
+  return dataset;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,64 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Multi-threaded parser for ARFF and CSV data that is completely in memory (e.g., a memory-mapped
+ * file, see sgpp::base::MemoryMappedFile).
+ *
+ * The data is split into line-aligned chunks, which are processed in parallel with OpenMP:
+ *  1. Every chunk is scanned for its data lines, i.e., the line breaks and commas are counted
+ *     (and the target is parsed if a class filter is given), which determines the number of
+ *     instances of every chunk and validates the number of columns.
+ *  2. After allocating the #sgpp::datadriven::Dataset, every chunk is parsed with
+ *     #sgpp::datadriven::FloatParser and its instances are written directly into the rows of the
+ *     dataset, starting at the prefix sum of the number of instances of the preceding chunks.
+ *     Chunks whose first instance is beyond the instance cutoff are skipped.
+ * Only the first step is a pass over the whole data, but it is cheap compared to parsing
+ * numbers, such that reading a dataset is bound by I/O rather than by parsing.
+ *
+ * The semantics are the same as of ARFFTools::readARFF and CSVTools::readCSV: Empty lines are
+ * skipped, the number of columns is determined by the first data line, and the target is the
+ * last column. For ARFF data, all lines containing '%' or '@' are skipped; for CSV data, the
+ * first line may be skipped. In addition, Windows line breaks ("\r\n") are accepted.
+ */
+class ParallelDataParser {
+ public:
+  /// default size of the chunks in bytes
+  static const size_t DEFAULT_CHUNK_SIZE = 1 << 20;
+
+  /**
+   * Parses ARFF or CSV data.
+   *
+   * @param first           pointer to the first character of the data
+   * @param last            pointer past the last character of the data
+   * @param isARFF          whether the data is in ARFF format (skips lines containing '%' or '@')
+   * @param skipFirstLine   whether the first line is skipped (e.g., CSV header)
+   * @param hasTargets      whether the data has targets (last column)
+   * @param instanceCutoff  maximal number of instances
+   * @param selectedCols    which columns are written to the dataset (empty for all columns),
+   *                        see ARFFTools::readARFF
+   * @param selectedTargets filter for targets (empty for all targets), see ARFFTools::readARFF
+   * @param chunkSize       approximate size of the chunks in bytes
+   * @return the parsed data
+   */
+  static Dataset parse(const char* first, const char* last, bool isARFF, bool skipFirstLine,
+                       bool hasTargets = true, size_t instanceCutoff = -1,
+                       const std::vector<size_t>& selectedCols = std::vector<size_t>(),
+                       const std::vector<double>& selectedTargets = std::vector<double>(),
+                       size_t chunkSize = DEFAULT_CHUNK_SIZE);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
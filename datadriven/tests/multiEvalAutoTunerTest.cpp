@@ -0,0 +1,217 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/json/JSON.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/MultipleEvalAutoTuner/MultipleEvalAutoTuner.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using sgpp::datadriven::MultipleEvalAutoTuner;
+using sgpp::datadriven::OperationMultipleEvalConfiguration;
+
+namespace {
+
+void checkTunedOperation(sgpp::base::Grid& grid, sgpp::base::DataMatrix& dataset,
+                         OperationMultipleEvalConfiguration& configuration) {
+  std::mt19937 generator(17);
+  std::uniform_real_distribution<double> uniformDistribution(-0.5, 0.5);
+
+  sgpp::base::DataVector alpha(grid.getSize());
+  sgpp::base::DataVector source(dataset.getNrows());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = uniformDistribution(generator);
+  }
+
+  for (size_t i = 0; i < source.getSize(); i++) {
+    source[i] = uniformDistribution(generator);
+  }
+
+  std::unique_ptr<sgpp::base::OperationMultipleEval> evalCompare(
+      sgpp::op_factory::createOperationMultipleEval(grid, dataset));
+  std::unique_ptr<sgpp::base::OperationMultipleEval> eval(
+      MultipleEvalAutoTuner::createOperation(grid, dataset, configuration));
+
+  sgpp::base::DataVector resultCompare(dataset.getNrows());
+  sgpp::base::DataVector result(dataset.getNrows());
+  evalCompare->mult(alpha, resultCompare);
+  eval->mult(alpha, result);
+
+  for (size_t i = 0; i < result.getSize(); i++) {
+    BOOST_CHECK_SMALL(result[i] - resultCompare[i], 1e-10);
+  }
+
+  sgpp::base::DataVector resultTransposeCompare(grid.getSize());
+  sgpp::base::DataVector resultTranspose(grid.getSize());
+  evalCompare->multTranspose(source, resultTransposeCompare);
+  eval->multTranspose(source, resultTranspose);
+
+  for (size_t i = 0; i < resultTranspose.getSize(); i++) {
+    BOOST_CHECK_SMALL(resultTranspose[i] - resultTransposeCompare[i], 1e-10);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestMultiEvalAutoTuner)
+
+BOOST_AUTO_TEST_CASE(TuneAndCache) {
+  const size_t dim = 3;
+  const size_t numberDataPoints = 500;
+  const std::string cacheFileName = "multiEvalAutoTunerTest.json";
+  std::remove(cacheFileName.c_str());
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+  sgpp::base::DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset(i, t) = uniformDistribution(generator);
+    }
+  }
+
+  std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+  grids.push_back(std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearGrid(dim)));
+  grids.push_back(std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModPolyGrid(dim, 3)));
+
+  for (std::unique_ptr<sgpp::base::Grid>& grid : grids) {
+    grid->getGenerator().regular(4);
+    MultipleEvalAutoTuner::clearMemoryCache();
+
+    MultipleEvalAutoTuner tuner(cacheFileName, 200, 1);
+    OperationMultipleEvalConfiguration configuration = tuner.tune(*grid, dataset);
+    checkTunedOperation(*grid, dataset, configuration);
+
+    // the winner was written to the cache file
+    const std::string key = tuner.getCacheKey(*grid);
+    json::JSON cacheFile(cacheFileName);
+    BOOST_CHECK(cacheFile.contains(key));
+
+    // a new tuner reads the configuration from the file
+    MultipleEvalAutoTuner::clearMemoryCache();
+    MultipleEvalAutoTuner otherTuner(cacheFileName);
+    OperationMultipleEvalConfiguration cachedConfiguration = otherTuner.tune(*grid, dataset);
+    BOOST_CHECK(cachedConfiguration.getType() == configuration.getType());
+    BOOST_CHECK(cachedConfiguration.getSubType() == configuration.getSubType());
+    checkTunedOperation(*grid, dataset, cachedConfiguration);
+  }
+
+  MultipleEvalAutoTuner::clearMemoryCache();
+  std::remove(cacheFileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentRetune) {
+  const size_t dim = 2;
+  const size_t numberDataPoints = 200;
+  const std::string cacheFileName = "multiEvalAutoTunerConcurrentTest.json";
+  std::remove(cacheFileName.c_str());
+
+  std::mt19937 generator(17);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+  sgpp::base::DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset(i, t) = uniformDistribution(generator);
+    }
+  }
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+  MultipleEvalAutoTuner::clearMemoryCache();
+
+  // tuners of several threads update the memory cache and the cache file
+  std::vector<OperationMultipleEvalConfiguration> configurations(3);
+  std::vector<std::thread> threads;
+
+  for (size_t t = 0; t < configurations.size(); t++) {
+    threads.emplace_back([&, t]() {
+      MultipleEvalAutoTuner tuner(cacheFileName, 100, 1);
+      configurations[t] =
+          (t % 2 == 0) ? tuner.retune(*grid, dataset) : tuner.tune(*grid, dataset);
+    });
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (OperationMultipleEvalConfiguration& configuration : configurations) {
+    checkTunedOperation(*grid, dataset, configuration);
+  }
+
+  // the cache file is complete
+  MultipleEvalAutoTuner tuner(cacheFileName);
+  json::JSON cacheFile(cacheFileName);
+  BOOST_CHECK(cacheFile.contains(tuner.getCacheKey(*grid)));
+
+  MultipleEvalAutoTuner::clearMemoryCache();
+  std::remove(cacheFileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(StreamingChunkSizes) {
+  const size_t dim = 2;
+  const size_t numberDataPoints = 300;
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+  sgpp::base::DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset(i, t) = uniformDistribution(generator);
+    }
+  }
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(5);
+
+  const sgpp::base::InstructionSet isa =
+      sgpp::datadriven::OperationMultiEvalStreaming::getBestInstructionSet();
+  const size_t unrolling =
+      sgpp::datadriven::OperationMultiEvalStreaming::getDataPointsUnrolling(isa);
+
+  // chunk sizes given by the configuration
+  sgpp::base::OperationConfiguration parameters;
+  parameters.addIDAttr("CHUNK_GRID_POINTS", static_cast<uint64_t>(24));
+  parameters.addIDAttr("CHUNK_DATA_POINTS", static_cast<uint64_t>(unrolling));
+  OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT, parameters, "STREAMING");
+
+  std::unique_ptr<sgpp::base::OperationMultipleEval> eval(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset, configuration));
+  auto streaming = dynamic_cast<sgpp::datadriven::OperationMultiEvalStreaming*>(eval.get());
+  BOOST_REQUIRE(streaming != nullptr);
+  BOOST_CHECK_EQUAL(streaming->getChunkGridPoints(), 24);
+  BOOST_CHECK_EQUAL(streaming->getChunkDataPoints(), unrolling);
+  checkTunedOperation(*grid, dataset, configuration);
+
+  // the data chunk must be a multiple of the unrolling
+  BOOST_CHECK_THROW(
+      sgpp::datadriven::OperationMultiEvalStreaming(*grid, dataset, isa, 12, unrolling + 1),
+      sgpp::base::operation_exception);
+  BOOST_CHECK_THROW(
+      sgpp::datadriven::OperationMultiEvalStreaming(*grid, dataset, isa, 0, unrolling),
+      sgpp::base::operation_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,196 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/datamining/builder/DataSourceBuilder.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/StreamingFileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::ARFFTools;
+using sgpp::datadriven::ArffFileSampleProvider;
+using sgpp::datadriven::CSVTools;
+using sgpp::datadriven::DataSourceFileType;
+using sgpp::datadriven::Dataset;
+using sgpp::datadriven::StreamingFileSampleProvider;
+
+BOOST_AUTO_TEST_SUITE(dataminingStreamingSampleProviderTest)
+
+/**
+ * Reads all samples in batches of the given size and checks them against the reference.
+ */
+void checkBatches(StreamingFileSampleProvider& sampleProvider, Dataset& reference,
+                  size_t batchSize) {
+  size_t offset = 0;
+
+  while (true) {
+    auto dataset = std::unique_ptr<Dataset>(sampleProvider.getNextSamples(batchSize));
+    const size_t size = dataset->getNumberInstances();
+    BOOST_CHECK_EQUAL(std::min(batchSize, reference.getNumberInstances() - offset), size);
+    BOOST_CHECK_EQUAL(reference.getDimension(), dataset->getDimension());
+
+    if (size == 0) {
+      break;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+      for (size_t j = 0; j < reference.getDimension(); j++) {
+        BOOST_CHECK_EQUAL(reference.getData().get(offset + i, j), dataset->getData().get(i, j));
+      }
+
+      BOOST_CHECK_EQUAL(reference.getTargets().get(offset + i), dataset->getTargets().get(i));
+    }
+
+    offset += size;
+  }
+
+  BOOST_CHECK_EQUAL(reference.getNumberInstances(), offset);
+}
+
+BOOST_AUTO_TEST_CASE(streamingTestReadArff) {
+  const std::string datasetPath = "datadriven/datasets/liver/liver-disorders_normalized.arff";
+
+  ArffFileSampleProvider arffSampleProvider;
+  arffSampleProvider.readFile(datasetPath, true);
+  auto reference = std::unique_ptr<Dataset>(arffSampleProvider.getAllSamples());
+
+  for (size_t chunkSize : {1, 7, 1000}) {
+    for (size_t batchSize : {1, 10, 345, 1000}) {
+      StreamingFileSampleProvider sampleProvider(DataSourceFileType::ARFF, chunkSize, 2);
+      sampleProvider.readFile(datasetPath, true);
+      BOOST_CHECK_EQUAL(reference->getDimension(), sampleProvider.getDim());
+      checkBatches(sampleProvider, *reference, batchSize);
+      BOOST_CHECK_EQUAL(reference->getNumberInstances(), sampleProvider.getNumSamples());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(streamingTestReadCsv) {
+  const std::string datasetPath = "datadriven/datasets/dataread/simple.csv";
+
+  for (bool hasTargets : {true, false}) {
+    Dataset reference = CSVTools::readCSVFromFile(datasetPath, true, hasTargets);
+    StreamingFileSampleProvider sampleProvider(DataSourceFileType::CSV, 2);
+    sampleProvider.readFile(datasetPath, hasTargets);
+    BOOST_CHECK_EQUAL(reference.getNumberInstances(), sampleProvider.getNumSamples());
+    checkBatches(sampleProvider, reference, 3);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(streamingTestReadinOptions) {
+  const std::string input =
+      "@RELATION test\n"
+      "% comment\n"
+      "@ATTRIBUTE x0 NUMERIC\n"
+      "@ATTRIBUTE x1 NUMERIC\n"
+      "@ATTRIBUTE x2 NUMERIC\n"
+      "@ATTRIBUTE class NUMERIC\n"
+      "@DATA\n"
+      "0.1,0.2,0.3,1\r\n"
+      "\n"
+      "1.1,1.2,1.3,-1\r\n"
+      "2.1,2.2,2.3,1\n"
+      "3.1,3.2,3.3,1\n"
+      "4.1,4.2,4.3,-1";
+  const std::vector<size_t> readinColumns = {2, 0};
+  const std::vector<double> readinClasses = {1.0};
+  Dataset reference = ARFFTools::readARFFFromString(input, true, 2, readinColumns, readinClasses);
+
+  StreamingFileSampleProvider sampleProvider(DataSourceFileType::ARFF, 1, 1);
+  sampleProvider.readString(input, true, 2, readinColumns, readinClasses);
+  BOOST_CHECK_EQUAL(2, sampleProvider.getDim());
+  BOOST_CHECK_EQUAL(2, sampleProvider.getNumSamples());
+  checkBatches(sampleProvider, reference, 1);
+
+  // reset starts at the beginning
+  sampleProvider.reset();
+  auto dataset = std::unique_ptr<Dataset>(sampleProvider.getAllSamples());
+  BOOST_CHECK_EQUAL(2, dataset->getNumberInstances());
+  BOOST_CHECK_EQUAL(2.3, dataset->getData().get(1, 0));
+  BOOST_CHECK_EQUAL(2.1, dataset->getData().get(1, 1));
+
+  // clones read the same input
+  auto clone = std::unique_ptr<sgpp::datadriven::SampleProvider>(sampleProvider.clone());
+  dataset = std::unique_ptr<Dataset>(clone->getNextSamples(1));
+  BOOST_CHECK_EQUAL(1, dataset->getNumberInstances());
+  BOOST_CHECK_EQUAL(0.3, dataset->getData().get(0, 0));
+
+  // invalid column selection
+  BOOST_CHECK_THROW(sampleProvider.readString(input, true, -1, {3}),
+                    sgpp::base::data_exception);
+}
+
+BOOST_AUTO_TEST_CASE(streamingTestErrors) {
+  StreamingFileSampleProvider sampleProvider(DataSourceFileType::CSV);
+  BOOST_CHECK_THROW(sampleProvider.getDim(), sgpp::base::file_exception);
+  BOOST_CHECK_THROW(sampleProvider.readFile("datadriven/datasets/dataread/missing.csv", true),
+                    sgpp::base::data_exception);
+
+  // columns missing in the third data line
+  StreamingFileSampleProvider invalidSampleProvider(DataSourceFileType::CSV, 1);
+  invalidSampleProvider.readString("x,y,t\n1,2,3\n4,5,6\n7,8\n", true);
+  auto dataset = std::unique_ptr<Dataset>(invalidSampleProvider.getNextSamples(1));
+  BOOST_CHECK_EQUAL(1, dataset->getNumberInstances());
+  BOOST_CHECK_THROW(invalidSampleProvider.getAllSamples(), sgpp::base::file_exception);
+}
+
+BOOST_AUTO_TEST_CASE(streamingTestDataSource) {
+  const std::string datasetPath = "datadriven/datasets/liver/liver-disorders_normalized.arff";
+
+  ArffFileSampleProvider arffSampleProvider;
+  arffSampleProvider.readFile(datasetPath, true);
+  auto reference = std::unique_ptr<Dataset>(arffSampleProvider.getAllSamples());
+
+  // the validation portion would require counting the samples
+  sgpp::datadriven::DataSourceBuilder builder;
+  builder.withPath(datasetPath).withStreaming(true).withBatchSize(50);
+  BOOST_CHECK_THROW(builder.splittingAssemble(), sgpp::base::data_exception);
+
+  builder.withValidationSize(20);
+  auto dataSource = std::unique_ptr<sgpp::datadriven::DataSourceSplitting>(
+      builder.splittingAssemble());
+  dataSource->reset();
+  Dataset* validationData = dataSource->getValidationData();
+  BOOST_CHECK_EQUAL(20, validationData->getNumberInstances());
+  BOOST_CHECK_EQUAL(reference->getData().get(19, 0), validationData->getData().get(19, 0));
+
+  auto dataset = std::unique_ptr<Dataset>(dataSource->getNextSamples());
+  BOOST_CHECK_EQUAL(50, dataset->getNumberInstances());
+  BOOST_CHECK_EQUAL(reference->getData().get(20, 1), dataset->getData().get(0, 1));
+  BOOST_CHECK_EQUAL(reference->getTargets().get(69), dataset->getTargets().get(49));
+}
+
+#ifdef ZLIB
+BOOST_AUTO_TEST_CASE(streamingTestReadGzip) {
+  ArffFileSampleProvider arffSampleProvider;
+  arffSampleProvider.readFile("datadriven/datasets/liver/liver-disorders_normalized_small.arff",
+                              true);
+  auto reference = std::unique_ptr<Dataset>(arffSampleProvider.getAllSamples());
+
+  StreamingFileSampleProvider sampleProvider(DataSourceFileType::ARFF, 3);
+  sampleProvider.readFile("datadriven/datasets/liver/liver-disorders_normalized_small.arff.gz",
+                          true);
+  BOOST_CHECK_EQUAL(reference->getNumberInstances(), sampleProvider.getNumSamples());
+  checkBatches(sampleProvider, *reference, 4);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
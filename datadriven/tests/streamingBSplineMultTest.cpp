@@ -0,0 +1,160 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef ZLIB
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/ConfigurationParameters.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingBSpline/OperationMultiEvalStreamingBSpline.hpp>
+#include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <zlib.h>
+
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "test_datadrivenCommon.hpp"
+
+namespace TestStreamingBSplineMultFixture {
+struct FilesNamesAndErrorFixture {
+  FilesNamesAndErrorFixture() {}
+  ~FilesNamesAndErrorFixture() {}
+
+  // mean squared errors compared to the naive operation (alpha[i] = i, so the results are large):
+  // the Cox-de Boor recursion rounds O(p^2) times and the supports are larger for higher
+  // degrees, so the tolerances depend on the degree; they are about two orders of magnitude
+  // above the errors of the scalar and the AVX2 kernel
+  std::vector<std::tuple<std::string, double>> fileNamesErrorDegree3 = {
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman2_4d_10000.arff.gz", 1E-21),
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman1_10d_2000.arff.gz", 1E-18)};
+
+  std::vector<std::tuple<std::string, double>> fileNamesErrorDegree5 = {
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman2_4d_10000.arff.gz", 1E-19),
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman1_10d_2000.arff.gz", 1E-16)};
+
+  uint32_t level = 4;
+};
+}  // namespace TestStreamingBSplineMultFixture
+
+BOOST_FIXTURE_TEST_SUITE(
+    TestStreamingBSplineMult,
+    TestStreamingBSplineMultFixture::FilesNamesAndErrorFixture)
+
+BOOST_AUTO_TEST_CASE(Simple) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  compareDatasets(fileNamesErrorDegree3, sgpp::base::GridType::Bspline, level, configuration, 3);
+  compareDatasets(fileNamesErrorDegree5, sgpp::base::GridType::Bspline, level, configuration, 5);
+}
+
+BOOST_AUTO_TEST_CASE(Modified) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  compareDatasets(fileNamesErrorDegree3, sgpp::base::GridType::ModBspline, level, configuration,
+                  3);
+  compareDatasets(fileNamesErrorDegree5, sgpp::base::GridType::ModBspline, level, configuration,
+                  5);
+}
+
+BOOST_AUTO_TEST_CASE(Degrees) {
+  const size_t dim = 3;
+  const size_t numberDataPoints = 100;
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+
+  sgpp::base::DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset(i, t) = uniformDistribution(generator);
+    }
+  }
+
+  std::vector<sgpp::base::InstructionSet> instructionSets;
+
+  for (sgpp::base::InstructionSet isa :
+       {sgpp::base::InstructionSet::SCALAR, sgpp::base::InstructionSet::AVX2}) {
+    if (sgpp::datadriven::OperationMultiEvalStreamingBSpline::isInstructionSetAvailable(isa)) {
+      instructionSets.push_back(isa);
+    }
+  }
+
+  // degrees with compile-time and runtime kernels
+  for (size_t degree : {1, 5, 7, 9}) {
+    std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+    grids.push_back(
+        std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createBsplineGrid(dim, degree)));
+    grids.push_back(
+        std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModBsplineGrid(dim, degree)));
+
+    for (std::unique_ptr<sgpp::base::Grid>& grid : grids) {
+      grid->getGenerator().regular(4);
+      const size_t gridSize = grid->getSize();
+
+      sgpp::base::DataVector alpha(gridSize);
+      sgpp::base::DataVector source(numberDataPoints);
+
+      for (size_t i = 0; i < gridSize; i++) {
+        alpha[i] = uniformDistribution(generator) - 0.5;
+      }
+
+      for (size_t i = 0; i < numberDataPoints; i++) {
+        source[i] = uniformDistribution(generator) - 0.5;
+      }
+
+      std::unique_ptr<sgpp::base::OperationMultipleEval> evalCompare(
+          sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset));
+      sgpp::base::DataVector resultCompare(numberDataPoints);
+      sgpp::base::DataVector resultTransposeCompare(gridSize);
+      evalCompare->mult(alpha, resultCompare);
+      evalCompare->multTranspose(source, resultTransposeCompare);
+
+      // all kernels that can be used on this CPU
+      for (sgpp::base::InstructionSet isa : instructionSets) {
+        sgpp::datadriven::OperationMultiEvalStreamingBSpline eval(*grid, dataset, isa);
+        BOOST_CHECK(eval.getInstructionSet() == isa);
+
+        sgpp::base::DataVector result(numberDataPoints);
+        eval.mult(alpha, result);
+
+        for (size_t i = 0; i < numberDataPoints; i++) {
+          BOOST_CHECK_SMALL(result[i] - resultCompare[i], 1e-9);
+        }
+
+        sgpp::base::DataVector resultTranspose(gridSize);
+        eval.multTranspose(source, resultTranspose);
+
+        for (size_t i = 0; i < gridSize; i++) {
+          BOOST_CHECK_SMALL(resultTranspose[i] - resultTransposeCompare[i], 1e-9);
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
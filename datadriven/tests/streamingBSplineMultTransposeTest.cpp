@@ -0,0 +1,83 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef ZLIB
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/ConfigurationParameters.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <zlib.h>
+
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "test_datadrivenCommon.hpp"
+
+namespace TestStreamingBSplineMultTransposeFixture {
+struct FilesNamesAndErrorFixture {
+  FilesNamesAndErrorFixture() {}
+  ~FilesNamesAndErrorFixture() {}
+
+  // mean squared errors compared to the naive operation (source[i] = i + 1, so the results are
+  // large sums): the Cox-de Boor recursion rounds O(p^2) times and the supports are larger for
+  // higher degrees, so the tolerances depend on the degree; they are about two orders of
+  // magnitude above the errors of the scalar and the AVX2 kernel
+  std::vector<std::tuple<std::string, double>> fileNamesErrorDegree3 = {
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman2_4d_10000.arff.gz", 1E-15),
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman1_10d_2000.arff.gz", 1E-19)};
+
+  std::vector<std::tuple<std::string, double>> fileNamesErrorDegree5 = {
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman2_4d_10000.arff.gz", 1E-13),
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman1_10d_2000.arff.gz", 1E-16)};
+
+  uint32_t level = 4;
+};
+}  // namespace TestStreamingBSplineMultTransposeFixture
+
+BOOST_FIXTURE_TEST_SUITE(
+    TestStreamingBSplineMultTranspose,
+    TestStreamingBSplineMultTransposeFixture::FilesNamesAndErrorFixture)
+
+BOOST_AUTO_TEST_CASE(Simple) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  compareDatasetsTranspose(fileNamesErrorDegree3, sgpp::base::GridType::Bspline, level,
+                           configuration, 3);
+  compareDatasetsTranspose(fileNamesErrorDegree5, sgpp::base::GridType::Bspline, level,
+                           configuration, 5);
+}
+
+BOOST_AUTO_TEST_CASE(Modified) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  compareDatasetsTranspose(fileNamesErrorDegree3, sgpp::base::GridType::ModBspline, level,
+                           configuration, 3);
+  compareDatasetsTranspose(fileNamesErrorDegree5, sgpp::base::GridType::ModBspline, level,
+                           configuration, 5);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -4,7 +4,6 @@
 // sgpp.sparsegrids.org
 
 #ifdef ZLIB
-#ifdef __AVX__
 
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
@@ -12,8 +11,10 @@
 #include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
 #include <sgpp/base/tools/ConfigurationParameters.hpp>
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
 #include <sgpp/datadriven/tools/ARFFTools.hpp>
 #include <sgpp/globaldef.hpp>
 
@@ -46,6 +47,7 @@ struct FilesNamesAndErrorFixture {
 BOOST_FIXTURE_TEST_SUITE(TestStreamingMult,
                          TestStreamingMultFixture::FilesNamesAndErrorFixture)
 
+#ifdef __AVX__
 BOOST_AUTO_TEST_CASE(Simple) {
   sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
       sgpp::datadriven::OperationMultipleEvalType::STREAMING,
@@ -54,8 +56,38 @@ BOOST_AUTO_TEST_CASE(Simple) {
   compareDatasets(fileNamesErrorDouble, sgpp::base::GridType::Linear, level,
                   configuration);
 }
+#endif
+
+BOOST_AUTO_TEST_CASE(AllInstructionSets) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  const sgpp::base::InstructionSet oldMaximum =
+      sgpp::base::CPUFeatures::getMaximumInstructionSet();
+
+  // determine the available kernels before limiting the instruction sets
+  std::vector<sgpp::base::InstructionSet> instructionSets;
+
+  for (sgpp::base::InstructionSet isa :
+       {sgpp::base::InstructionSet::SCALAR, sgpp::base::InstructionSet::SSE3,
+        sgpp::base::InstructionSet::AVX2, sgpp::base::InstructionSet::AVX512F}) {
+    if (sgpp::datadriven::OperationMultiEvalStreaming::isInstructionSetAvailable(isa)) {
+      instructionSets.push_back(isa);
+    }
+  }
+
+  for (sgpp::base::InstructionSet isa : instructionSets) {
+    BOOST_TEST_MESSAGE("instruction set: " << sgpp::base::CPUFeatures::toString(isa));
+    // the operation created by the factory uses the best instruction set up to the maximum
+    sgpp::base::CPUFeatures::setMaximumInstructionSet(isa);
+    compareDatasets(fileNamesErrorDouble, sgpp::base::GridType::Linear, level,
+                    configuration);
+  }
+
+  sgpp::base::CPUFeatures::setMaximumInstructionSet(oldMaximum);
+}
 
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
-#endif
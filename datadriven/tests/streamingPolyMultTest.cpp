@@ -0,0 +1,137 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingPoly/OperationMultiEvalStreamingPoly.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(TestStreamingPolyMult)
+
+BOOST_AUTO_TEST_CASE(CompareToDefault) {
+  const size_t dim = 3;
+  const size_t numberDataPoints = 300;
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+
+  sgpp::base::DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset(i, t) = uniformDistribution(generator);
+    }
+  }
+
+  // degrees with compile-time and runtime kernels
+  for (size_t degree : {2, 3, 6}) {
+    std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+    grids.push_back(
+        std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createPolyGrid(dim, degree)));
+    grids.push_back(
+        std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModPolyGrid(dim, degree)));
+
+    for (std::unique_ptr<sgpp::base::Grid>& grid : grids) {
+      grid->getGenerator().regular(5);
+      const size_t gridSize = grid->getSize();
+
+      sgpp::base::DataVector alpha(gridSize);
+      sgpp::base::DataVector source(numberDataPoints);
+
+      for (size_t i = 0; i < gridSize; i++) {
+        alpha[i] = uniformDistribution(generator) - 0.5;
+      }
+
+      for (size_t i = 0; i < numberDataPoints; i++) {
+        source[i] = uniformDistribution(generator) - 0.5;
+      }
+
+      std::unique_ptr<sgpp::base::OperationMultipleEval> evalCompare(
+          sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+
+      sgpp::base::DataVector resultCompare(numberDataPoints);
+      sgpp::base::DataVector resultTransposeCompare(gridSize);
+      evalCompare->mult(alpha, resultCompare);
+      evalCompare->multTranspose(source, resultTransposeCompare);
+
+      for (sgpp::datadriven::OperationMultipleEvalType type :
+           {sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+            sgpp::datadriven::OperationMultipleEvalType::MORTONORDER}) {
+        sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+            type, sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+        std::unique_ptr<sgpp::base::OperationMultipleEval> eval(
+            sgpp::op_factory::createOperationMultipleEval(*grid, dataset, configuration));
+
+        sgpp::base::DataVector result(numberDataPoints);
+        eval->mult(alpha, result);
+
+        for (size_t i = 0; i < numberDataPoints; i++) {
+          BOOST_CHECK_SMALL(result[i] - resultCompare[i], 1e-10);
+        }
+
+        sgpp::base::DataVector resultTranspose(gridSize);
+        eval->multTranspose(source, resultTranspose);
+
+        for (size_t i = 0; i < gridSize; i++) {
+          BOOST_CHECK_SMALL(resultTranspose[i] - resultTransposeCompare[i], 1e-10);
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MortonOrder) {
+  const size_t dim = 2;
+  const size_t numberDataPoints = 1000;
+
+  std::mt19937 generator(23);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+
+  sgpp::base::DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset(i, t) = uniformDistribution(generator);
+    }
+  }
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createPolyGrid(dim, 3));
+  grid->getGenerator().regular(6);
+
+  sgpp::datadriven::OperationMultiEvalStreamingPoly evalUnordered(*grid, dataset, false);
+  sgpp::datadriven::OperationMultiEvalStreamingPoly evalOrdered(*grid, dataset, true);
+  BOOST_CHECK(!evalUnordered.isMortonOrdered());
+  BOOST_CHECK(evalOrdered.isMortonOrdered());
+
+  // the sorting must not change the order of the results
+  sgpp::base::DataVector alpha(grid->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = uniformDistribution(generator);
+  }
+
+  sgpp::base::DataVector resultUnordered(numberDataPoints);
+  sgpp::base::DataVector resultOrdered(numberDataPoints);
+  evalUnordered.mult(alpha, resultUnordered);
+  evalOrdered.mult(alpha, resultOrdered);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    BOOST_CHECK_SMALL(resultOrdered[i] - resultUnordered[i], 1e-12);
+  }
+
+  // the dataset itself is not modified
+  BOOST_CHECK_EQUAL(dataset.getNrows(), numberDataPoints);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
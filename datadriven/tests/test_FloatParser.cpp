@@ -0,0 +1,89 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/datadriven/tools/FloatParser.hpp>
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using sgpp::datadriven::FloatParser;
+
+BOOST_AUTO_TEST_SUITE(test_FloatParser)
+
+BOOST_AUTO_TEST_CASE(test_parse_like_strtod) {
+  const std::vector<std::string> inputs = {"0",
+                                           "-0",
+                                           "1",
+                                           "-1",
+                                           "+42",
+                                           "0.1",
+                                           ".5",
+                                           "5.",
+                                           "  3.25",
+                                           "1e5",
+                                           "1E-5",
+                                           "-7e+00",
+                                           "0.307143",
+                                           "42.42",
+                                           "00012.5000",
+                                           "123456789012345678",
+                                           "1234567890123456789012345",
+                                           "0.1234567890123456789",
+                                           "9007199254740993",
+                                           "0.30714300000000001",
+                                           "-123.45678901234567e-3",
+                                           "1e22",
+                                           "1e23",
+                                           "-1e400",
+                                           "1e-400",
+                                           "4.9e-324",
+                                           "2.2250738585072014e-308",
+                                           "1.7976931348623157e308",
+                                           "3.14abc",
+                                           "2e",
+                                           "2e+",
+                                           "abc",
+                                           ""};
+
+  for (const std::string& input : inputs) {
+    double value;
+    const char* last = FloatParser::parse(input.data(), input.data() + input.size(), value);
+    char* strtodLast;
+    const double reference = std::strtod(input.c_str(), &strtodLast);
+
+    BOOST_CHECK_MESSAGE(value == reference, "input \"" << input << "\": " << value
+                                                       << " != " << reference);
+    BOOST_CHECK_EQUAL(std::signbit(value), std::signbit(reference));
+    BOOST_CHECK_EQUAL(static_cast<size_t>(strtodLast - input.c_str()),
+                      static_cast<size_t>(last - input.data()));
+  }
+
+  double value;
+  const std::string special = "-inf,nan,Infinity";
+  FloatParser::parse(special.data(), special.data() + 4, value);
+  BOOST_CHECK(std::isinf(value) && (value < 0.0));
+  FloatParser::parse(special.data() + 5, special.data() + 8, value);
+  BOOST_CHECK(std::isnan(value));
+  FloatParser::parse(special.data() + 9, special.data() + special.size(), value);
+  BOOST_CHECK(std::isinf(value) && (value > 0.0));
+}
+
+BOOST_AUTO_TEST_CASE(test_parse_line) {
+  const std::string line = "0.5,-1e2,,7,abc";
+  std::vector<double> values;
+  FloatParser::parseLine(line.data(), line.data() + line.size(), values);
+
+  const std::vector<double> reference = {0.5, -100.0, 0.0, 7.0, 0.0};
+  BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(), reference.begin(), reference.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
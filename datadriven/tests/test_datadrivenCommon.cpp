@@ -193,9 +193,11 @@ double compareVectors(sgpp::base::DataVector& results, sgpp::base::DataVector& r
 
 void compareDatasets(const std::vector<std::tuple<std::string, double>>& fileNamesError,
                      sgpp::base::GridType gridType, size_t level,
-                     sgpp::datadriven::OperationMultipleEvalConfiguration configuration) {
+                     sgpp::datadriven::OperationMultipleEvalConfiguration configuration,
+                     size_t degree) {
   for (std::tuple<std::string, double> fileNameError : fileNamesError) {
-    double mse = compareToReference(gridType, std::get<0>(fileNameError), level, configuration);
+    double mse = compareToReference(gridType, std::get<0>(fileNameError), level, configuration,
+                                    degree);
     BOOST_CHECK(mse < std::get<1>(fileNameError));
     std::cout << "expected error: " << std::get<1>(fileNameError) << ", observed error:" << mse
               << std::endl;
@@ -203,7 +205,8 @@ void compareDatasets(const std::vector<std::tuple<std::string, double>>& fileNam
 }
 
 double compareToReference(sgpp::base::GridType gridType, const std::string& fileName, size_t level,
-                          sgpp::datadriven::OperationMultipleEvalConfiguration configuration) {
+                          sgpp::datadriven::OperationMultipleEvalConfiguration configuration,
+                          size_t degree) {
   sgpp::base::AdaptivityConfiguration adaptivityConfig;
   adaptivityConfig.maxLevelType_ = false;
   adaptivityConfig.numRefinementPoints_ = 80;
@@ -226,6 +229,10 @@ double compareToReference(sgpp::base::GridType gridType, const std::string& file
     grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearGrid(dim));
   } else if (gridType == sgpp::base::GridType::ModLinear) {
     grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModLinearGrid(dim));
+  } else if (gridType == sgpp::base::GridType::Bspline) {
+    grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createBsplineGrid(dim, degree));
+  } else if (gridType == sgpp::base::GridType::ModBspline) {
+    grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModBsplineGrid(dim, degree));
   }
 
   sgpp::base::GridStorage& gridStorage = grid->getStorage();
@@ -267,10 +274,11 @@ double compareToReference(sgpp::base::GridType gridType, const std::string& file
 
 void compareDatasetsTranspose(const std::vector<std::tuple<std::string, double>>& fileNamesError,
                               sgpp::base::GridType gridType, size_t level,
-                              sgpp::datadriven::OperationMultipleEvalConfiguration configuration) {
+                              sgpp::datadriven::OperationMultipleEvalConfiguration configuration,
+                              size_t degree) {
   for (std::tuple<std::string, double> fileNameError : fileNamesError) {
-    double mse =
-        compareToReferenceTranspose(gridType, std::get<0>(fileNameError), level, configuration);
+    double mse = compareToReferenceTranspose(gridType, std::get<0>(fileNameError), level,
+                                             configuration, degree);
     BOOST_CHECK(mse < std::get<1>(fileNameError));
     std::cout << "expected error: " << std::get<1>(fileNameError) << ", observed error:" << mse
               << " (transposed)" << std::endl;
@@ -279,7 +287,7 @@ void compareDatasetsTranspose(const std::vector<std::tuple<std::string, double>>
 
 double compareToReferenceTranspose(
     sgpp::base::GridType gridType, const std::string& fileName, size_t level,
-    sgpp::datadriven::OperationMultipleEvalConfiguration configuration) {
+    sgpp::datadriven::OperationMultipleEvalConfiguration configuration, size_t degree) {
   sgpp::base::AdaptivityConfiguration adaptivityConfig;
   adaptivityConfig.maxLevelType_ = false;
   adaptivityConfig.numRefinementPoints_ = 80;
@@ -302,6 +310,10 @@ double compareToReferenceTranspose(
     grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearGrid(dim));
   } else if (gridType == sgpp::base::GridType::ModLinear) {
     grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModLinearGrid(dim));
+  } else if (gridType == sgpp::base::GridType::Bspline) {
+    grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createBsplineGrid(dim, degree));
+  } else if (gridType == sgpp::base::GridType::ModBspline) {
+    grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModBsplineGrid(dim, degree));
   }
 
   sgpp::base::GridStorage& gridStorage = grid->getStorage();
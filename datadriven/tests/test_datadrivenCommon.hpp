@@ -38,17 +38,20 @@ double compareVectors(sgpp::base::DataVector& results, sgpp::base::DataVector& r
 
 void compareDatasets(const std::vector<std::tuple<std::string, double>>& fileNamesError,
                      sgpp::base::GridType gridType, size_t level,
-                     sgpp::datadriven::OperationMultipleEvalConfiguration configuration);
+                     sgpp::datadriven::OperationMultipleEvalConfiguration configuration,
+                     size_t degree = 3);
 
 double compareToReference(sgpp::base::GridType gridType, const std::string& fileName, size_t level,
-                          sgpp::datadriven::OperationMultipleEvalConfiguration configuration);
+                          sgpp::datadriven::OperationMultipleEvalConfiguration configuration,
+                          size_t degree = 3);
 
 void compareDatasetsTranspose(const std::vector<std::tuple<std::string, double>>& fileNamesError,
                               sgpp::base::GridType gridType, size_t level,
-                              sgpp::datadriven::OperationMultipleEvalConfiguration configuration);
+                              sgpp::datadriven::OperationMultipleEvalConfiguration configuration,
+                              size_t degree = 3);
 double compareToReferenceTranspose(
     sgpp::base::GridType gridType, const std::string& fileName, size_t level,
-    sgpp::datadriven::OperationMultipleEvalConfiguration configuration);
+    sgpp::datadriven::OperationMultipleEvalConfiguration configuration, size_t degree = 3);
 
 void compareDatasetsDistributed(const std::vector<std::tuple<std::string, double>>& fileNamesError,
                                 sgpp::base::GridType gridType, size_t level,
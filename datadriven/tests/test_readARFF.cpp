@@ -8,18 +8,23 @@
 #include <boost/test/unit_test.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
 
 #include <sgpp/datadriven/tools/Dataset.hpp>
 #include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/datadriven/tools/ParallelDataParser.hpp>
 
+#include <fstream>
 #include <string>
 #include <iostream>
+#include <sstream>
 #include <vector>
 
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::datadriven::Dataset;
 using sgpp::datadriven::ARFFTools;
+using sgpp::datadriven::ParallelDataParser;
 
 
 BOOST_AUTO_TEST_SUITE(test_dataread_arff)
@@ -175,4 +180,40 @@ BOOST_AUTO_TEST_CASE(test_read_arff_old) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(test_parallel_read) {
+  std::ifstream file("datadriven/datasets/liver/liver-disorders_normalized.arff");
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  const std::string content = buffer.str();
+
+  const std::vector<size_t> cols = {4, 0, 2};
+  const std::vector<double> classes = {1.0};
+
+  const std::vector<size_t> chunkSizes = {1, 100, 4096, ParallelDataParser::DEFAULT_CHUNK_SIZE};
+
+  for (size_t chunkSize : chunkSizes) {
+    for (size_t cutoff : {static_cast<size_t>(-1), static_cast<size_t>(100)}) {
+      std::istringstream stream(content);
+      Dataset reference = ARFFTools::readARFF(stream, true, cutoff, cols, classes);
+      Dataset d = ParallelDataParser::parse(content.data(), content.data() + content.size(), true,
+                                            false, true, cutoff, cols, classes, chunkSize);
+
+      BOOST_CHECK_EQUAL(reference.getNumberInstances(), d.getNumberInstances());
+      BOOST_CHECK_EQUAL(reference.getDimension(), d.getDimension());
+      reference.getData().sub(d.getData());
+      reference.getTargets().sub(d.getTargets());
+      BOOST_CHECK_EQUAL(reference.getData().max(), 0.0);
+      BOOST_CHECK_EQUAL(reference.getData().min(), 0.0);
+      BOOST_CHECK_EQUAL(reference.getTargets().l2Norm(), 0.0);
+    }
+  }
+
+  // columns missing in the third data line
+  const std::string invalidContent = "@DATA\n1,2,3\n4,5,6\n7,8\n9,10,11\n";
+  BOOST_CHECK_THROW(ParallelDataParser::parse(invalidContent.data(),
+                                              invalidContent.data() + invalidContent.size(),
+                                              true, false, true, -1, {}, {}, 4),
+                    sgpp::base::file_exception);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
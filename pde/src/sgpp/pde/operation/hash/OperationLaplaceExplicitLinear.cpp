@@ -28,6 +28,77 @@
 namespace sgpp {
 namespace pde {
 
+namespace {
+
+/**
+ * Computes an entry of the Laplace matrix
+ * \f$(\nabla\Phi_i,\nabla\Phi_j)_{L2} = \sum_k (\phi_{i_k}',\phi_{j_k}')_{L2}
+ * \prod_{t \neq k} (\phi_{i_t},\phi_{j_t})_{L2}\f$.
+ * The derivatives of two different hierarchical hat functions with overlapping supports are
+ * orthogonal, as the derivative of the larger function is constant on the support of the
+ * smaller one.
+ *
+ * @param level levels of the grid points as returned by getLevelIndexArraysForEval
+ * @param index indices of the grid points as returned by getLevelIndexArraysForEval
+ * @param widths widths of the bounding box
+ * @param i first grid point
+ * @param j second grid point
+ * @return entry of the Laplace matrix
+ */
+double computeEntry(const sgpp::base::DataMatrix& level, const sgpp::base::DataMatrix& index,
+                    const std::vector<double>& widths, size_t i, size_t j) {
+  const size_t gridDim = level.getNcols();
+  std::vector<double> mass(gridDim);
+  std::vector<bool> samePoint(gridDim);
+
+  for (size_t k = 0; k < gridDim; k++) {
+    const double lik = level.get(i, k);
+    const double ljk = level.get(j, k);
+    const double iik = index.get(i, k);
+    const double ijk = index.get(j, k);
+    samePoint[k] = (lik == ljk) && (iik == ijk);
+
+    if (samePoint[k]) {
+      mass[k] = 2 / lik / 3;
+    } else if ((lik == ljk) || (std::max((iik - 1) / lik, (ijk - 1) / ljk) >=
+                                std::min((iik + 1) / lik, (ijk + 1) / ljk))) {
+      return 0.;
+    } else {
+      // the hat function of the higher level is the "smaller" one
+      const double lSmall = std::max(lik, ljk);
+      const double lLarge = std::min(lik, ljk);
+      const double diff = (lik > ljk) ? (iik / lik) - (ijk / ljk) : (ijk / ljk) - (iik / lik);
+      double temp_res = fabs(diff - (1 / lSmall)) + fabs(diff + (1 / lSmall)) - fabs(diff);
+      temp_res *= lLarge;
+      mass[k] = (1 - temp_res) / lSmall;
+    }
+
+    mass[k] *= widths[k];
+  }
+
+  double res = 0.;
+
+  for (size_t k = 0; k < gridDim; k++) {
+    if (!samePoint[k]) {
+      continue;
+    }
+
+    double temp_res = 2 * level.get(i, k) / widths[k];
+
+    for (size_t t = 0; t < gridDim; t++) {
+      if (t != k) {
+        temp_res *= mass[t];
+      }
+    }
+
+    res += temp_res;
+  }
+
+  return res;
+}
+
+}  // namespace
+
 OperationLaplaceExplicitLinear::OperationLaplaceExplicitLinear(sgpp::base::DataMatrix* m,
                                                                sgpp::base::GridStorage* storage)
   : UpDownOneOpDim(storage), ownsMatrix_(false) {
@@ -37,11 +108,30 @@ OperationLaplaceExplicitLinear::OperationLaplaceExplicitLinear(sgpp::base::DataM
 
 OperationLaplaceExplicitLinear::OperationLaplaceExplicitLinear(sgpp::base::GridStorage* storage)
   : UpDownOneOpDim(storage), ownsMatrix_(true) {
-  m_ = new sgpp::base::DataMatrix(storage->getSize(), storage->getSize());
+  m_ = nullptr;
   buildMatrix(storage);
 }
 
 void OperationLaplaceExplicitLinear::buildMatrix(sgpp::base::GridStorage* storage) {
+  if (m_ == nullptr) {
+    const size_t gridSize = storage->getSize();
+    const size_t gridDim = storage->getDimension();
+    sgpp::base::DataMatrix level(gridSize, gridDim);
+    sgpp::base::DataMatrix index(gridSize, gridDim);
+    storage->getLevelIndexArraysForEval(level, index);
+    std::vector<double> widths(gridDim);
+
+    for (size_t k = 0; k < gridDim; k++) {
+      widths[k] = storage->getBoundingBox()->getIntervalWidth(k);
+    }
+
+    sparseMatrix_.reset(new SparseSymmetricMatrix(
+        *storage, [&level, &index, &widths](size_t i, size_t j) {
+          return computeEntry(level, index, widths, i, j);
+        }));
+    return;
+  }
+
   size_t ncols = m_->getNcols();
   base::DataVector alpha(ncols);
   base::DataVector beta(ncols);
@@ -60,6 +150,11 @@ OperationLaplaceExplicitLinear::~OperationLaplaceExplicitLinear() {
 
 void OperationLaplaceExplicitLinear::mult(sgpp::base::DataVector& alpha,
                                           sgpp::base::DataVector& result) {
+  if (sparseMatrix_) {
+    sparseMatrix_->mult(alpha, result);
+    return;
+  }
+
   size_t nrows = m_->getNrows();
   size_t ncols = m_->getNcols();
 
@@ -67,20 +162,19 @@ void OperationLaplaceExplicitLinear::mult(sgpp::base::DataVector& alpha,
     throw sgpp::base::data_exception("Dimensions do not match!");
   }
 
-  double* data = m_->getPointer();
+  const double* data = m_->getPointer();
 
   // Standard matrix multiplication:
-  double temp = 0.;
-  size_t acc = 0;
-
+#pragma omp parallel for schedule(static)
   for (size_t i = 0; i < nrows; i++) {
+    const double* row = data + i * ncols;
+    double temp = 0.;
+
     for (size_t j = 0; j < ncols; j++) {
-      temp += data[j + acc] * alpha[j];
+      temp += row[j] * alpha[j];
     }
 
     result[i] = temp;
-    temp = 0.;
-    acc += ncols;
   }
 }
 
@@ -8,10 +8,13 @@
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/pde/operation/hash/SparseSymmetricMatrix.hpp>
 #include <sgpp/pde/operation/hash/OperationLaplaceLinear.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
+
 namespace sgpp {
 namespace pde {
 
@@ -30,7 +33,9 @@ class OperationLaplaceExplicitLinear : public UpDownOneOpDim {
   OperationLaplaceExplicitLinear(sgpp::base::DataMatrix* m, sgpp::base::GridStorage* storage);
   /**
    * Constructor that creates an own matrix
-   * i.e. matrix is destroyed by the destructor of OperationLaplaceExplicitLinear
+   * i.e. matrix is destroyed by the destructor of OperationLaplaceExplicitLinear.
+   * The matrix is assembled in parallel into a sparse symmetric matrix, as only the entries
+   * of overlapping basis functions are non-zero.
    *
    * @param storage pointer to the sparse grid storage
    */
@@ -67,6 +72,7 @@ class OperationLaplaceExplicitLinear : public UpDownOneOpDim {
 
   sgpp::base::DataMatrix* m_;
   bool ownsMatrix_;
+  std::unique_ptr<SparseSymmetricMatrix> sparseMatrix_;
 };
 
 }  // namespace pde
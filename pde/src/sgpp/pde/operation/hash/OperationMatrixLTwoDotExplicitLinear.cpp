@@ -30,12 +30,24 @@ OperationMatrixLTwoDotExplicitLinear::OperationMatrixLTwoDotExplicitLinear(
 
 OperationMatrixLTwoDotExplicitLinear::OperationMatrixLTwoDotExplicitLinear(sgpp::base::Grid* grid)
     : ownsMatrix_(true) {
-  m_ = new sgpp::base::DataMatrix(grid->getSize(), grid->getSize());
+  m_ = nullptr;
   buildMatrix(grid);
 }
 
 void OperationMatrixLTwoDotExplicitLinear::buildMatrix(sgpp::base::Grid* grid) {
-  this->buildMatrixWithBounds(this->m_, grid);
+  if (m_ != nullptr) {
+    this->buildMatrixWithBounds(this->m_, grid);
+    return;
+  }
+
+  size_t gridSize = grid->getSize();
+  size_t gridDim = grid->getDimension();
+  sgpp::base::DataMatrix level(gridSize, gridDim);
+  sgpp::base::DataMatrix index(gridSize, gridDim);
+  grid->getStorage().getLevelIndexArraysForEval(level, index);
+  sparseMatrix_.reset(new SparseSymmetricMatrix(
+      grid->getStorage(),
+      [&level, &index](size_t i, size_t j) { return computeEntry(level, index, i, j); }));
 }
 
 OperationMatrixLTwoDotExplicitLinear::~OperationMatrixLTwoDotExplicitLinear() {
@@ -44,6 +56,11 @@ OperationMatrixLTwoDotExplicitLinear::~OperationMatrixLTwoDotExplicitLinear() {
 
 void OperationMatrixLTwoDotExplicitLinear::mult(sgpp::base::DataVector& alpha,
                                                 sgpp::base::DataVector& result) {
+  if (sparseMatrix_) {
+    sparseMatrix_->mult(alpha, result);
+    return;
+  }
+
   size_t nrows = m_->getNrows();
   size_t ncols = m_->getNcols();
 
@@ -51,20 +68,19 @@ void OperationMatrixLTwoDotExplicitLinear::mult(sgpp::base::DataVector& alpha,
     throw sgpp::base::data_exception("Dimensions do not match!");
   }
 
-  double* data = m_->getPointer();
+  const double* data = m_->getPointer();
 
   // Standard matrix multiplication:
-  double temp = 0.;
-  size_t acc = 0;
-
+#pragma omp parallel for schedule(static)
   for (size_t i = 0; i < nrows; i++) {
+    const double* row = data + i * ncols;
+    double temp = 0.;
+
     for (size_t j = 0; j < ncols; j++) {
-      temp += data[j + acc] * alpha[j];
+      temp += row[j] * alpha[j];
     }
 
     result[i] = temp;
-    temp = 0.;
-    acc += ncols;
   }
 }
 
@@ -8,11 +8,13 @@
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/pde/operation/hash/SparseSymmetricMatrix.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 
 #include <sgpp/globaldef.hpp>
 
 #include <algorithm>
+#include <memory>
 
 namespace sgpp {
 namespace pde {
@@ -38,7 +40,9 @@ class OperationMatrixLTwoDotExplicitLinear : public sgpp::base::OperationMatrix
 
   /**
    * Constructor that creates an own matrix
-   * i.e. matrix is destroyed by the destructor of OperationMatrixLTwoDotExplicitLinearFullGrid
+   * i.e. matrix is destroyed by the destructor of OperationMatrixLTwoDotExplicitLinear.
+   * The matrix is assembled in parallel into a sparse symmetric matrix, as only the entries
+   * of overlapping basis functions are non-zero.
    *
    * @param grid the sparse grid
    */
@@ -57,6 +61,62 @@ class OperationMatrixLTwoDotExplicitLinear : public sgpp::base::OperationMatrix
    */
   virtual void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
+  /**
+   * Computes an entry of the L2-dot-product matrix.
+   *
+   * @param level levels of the grid points as returned by getLevelIndexArraysForEval
+   * @param index indices of the grid points as returned by getLevelIndexArraysForEval
+   * @param i first grid point
+   * @param j second grid point
+   * @return L2 product of the basis functions of the grid points
+   */
+  static inline double computeEntry(const sgpp::base::DataMatrix& level,
+                                    const sgpp::base::DataMatrix& index, size_t i, size_t j) {
+    double res = 1;
+
+    for (size_t k = 0; k < level.getNcols(); k++) {
+      double lik = level.get(i, k);
+      double ljk = level.get(j, k);
+      double iik = index.get(i, k);
+      double ijk = index.get(j, k);
+
+      if (lik == ljk) {
+        if (iik == ijk) {
+          // Use formula for identical ansatz functions:
+          res *= 2 / lik / 3;
+        } else {
+          // Different index, but same level => ansatz functions do not overlap:
+          res = 0.;
+          break;
+        }
+      } else {
+        if (std::max((iik - 1) / lik, (ijk - 1) / ljk) >=
+            std::min((iik + 1) / lik, (ijk + 1) / ljk)) {
+          // Ansatz functions do not not overlap:
+          res = 0.;
+          break;
+        } else {
+          // Use formula for different overlapping ansatz functions:
+          if (lik > ljk) {  // Phi_i_k is the "smaller" ansatz function
+            double diff = (iik / lik) - (ijk / ljk);  // x_i_k - x_j_k
+            double temp_res = fabs(diff - (1 / lik)) + fabs(diff + (1 / lik)) - fabs(diff);
+            temp_res *= ljk;
+            temp_res = (1 - temp_res) / lik;
+            res *= temp_res;
+          } else {  // Phi_j_k is the "smaller" ansatz function
+            double diff = (ijk / ljk) - (iik / lik);  // x_j_k - x_i_k
+            double temp_res = fabs(diff - (1 / ljk)) + fabs(diff + (1 / ljk)) - fabs(diff);
+            temp_res *= lik;
+            temp_res = (1 - temp_res) / ljk;
+            res *= temp_res;
+          }
+        }
+      }
+    }
+
+    return res;
+  }
+
   /**
    * generalization of "buildMatrix" function, creates L2-dot-product matrix for specified bounds
    * @param mat matrix for storage of L2 producs
@@ -88,47 +148,8 @@ class OperationMatrixLTwoDotExplicitLinear : public sgpp::base::OperationMatrix
       j_end = j_end == 0 ? gridSize : j_end;
 #pragma omp parallel for schedule(guided)
       for (size_t j = j_start; j < j_end; j++) {
-        double res = 1;
-
-        for (size_t k = 0; k < gridDim; k++) {
-          double lik = level.get(i, k);
-          double ljk = level.get(j, k);
-          double iik = index.get(i, k);
-          double ijk = index.get(j, k);
-
-          if (lik == ljk) {
-            if (iik == ijk) {
-              // Use formula for identical ansatz functions:
-              res *= 2 / lik / 3;
-            } else {
-              // Different index, but same level => ansatz functions do not overlap:
-              res = 0.;
-              break;
-            }
-          } else {
-            if (std::max((iik - 1) / lik, (ijk - 1) / ljk) >=
-                std::min((iik + 1) / lik, (ijk + 1) / ljk)) {
-              // Ansatz functions do not not overlap:
-              res = 0.;
-              break;
-            } else {
-              // Use formula for different overlapping ansatz functions:
-              if (lik > ljk) {  // Phi_i_k is the "smaller" ansatz function
-                double diff = (iik / lik) - (ijk / ljk);  // x_i_k - x_j_k
-                double temp_res = fabs(diff - (1 / lik)) + fabs(diff + (1 / lik)) - fabs(diff);
-                temp_res *= ljk;
-                temp_res = (1 - temp_res) / lik;
-                res *= temp_res;
-              } else {  // Phi_j_k is the "smaller" ansatz function
-                double diff = (ijk / ljk) - (iik / lik);  // x_j_k - x_i_k
-                double temp_res = fabs(diff - (1 / ljk)) + fabs(diff + (1 / ljk)) - fabs(diff);
-                temp_res *= lik;
-                temp_res = (1 - temp_res) / ljk;
-                res *= temp_res;
-              }
-            }
-          }
-        }
+        double res = computeEntry(level, index, i, j);
+
         if (mat_quadratic) {
           mat->set(i, j, res);
           mat->set(j, i, res);
@@ -147,6 +168,7 @@ class OperationMatrixLTwoDotExplicitLinear : public sgpp::base::OperationMatrix
 
   sgpp::base::DataMatrix* m_;
   bool ownsMatrix_;
+  std::unique_ptr<SparseSymmetricMatrix> sparseMatrix_;
 };
 
 }  // namespace pde
@@ -34,12 +34,22 @@ OperationMatrixLTwoDotExplicitModLinear::OperationMatrixLTwoDotExplicitModLinear
 OperationMatrixLTwoDotExplicitModLinear::OperationMatrixLTwoDotExplicitModLinear(
     sgpp::base::Grid* grid)
     : ownsMatrix_(true) {
-  m_ = new sgpp::base::DataMatrix(grid->getSize(), grid->getSize());
+  m_ = nullptr;
   buildMatrix(grid);
 }
 
 void OperationMatrixLTwoDotExplicitModLinear::buildMatrix(sgpp::base::Grid* grid) {
-  this->buildMatrixWithBounds(this->m_, grid);
+  if (m_ != nullptr) {
+    this->buildMatrixWithBounds(this->m_, grid);
+    return;
+  }
+
+  base::GridStorage& storage = grid->getStorage();
+  base::SLinearModifiedBase& basis = const_cast<base::SLinearModifiedBase&>(
+      dynamic_cast<const base::SLinearModifiedBase&>(grid->getBasis()));
+  sparseMatrix_.reset(new SparseSymmetricMatrix(
+      grid->getStorage(),
+      [&storage, &basis](size_t i, size_t j) { return computeEntry(storage, basis, i, j); }));
 }
 
 OperationMatrixLTwoDotExplicitModLinear::~OperationMatrixLTwoDotExplicitModLinear() {
@@ -48,6 +58,11 @@ OperationMatrixLTwoDotExplicitModLinear::~OperationMatrixLTwoDotExplicitModLinea
 
 void OperationMatrixLTwoDotExplicitModLinear::mult(sgpp::base::DataVector& alpha,
                                                    sgpp::base::DataVector& result) {
+  if (sparseMatrix_) {
+    sparseMatrix_->mult(alpha, result);
+    return;
+  }
+
   size_t nrows = m_->getNrows();
   size_t ncols = m_->getNcols();
 
@@ -55,19 +70,19 @@ void OperationMatrixLTwoDotExplicitModLinear::mult(sgpp::base::DataVector& alpha
     throw sgpp::base::data_exception("Dimensions do not match!");
   }
 
-  double* data = m_->getPointer();
+  const double* data = m_->getPointer();
 
   // Standard matrix multiplication:
-  double temp = 0.;
-  size_t acc = 0;
-
+#pragma omp parallel for schedule(static)
   for (size_t i = 0; i < nrows; i++) {
+    const double* row = data + i * ncols;
+    double temp = 0.;
+
     for (size_t j = 0; j < ncols; j++) {
-      temp += data[j + acc] * alpha[j];
+      temp += row[j] * alpha[j];
     }
+
     result[i] = temp;
-    temp = 0.;
-    acc += ncols;
   }
 }
 }  // namespace pde
@@ -8,11 +8,14 @@
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/pde/operation/hash/SparseSymmetricMatrix.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearModifiedBasis.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
+
 namespace sgpp {
 namespace pde {
 
@@ -37,7 +40,9 @@ class OperationMatrixLTwoDotExplicitModLinear : public sgpp::base::OperationMatr
   OperationMatrixLTwoDotExplicitModLinear(sgpp::base::DataMatrix* m, sgpp::base::Grid* grid);
   /**
    * Constructor that creates an own matrix
-   * i.e. matrix is destroyed by the destructor of OperationMatrixLTwoDotExplicitModLinearFullGrid
+   * i.e. matrix is destroyed by the destructor of OperationMatrixLTwoDotExplicitModLinear.
+   * The matrix is assembled in parallel into a sparse symmetric matrix, as only the entries
+   * of overlapping basis functions are non-zero.
    *
    * @param grid the sparse grid
    */
@@ -56,6 +61,106 @@ class OperationMatrixLTwoDotExplicitModLinear : public sgpp::base::OperationMatr
    */
   virtual void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
+  /**
+   * Computes an entry of the L2-dot-product matrix.
+   *
+   * @param storage storage of the sparse grid
+   * @param basis modified linear basis
+   * @param i first grid point
+   * @param j second grid point
+   * @return L2 product of the basis functions of the grid points
+   */
+  static inline double computeEntry(base::GridStorage& storage,
+                                    base::SLinearModifiedBase& basis, size_t i, size_t j) {
+    double res = 1;
+
+    for (size_t k = 0; k < storage.getDimension(); k++) {
+      const base::level_t lik = storage[i].getLevel(k);
+      const base::level_t ljk = storage[j].getLevel(k);
+      const base::index_t iik = storage[i].getIndex(k);
+      const base::index_t ijk = storage[j].getIndex(k);
+      base::index_t hInvi = (1 << lik);
+      base::index_t hInvj = (1 << ljk);
+      double hInviDbl = static_cast<double>(hInvi);
+      double hInvjDbl = static_cast<double>(hInvj);
+      double temp_res;
+
+      if (lik == ljk) {
+        if (lik == 1) {
+          continue;
+        } else if (iik == ijk) {
+          if (iik == 1 || iik == hInvi - 1) {
+            // Use formula for identical modified ansatz functions:
+            temp_res = 8 / (hInviDbl * 3);
+          } else {
+            // Use formula for identical ansatz functions:
+            temp_res = 2 / (hInviDbl * 3);
+          }
+        } else {
+          // Different index, but same level => ansatz functions do not overlap:
+          res = 0.;
+          break;
+        }
+      } else {
+        // if one of the basis functions is from level 1 it's easy
+        if (lik == 1) {
+          temp_res = basis.getIntegral(ljk, ijk);
+        } else if (ljk == 1) {
+          temp_res = basis.getIntegral(lik, iik);
+        } else if ((iik - 1) / hInviDbl >= (ijk + 1) / hInvjDbl ||
+                   (iik + 1) / hInviDbl <= (ijk - 1) / hInvjDbl) {
+          // Ansatz functions do not not overlap:
+          res = 0.;
+          break;
+        } else {
+          // use formula for different overlapping ansatz functions:
+          if (lik > ljk) {  // Phi_i_k is the "smaller" ansatz function
+            if ((iik == 1 && ijk == 1) || (iik == hInvi - 1 && ijk == hInvj - 1)) {
+              // integrate modified basis prdouct from 0 to 2^(-lik + 1)
+              temp_res = 4 * ((1 / hInviDbl) - (hInvjDbl / 3 / (hInviDbl * hInviDbl)));
+            } else if (ijk == 1) {
+              // integrate product of modified Phi_i_k with
+              // regular Phi_j_k from (ijk-1)/2^(ljk) to  (ijk+1)/2^(ljk)
+              temp_res = (1 / hInviDbl) * (1 / hInviDbl) * (2 * hInviDbl - iik * hInvjDbl);
+            } else if (ijk == hInvj - 1) {
+              // symmetric to ijk == 1
+              temp_res =
+                  (1 / hInviDbl) * (1 / hInviDbl) * (2 * hInviDbl - (hInvi - iik) * hInvjDbl);
+            } else {
+              double diff = (iik / hInviDbl) - (ijk / hInvjDbl);  // x_i_k - x_j_k
+              temp_res = fabs(diff - (1 / hInviDbl)) + fabs(diff + (1 / hInviDbl)) - fabs(diff);
+              temp_res *= hInvjDbl;
+              temp_res = (1 - temp_res) / hInviDbl;
+            }
+          } else {  // Phi_j_k is the "smaller" ansatz function
+            // symmetric to case above
+            if ((iik == 1 && ijk == 1) || (iik == hInvi - 1 && ijk == hInvj - 1)) {
+              // both basis functions are modified
+              // integrate modified basis prdouct from 0 to 2^(-ljk + 1)
+              temp_res = 4 * ((1 / hInvjDbl) - (hInviDbl / (3 * hInvjDbl * hInvjDbl)));
+            } else if (iik == 1) {
+              // integrate product of modified Phi_i_k with
+              // regular Phi_j_k from (ijk-1)/2^(ljk) to  (ijk+1)/2^(ljk)
+              temp_res = (1 / hInvjDbl) * (1 / hInvjDbl) * (2 * hInvjDbl - ijk * hInviDbl);
+            } else if (iik == hInvi - 1) {
+              // symmetric to iik == 1
+              temp_res =
+                  (1 / hInvjDbl) * (1 / hInvjDbl) * (2 * hInvjDbl - (hInvj - ijk) * hInviDbl);
+            } else {
+              double diff = (ijk / hInvjDbl) - (iik / hInviDbl);  // x_j_k - x_i_k
+              temp_res = fabs(diff - (1 / hInvjDbl)) + fabs(diff + (1 / hInvjDbl)) - fabs(diff);
+              temp_res *= hInviDbl;
+              temp_res = (1 - temp_res) / hInvjDbl;
+            }
+          }
+        }
+      }
+      res *= temp_res;
+    }
+
+    return res;
+  }
+
   /**
    * generalization of "buildMatrix" function, creates L2-dot-product matrix for specified bounds
    * @param mat matrix for storage of L2 producs
@@ -69,7 +174,6 @@ class OperationMatrixLTwoDotExplicitModLinear : public sgpp::base::OperationMatr
                                     size_t i_start = 0, size_t i_end = 0, size_t j_start = 0,
                                     size_t j_end = 0) {
     size_t gridSize = grid->getSize();
-    size_t gridDim = grid->getDimension();
     base::GridStorage& storage = grid->getStorage();
     base::SLinearModifiedBase& basis = const_cast<base::SLinearModifiedBase&>(
         dynamic_cast<const base::SLinearModifiedBase&>(grid->getBasis()));
@@ -85,91 +189,8 @@ class OperationMatrixLTwoDotExplicitModLinear : public sgpp::base::OperationMatr
       j_end = j_end == 0 ? gridSize : j_end;
 
       for (size_t j = j_start; j < j_end; j++) {
-        double res = 1;
-
-        for (size_t k = 0; k < gridDim; k++) {
-          const base::level_t lik = storage[i].getLevel(k);
-          const base::level_t ljk = storage[j].getLevel(k);
-          const base::index_t iik = storage[i].getIndex(k);
-          const base::index_t ijk = storage[j].getIndex(k);
-          base::index_t hInvi = (1 << lik);
-          base::index_t hInvj = (1 << ljk);
-          double hInviDbl = static_cast<double>(hInvi);
-          double hInvjDbl = static_cast<double>(hInvj);
-          double temp_res;
-
-          if (lik == ljk) {
-            if (lik == 1) {
-              continue;
-            } else if (iik == ijk) {
-              if (iik == 1 || iik == hInvi - 1) {
-                // Use formula for identical modified ansatz functions:
-                temp_res = 8 / (hInviDbl * 3);
-              } else {
-                // Use formula for identical ansatz functions:
-                temp_res = 2 / (hInviDbl * 3);
-              }
-            } else {
-              // Different index, but same level => ansatz functions do not overlap:
-              res = 0.;
-              break;
-            }
-          } else {
-            // if one of the basis functions is from level 1 it's easy
-            if (lik == 1) {
-              temp_res = basis.getIntegral(ljk, ijk);
-            } else if (ljk == 1) {
-              temp_res = basis.getIntegral(lik, iik);
-            } else if ((iik - 1) / hInviDbl >= (ijk + 1) / hInvjDbl ||
-                       (iik + 1) / hInviDbl <= (ijk - 1) / hInvjDbl) {
-              // Ansatz functions do not not overlap:
-              res = 0.;
-              break;
-            } else {
-              // use formula for different overlapping ansatz functions:
-              if (lik > ljk) {  // Phi_i_k is the "smaller" ansatz function
-                if ((iik == 1 && ijk == 1) || (iik == hInvi - 1 && ijk == hInvj - 1)) {
-                  // integrate modified basis prdouct from 0 to 2^(-lik + 1)
-                  temp_res = 4 * ((1 / hInviDbl) - (hInvjDbl / 3 / (hInviDbl * hInviDbl)));
-                } else if (ijk == 1) {
-                  // integrate product of modified Phi_i_k with
-                  // regular Phi_j_k from (ijk-1)/2^(ljk) to  (ijk+1)/2^(ljk)
-                  temp_res = (1 / hInviDbl) * (1 / hInviDbl) * (2 * hInviDbl - iik * hInvjDbl);
-                } else if (ijk == hInvj - 1) {
-                  // symmetric to ijk == 1
-                  temp_res =
-                      (1 / hInviDbl) * (1 / hInviDbl) * (2 * hInviDbl - (hInvi - iik) * hInvjDbl);
-                } else {
-                  double diff = (iik / hInviDbl) - (ijk / hInvjDbl);  // x_i_k - x_j_k
-                  temp_res = fabs(diff - (1 / hInviDbl)) + fabs(diff + (1 / hInviDbl)) - fabs(diff);
-                  temp_res *= hInvjDbl;
-                  temp_res = (1 - temp_res) / hInviDbl;
-                }
-              } else {  // Phi_j_k is the "smaller" ansatz function
-                // symmetric to case above
-                if ((iik == 1 && ijk == 1) || (iik == hInvi - 1 && ijk == hInvj - 1)) {
-                  // both basis functions are modified
-                  // integrate modified basis prdouct from 0 to 2^(-ljk + 1)
-                  temp_res = 4 * ((1 / hInvjDbl) - (hInviDbl / (3 * hInvjDbl * hInvjDbl)));
-                } else if (iik == 1) {
-                  // integrate product of modified Phi_i_k with
-                  // regular Phi_j_k from (ijk-1)/2^(ljk) to  (ijk+1)/2^(ljk)
-                  temp_res = (1 / hInvjDbl) * (1 / hInvjDbl) * (2 * hInvjDbl - ijk * hInviDbl);
-                } else if (iik == hInvi - 1) {
-                  // symmetric to iik == 1
-                  temp_res =
-                      (1 / hInvjDbl) * (1 / hInvjDbl) * (2 * hInvjDbl - (hInvj - ijk) * hInviDbl);
-                } else {
-                  double diff = (ijk / hInvjDbl) - (iik / hInviDbl);  // x_j_k - x_i_k
-                  temp_res = fabs(diff - (1 / hInvjDbl)) + fabs(diff + (1 / hInvjDbl)) - fabs(diff);
-                  temp_res *= hInviDbl;
-                  temp_res = (1 - temp_res) / hInvjDbl;
-                }
-              }
-            }
-          }
-          res *= temp_res;
-        }
+        double res = computeEntry(storage, basis, i, j);
+
         if (mat_quadratic) {
           mat->set(i, j, res);
           mat->set(j, i, res);
@@ -188,6 +209,7 @@ class OperationMatrixLTwoDotExplicitModLinear : public sgpp::base::OperationMatr
 
   sgpp::base::DataMatrix* m_;
   bool ownsMatrix_;
+  std::unique_ptr<SparseSymmetricMatrix> sparseMatrix_;
 };
 
 }  // namespace pde
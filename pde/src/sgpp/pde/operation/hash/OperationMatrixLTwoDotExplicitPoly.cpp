@@ -19,6 +19,55 @@
 namespace sgpp {
 namespace pde {
 
+namespace {
+
+/**
+ * Computes an entry of the L2-dot-product matrix with Gauss-Legendre quadrature.
+ *
+ * @param storage storage of the sparse grid
+ * @param basis basis of the sparse grid
+ * @param coordinates normalized Gauss-Legendre points
+ * @param weights normalized Gauss-Legendre weights
+ * @param i first grid point
+ * @param j second grid point
+ * @return L2 product of the basis functions of the grid points
+ */
+double computeEntry(base::GridStorage& storage, base::SBasis& basis,
+                    const base::DataVector& coordinates, const base::DataVector& weights, size_t i,
+                    size_t j) {
+  double res = 1.0;
+  for (size_t k = 0; k < storage.getDimension(); k++) {
+    const base::level_t lik = storage[i].getLevel(k);
+    const base::level_t ljk = storage[j].getLevel(k);
+    const base::index_t iik = storage[i].getIndex(k);
+    const base::index_t ijk = storage[j].getIndex(k);
+    const double left_i = 1.0/(1 << lik) * (iik - 1);
+    const double left_j = 1.0/(1 << ljk) * (ijk - 1);
+    const double right_i = 1.0/(1 << lik) * (iik + 1);
+    const double right_j = 1.0/(1 << ljk) * (ijk + 1);
+
+    if (left_j >= right_i || left_i >= right_j) {
+      // Ansatz functions do not not overlap:
+      res = 0.0;
+      break;
+    } else {
+      const double left = std::max(left_i, left_j);
+      const double right = std::min(right_i, right_j);
+      const double scaling = right - left;
+      double temp_res = 0.0;
+      for (size_t c = 0; c < coordinates.getSize(); c++) {
+        const double x = left + scaling * coordinates[c];
+        temp_res += weights[c] * basis.eval(lik, iik, x) * basis.eval(ljk, ijk, x);
+      }
+      res *= scaling*temp_res;
+    }
+  }
+
+  return res;
+}
+
+}  // namespace
+
 OperationMatrixLTwoDotExplicitPoly::OperationMatrixLTwoDotExplicitPoly(
     sgpp::base::DataMatrix* m, sgpp::base::Grid* grid)
     : ownsMatrix_(false) {
@@ -28,13 +77,12 @@ OperationMatrixLTwoDotExplicitPoly::OperationMatrixLTwoDotExplicitPoly(
 
 OperationMatrixLTwoDotExplicitPoly::OperationMatrixLTwoDotExplicitPoly(sgpp::base::Grid* grid)
     : ownsMatrix_(true) {
-  m_ = new sgpp::base::DataMatrix(grid->getSize(), grid->getSize());
+  m_ = nullptr;
   buildMatrix(grid);
 }
 
 void OperationMatrixLTwoDotExplicitPoly::buildMatrix(sgpp::base::Grid* grid) {
   size_t gridSize = grid->getSize();
-  size_t gridDim = grid->getDimension();
   const size_t p = dynamic_cast<sgpp::base::PolyGrid*>(grid)->getDegree();
   // const double pp1hDbl = static_cast<double>(pp1h);
   const size_t quadOrder = p + 1;
@@ -45,35 +93,18 @@ void OperationMatrixLTwoDotExplicitPoly::buildMatrix(sgpp::base::Grid* grid) {
   base::DataVector weights;
   base::GaussLegendreQuadRule1D gauss;
   gauss.getLevelPointsAndWeightsNormalized(quadOrder, coordinates, weights);
+
+  if (m_ == nullptr) {
+    sparseMatrix_.reset(new SparseSymmetricMatrix(
+        storage, [&storage, &basis, &coordinates, &weights](size_t i, size_t j) {
+          return computeEntry(storage, basis, coordinates, weights, i, j);
+        }));
+    return;
+  }
+
   for (size_t i = 0; i < gridSize; i++) {
     for (size_t j = i; j < gridSize; j++) {
-      double res = 1.0;
-      for (size_t k = 0; k < gridDim; k++) {
-        const base::level_t lik = storage[i].getLevel(k);
-        const base::level_t ljk = storage[j].getLevel(k);
-        const base::index_t iik = storage[i].getIndex(k);
-        const base::index_t ijk = storage[j].getIndex(k);
-        const double left_i = 1.0/(1 << lik) * (iik - 1);
-        const double left_j = 1.0/(1 << ljk) * (ijk - 1);
-        const double right_i = 1.0/(1 << lik) * (iik + 1);
-        const double right_j = 1.0/(1 << ljk) * (ijk + 1);
-
-        if (left_j >= right_i || left_i >= right_j) {
-          // Ansatz functions do not not overlap:
-          res = 0.0;
-          break;
-        } else {
-          const double left = std::max(left_i, left_j);
-          const double right = std::min(right_i, right_j);
-          const double scaling = right - left;
-          double temp_res = 0.0;
-          for (size_t c = 0; c < quadOrder; c++) {
-            const double x = left + scaling * coordinates[c];
-            temp_res += weights[c] * basis.eval(lik, iik, x) * basis.eval(ljk, ijk, x);
-          }
-          res *= scaling*temp_res;
-        }
-      }
+      const double res = computeEntry(storage, basis, coordinates, weights, i, j);
       m_->set(i, j, res);
       m_->set(j, i, res);
     }
@@ -85,7 +116,12 @@ OperationMatrixLTwoDotExplicitPoly::~OperationMatrixLTwoDotExplicitPoly() {
 }
 
 void OperationMatrixLTwoDotExplicitPoly::mult(sgpp::base::DataVector& alpha,
-                                                 sgpp::base::DataVector& result) {
+                                              sgpp::base::DataVector& result) {
+  if (sparseMatrix_) {
+    sparseMatrix_->mult(alpha, result);
+    return;
+  }
+
   size_t nrows = m_->getNrows();
   size_t ncols = m_->getNcols();
 
@@ -93,20 +129,19 @@ void OperationMatrixLTwoDotExplicitPoly::mult(sgpp::base::DataVector& alpha,
     throw sgpp::base::data_exception("Dimensions do not match!");
   }
 
-  double* data = m_->getPointer();
+  const double* data = m_->getPointer();
 
   // Standard matrix multiplication:
-  double temp = 0.;
-  size_t acc = 0;
-
+#pragma omp parallel for schedule(static)
   for (size_t i = 0; i < nrows; i++) {
+    const double* row = data + i * ncols;
+    double temp = 0.;
+
     for (size_t j = 0; j < ncols; j++) {
-      temp += data[j + acc] * alpha[j];
+      temp += row[j] * alpha[j];
     }
 
     result[i] = temp;
-    temp = 0.;
-    acc += ncols;
   }
 }
 
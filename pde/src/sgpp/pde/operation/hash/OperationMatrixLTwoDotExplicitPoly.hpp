@@ -8,9 +8,12 @@
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/pde/operation/hash/SparseSymmetricMatrix.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
+
 namespace sgpp {
 namespace pde {
 
@@ -29,7 +32,9 @@ class OperationMatrixLTwoDotExplicitPoly : public sgpp::base::OperationMatrix {
   OperationMatrixLTwoDotExplicitPoly(sgpp::base::DataMatrix* m, sgpp::base::Grid* grid);
   /**
    * Constructor that creates an own matrix
-   * i.e. matrix is destroyed by the destructor of OperationMatrixLTwoDotExplicitPolyFullGrid
+   * i.e. matrix is destroyed by the destructor of OperationMatrixLTwoDotExplicitPoly.
+   * The matrix is assembled in parallel into a sparse symmetric matrix, as only the entries
+   * of overlapping basis functions are non-zero.
    *
    * @param grid the sparse grid
    */
@@ -56,6 +61,7 @@ class OperationMatrixLTwoDotExplicitPoly : public sgpp::base::OperationMatrix {
 
   sgpp::base::DataMatrix* m_;
   bool ownsMatrix_;
+  std::unique_ptr<SparseSymmetricMatrix> sparseMatrix_;
 };
 
 }  // namespace pde
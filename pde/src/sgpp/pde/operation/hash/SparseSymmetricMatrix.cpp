@@ -0,0 +1,336 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/operation/hash/SparseSymmetricMatrix.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+namespace {
+
+/// number of rows per chunk when reducing the contributions of the lower triangle
+const size_t REDUCTION_CHUNK_SIZE = 4096;
+
+/**
+ * @param levelA  level of the grid point A in one dimension
+ * @param indexA  index of the grid point A in one dimension
+ * @param levelB  level of the grid point B in one dimension (levelB <= levelA)
+ * @return        index of the ancestor of A on level levelB
+ */
+inline base::index_t getAncestorIndex(base::level_t levelA, base::index_t indexA,
+                                      base::level_t levelB) {
+  return 2 * (indexA >> (levelA - levelB + 1)) + 1;
+}
+
+/**
+ * @return whether the hierarchical cells of the grid points are nested in every dimension
+ */
+bool haveNestedCells(const base::GridPoint& pointA, const base::GridPoint& pointB,
+                     size_t dim) {
+  for (size_t d = 0; d < dim; d++) {
+    const base::level_t levelA = pointA.getLevel(d);
+    const base::level_t levelB = pointB.getLevel(d);
+
+    if (levelA >= levelB) {
+      if (getAncestorIndex(levelA, pointA.getIndex(d), levelB) != pointB.getIndex(d)) {
+        return false;
+      }
+    } else if (getAncestorIndex(levelB, pointB.getIndex(d), levelA) != pointA.getIndex(d)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Computes the ancestors of grid points on given levels.
+ *
+ * @param      storage  storage of the sparse grid
+ * @param      points   sequence numbers of the grid points (of the same subspace)
+ * @param      levels   levels of the ancestors (at most the levels of the grid points,
+ *                      sum of the levels minus one less than 64)
+ * @param[out] keys     pairs of the packed indices of the ancestors and the sequence numbers,
+ *                      sorted
+ */
+void getAncestorKeys(base::GridStorage& storage, const std::vector<size_t>& points,
+                     const std::vector<base::level_t>& levels,
+                     std::vector<std::pair<uint64_t, size_t>>& keys) {
+  keys.clear();
+
+  for (size_t i : points) {
+    const base::GridPoint& point = storage[i];
+    uint64_t key = 0;
+    size_t shift = 0;
+
+    for (size_t d = 0; d < levels.size(); d++) {
+      const uint64_t ancestorIndex =
+          getAncestorIndex(point.getLevel(d), point.getIndex(d), levels[d]);
+      key |= (ancestorIndex >> 1) << shift;
+      shift += levels[d] - 1;
+    }
+
+    keys.emplace_back(key, i);
+  }
+
+  std::sort(keys.begin(), keys.end());
+}
+
+}  // namespace
+
+SparseSymmetricMatrix::SparseSymmetricMatrix(base::GridStorage& storage,
+                                             const EntryFunction& entry)
+    : size(storage.getSize()) {
+  const size_t dim = storage.getDimension();
+
+  // group the grid points by subspace
+  std::map<std::vector<base::level_t>, std::vector<size_t>> subspaceMap;
+  std::vector<base::level_t> levels(dim);
+
+  for (size_t i = 0; i < size; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      levels[d] = storage[i].getLevel(d);
+
+      if (levels[d] == 0) {
+        throw base::operation_exception(
+            "SparseSymmetricMatrix: grids with boundary points are not supported");
+      }
+    }
+
+    subspaceMap[levels].push_back(i);
+  }
+
+  std::vector<std::pair<std::vector<base::level_t>, std::vector<size_t>>> subspaces(
+      subspaceMap.begin(), subspaceMap.end());
+  subspaceMap.clear();
+
+  std::vector<std::vector<std::pair<size_t, double>>> rows(size);
+
+  // the rows of the grid points of a subspace are computed by the same thread
+#pragma omp parallel
+  {
+    std::vector<base::level_t> meetLevels(dim);
+    std::vector<std::pair<uint64_t, size_t>> keys;
+    std::vector<std::pair<uint64_t, size_t>> otherKeys;
+
+#pragma omp for schedule(dynamic)
+    for (size_t s = 0; s < subspaces.size(); s++) {
+      const std::vector<base::level_t>& subspaceLevels = subspaces[s].first;
+      const std::vector<size_t>& points = subspaces[s].second;
+
+      for (const auto& otherSubspace : subspaces) {
+        const std::vector<base::level_t>& otherLevels = otherSubspace.first;
+        const std::vector<size_t>& otherPoints = otherSubspace.second;
+        size_t numberOfBits = 0;
+
+        for (size_t d = 0; d < dim; d++) {
+          meetLevels[d] = std::min(subspaceLevels[d], otherLevels[d]);
+          numberOfBits += meetLevels[d] - 1;
+        }
+
+        if (numberOfBits >= 64) {
+          // test all pairs
+          for (size_t i : points) {
+            for (size_t j : otherPoints) {
+              if ((j >= i) && haveNestedCells(storage[i], storage[j], dim)) {
+                const double value = entry(i, j);
+
+                if (value != 0.0) {
+                  rows[i].emplace_back(j, value);
+                }
+              }
+            }
+          }
+
+          continue;
+        }
+
+        // two grid points overlap if and only if their ancestors on the smaller of both levels
+        // coincide in every dimension, hence join both subspaces on these ancestors
+        getAncestorKeys(storage, points, meetLevels, keys);
+        getAncestorKeys(storage, otherPoints, meetLevels, otherKeys);
+        auto other = otherKeys.begin();
+
+        for (auto first = keys.begin(); first != keys.end();) {
+          auto last = first;
+
+          while ((last != keys.end()) && (last->first == first->first)) {
+            ++last;
+          }
+
+          while ((other != otherKeys.end()) && (other->first < first->first)) {
+            ++other;
+          }
+
+          for (auto otherLast = other;
+               (otherLast != otherKeys.end()) && (otherLast->first == first->first);
+               ++otherLast) {
+            const size_t j = otherLast->second;
+
+            for (auto point = first; point != last; ++point) {
+              const size_t i = point->second;
+
+              if (j >= i) {
+                const double value = entry(i, j);
+
+                if (value != 0.0) {
+                  rows[i].emplace_back(j, value);
+                }
+              }
+            }
+          }
+
+          first = last;
+        }
+      }
+
+      for (size_t i : points) {
+        std::sort(rows[i].begin(), rows[i].end());
+      }
+    }
+  }
+
+  // compress the rows
+  rowStart.resize(size + 1);
+  rowStart[0] = 0;
+
+  for (size_t i = 0; i < size; i++) {
+    rowStart[i + 1] = rowStart[i] + rows[i].size();
+  }
+
+  columns.resize(rowStart[size]);
+  values.resize(rowStart[size]);
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < size; i++) {
+    size_t k = rowStart[i];
+
+    for (const std::pair<size_t, double>& entryPair : rows[i]) {
+      columns[k] = entryPair.first;
+      values[k] = entryPair.second;
+      k++;
+    }
+
+    std::vector<std::pair<size_t, double>>().swap(rows[i]);
+  }
+}
+
+void SparseSymmetricMatrix::mult(const base::DataVector& alpha, base::DataVector& result) {
+  if ((alpha.getSize() != size) || (result.getSize() != size)) {
+    throw base::data_exception("Dimensions do not match!");
+  }
+
+  // number of threads of the team (not known before entering the parallel region)
+  size_t numberOfThreads = 1;
+  // first row of each thread (numberOfThreads + 1 entries)
+  std::vector<size_t> threadRowStart;
+
+#pragma omp parallel
+  {
+#ifdef _OPENMP
+    const size_t threadNum = static_cast<size_t>(omp_get_thread_num());
+#else
+    const size_t threadNum = 0;
+#endif
+
+#pragma omp single
+    {
+#ifdef _OPENMP
+      numberOfThreads = static_cast<size_t>(omp_get_num_threads());
+#endif
+      // contiguous blocks of rows with approximately the same number of entries
+      const size_t numberOfNonZeros = rowStart[size];
+      threadRowStart.resize(numberOfThreads + 1);
+      threadRowStart[0] = 0;
+      threadRowStart[numberOfThreads] = size;
+
+      for (size_t t = 1; t < numberOfThreads; t++) {
+        threadRowStart[t] = std::lower_bound(rowStart.begin(), rowStart.begin() + size,
+                                             t * numberOfNonZeros / numberOfThreads) -
+                            rowStart.begin();
+      }
+
+      if (threadBuffers.size() != numberOfThreads) {
+        threadBuffers.resize(numberOfThreads);
+      }
+    }
+
+    // implicit barrier, the rows of the thread contribute only to the entries
+    // rowBegin, ..., size - 1 of the lower triangle
+    const size_t rowBegin = threadRowStart[threadNum];
+    const size_t rowEnd = threadRowStart[threadNum + 1];
+    std::vector<double>& lower = threadBuffers[threadNum];
+    lower.assign(size - rowBegin, 0.0);
+
+    for (size_t i = rowBegin; i < rowEnd; i++) {
+      const double alphaI = alpha[i];
+      double sum = 0.0;
+
+      for (size_t k = rowStart[i]; k < rowStart[i + 1]; k++) {
+        const size_t j = columns[k];
+        sum += values[k] * alpha[j];
+
+        if (j != i) {
+          lower[j - rowBegin] += values[k] * alphaI;
+        }
+      }
+
+      result[i] = sum;
+    }
+
+#pragma omp barrier
+
+    // add the contributions of the lower triangle chunk by chunk
+    const size_t numberOfChunks = (size + REDUCTION_CHUNK_SIZE - 1) / REDUCTION_CHUNK_SIZE;
+
+#pragma omp for schedule(static)
+    for (size_t c = 0; c < numberOfChunks; c++) {
+      const size_t chunkBegin = c * REDUCTION_CHUNK_SIZE;
+      const size_t chunkEnd = std::min(chunkBegin + REDUCTION_CHUNK_SIZE, size);
+
+      for (size_t t = 0; (t < numberOfThreads) && (threadRowStart[t] < chunkEnd); t++) {
+        const std::vector<double>& buffer = threadBuffers[t];
+        const size_t offset = threadRowStart[t];
+
+        for (size_t i = std::max(chunkBegin, offset); i < chunkEnd; i++) {
+          result[i] += buffer[i - offset];
+        }
+      }
+    }
+  }
+}
+
+size_t SparseSymmetricMatrix::getSize() const { return size; }
+
+size_t SparseSymmetricMatrix::getNumberOfNonZeros() const { return values.size(); }
+
+void SparseSymmetricMatrix::toDense(base::DataMatrix& matrix) const {
+  matrix.resizeRowsCols(size, size);
+  matrix.setAll(0.0);
+
+  for (size_t i = 0; i < size; i++) {
+    for (size_t k = rowStart[i]; k < rowStart[i + 1]; k++) {
+      matrix.set(i, columns[k], values[k]);
+      matrix.set(columns[k], i, values[k]);
+    }
+  }
+}
+
+}  // namespace pde
+}  // namespace sgpp
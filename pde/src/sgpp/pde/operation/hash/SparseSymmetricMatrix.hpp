@@ -0,0 +1,95 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SPARSESYMMETRICMATRIX_HPP
+#define SPARSESYMMETRICMATRIX_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <functional>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Symmetric sparse matrix of the form \f$(a(\Phi_i,\Phi_j))_{i,j}\f$ for a sparse grid whose
+ * basis functions are supported on the hierarchical cells of their grid points
+ * (e.g., linear, modified linear, polynomial, and modified polynomial basis functions without
+ * boundary points).
+ *
+ * Two such basis functions overlap only if their cells are nested in every dimension, i.e.,
+ * if their ancestors on the smaller of both levels coincide. The assembly finds these pairs
+ * for each pair of subspaces by sorting the grid points of both subspaces by these ancestors
+ * and merging both lists. Hence, only the entries of overlapping pairs are computed,
+ * and the assembly is parallelized over the subspaces with OpenMP.
+ *
+ * The upper triangle (including the diagonal) is stored in compressed sparse row (CSR)
+ * format. The matrix-vector product is parallelized over contiguous blocks of rows with
+ * OpenMP; the contributions of the lower triangle are accumulated in buffers of the threads
+ * (which only cover the rows starting at the block of the thread) and reduced chunk by chunk.
+ */
+class SparseSymmetricMatrix {
+ public:
+  /**
+   * Function that computes the entry (i, j) of the matrix (i <= j) for overlapping
+   * basis functions. It is called concurrently by several threads.
+   */
+  typedef std::function<double(size_t, size_t)> EntryFunction;
+
+  /**
+   * Constructor. Assembles the matrix.
+   *
+   * @param storage   storage of the sparse grid (without boundary points)
+   * @param entry     function that computes the entries
+   */
+  SparseSymmetricMatrix(base::GridStorage& storage, const EntryFunction& entry);
+
+  /**
+   * Matrix-vector product.
+   *
+   * @param      alpha  vector that is multiplied to the matrix
+   * @param[out] result result of the multiplication
+   */
+  void mult(const base::DataVector& alpha, base::DataVector& result);
+
+  /**
+   * @return number of rows/columns
+   */
+  size_t getSize() const;
+
+  /**
+   * @return number of stored entries (upper triangle including the diagonal)
+   */
+  size_t getNumberOfNonZeros() const;
+
+  /**
+   * Writes the matrix into a dense matrix (e.g., for testing).
+   *
+   * @param[out] matrix dense matrix (resized to getSize() x getSize())
+   */
+  void toDense(base::DataMatrix& matrix) const;
+
+ private:
+  /// number of rows/columns
+  size_t size;
+  /// index of the first entry of each row (size + 1 entries)
+  std::vector<size_t> rowStart;
+  /// column of each entry
+  std::vector<size_t> columns;
+  /// value of each entry
+  std::vector<double> values;
+  /// buffers for the contributions of the lower triangle, one per thread of the team
+  std::vector<std::vector<double>> threadBuffers;
+};
+
+}  // namespace pde
+}  // namespace sgpp
+
+#endif /* SPARSESYMMETRICMATRIX_HPP */
@@ -0,0 +1,155 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp_base.hpp>
+#include <sgpp_pde.hpp>
+#include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/pde/operation/hash/SparseSymmetricMatrix.hpp>
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+namespace {
+
+void refineRandomly(sgpp::base::Grid& grid, std::mt19937& generator) {
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  for (size_t step = 0; step < 2; step++) {
+    sgpp::base::DataVector alpha(grid.getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = distribution(generator);
+    }
+
+    sgpp::base::SurplusRefinementFunctor functor(alpha, 10);
+    grid.getGenerator().refine(functor);
+  }
+}
+
+void checkSparseEqualsDense(sgpp::base::OperationMatrix& opSparse,
+                            sgpp::base::DataMatrix& dense, std::mt19937& generator) {
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  const size_t size = dense.getNrows();
+  sgpp::base::DataVector alpha(size);
+
+  for (size_t i = 0; i < size; i++) {
+    alpha[i] = distribution(generator);
+  }
+
+  sgpp::base::DataVector resultSparse(size);
+  sgpp::base::DataVector resultDense(size);
+  opSparse.mult(alpha, resultSparse);
+  dense.mult(alpha, resultDense);
+
+  for (size_t i = 0; i < size; i++) {
+    BOOST_CHECK_SMALL(resultSparse[i] - resultDense[i], 1e-12);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(testSparseSymmetricMatrix)
+
+BOOST_AUTO_TEST_CASE(testLTwoDotExplicitSparse) {
+  const size_t d = 3;
+  std::mt19937 generator(42);
+
+#ifdef _OPENMP
+  const int oldNumThreads = omp_get_max_threads();
+  omp_set_num_threads(4);
+#endif
+
+  std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+  grids.emplace_back(sgpp::base::Grid::createLinearGrid(d));
+  grids.emplace_back(sgpp::base::Grid::createModLinearGrid(d));
+  grids.emplace_back(sgpp::base::Grid::createPolyGrid(d, 3));
+  grids.emplace_back(sgpp::base::Grid::createModPolyGrid(d, 3));
+
+  for (std::unique_ptr<sgpp::base::Grid>& grid : grids) {
+    grid->getGenerator().regular(3);
+    refineRandomly(*grid, generator);
+    const size_t size = grid->getSize();
+
+    sgpp::base::DataMatrix dense(size, size);
+    std::unique_ptr<sgpp::base::OperationMatrix> opDense(
+        sgpp::op_factory::createOperationLTwoDotExplicit(&dense, *grid));
+    std::unique_ptr<sgpp::base::OperationMatrix> opSparse(
+        sgpp::op_factory::createOperationLTwoDotExplicit(*grid));
+    checkSparseEqualsDense(*opSparse, dense, generator);
+
+    // all non-zero entries belong to pairs of overlapping basis functions
+    SparseSymmetricMatrix sparse(grid->getStorage(),
+                                 [&dense](size_t i, size_t j) { return dense.get(i, j); });
+    sgpp::base::DataMatrix sparseAsDense;
+    sparse.toDense(sparseAsDense);
+    BOOST_CHECK_LT(sparse.getNumberOfNonZeros(), size * (size + 1) / 2);
+
+    for (size_t i = 0; i < size; i++) {
+      for (size_t j = 0; j < size; j++) {
+        BOOST_CHECK_EQUAL(sparseAsDense.get(i, j), dense.get(i, j));
+      }
+    }
+
+    // the thread buffers are reused by teams of different sizes
+    sgpp::base::DataVector alpha(size);
+    sgpp::base::DataVector resultSparse(size);
+    sgpp::base::DataVector resultDense(size);
+
+    for (int numThreads : {4, 1, 3, 2}) {
+#ifdef _OPENMP
+      omp_set_num_threads(numThreads);
+#endif
+
+      for (size_t i = 0; i < size; i++) {
+        alpha[i] = static_cast<double>((i * 7 + numThreads) % 11) - 5.0;
+      }
+
+      sparse.mult(alpha, resultSparse);
+      dense.mult(alpha, resultDense);
+
+      for (size_t i = 0; i < size; i++) {
+        BOOST_CHECK_SMALL(resultSparse[i] - resultDense[i], 1e-12);
+      }
+    }
+  }
+
+#ifdef _OPENMP
+  omp_set_num_threads(oldNumThreads);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(testLaplaceExplicitSparse) {
+  const size_t d = 2;
+  std::mt19937 generator(17);
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(d));
+  grid->getStorage().getBoundingBox()->setBoundary(0, sgpp::base::BoundingBox1D(-1.0, 2.0));
+  grid->getGenerator().regular(4);
+  refineRandomly(*grid, generator);
+  const size_t size = grid->getSize();
+
+  sgpp::base::DataMatrix dense(size, size);
+  std::unique_ptr<sgpp::base::OperationMatrix> opDense(
+      sgpp::op_factory::createOperationLaplaceExplicit(&dense, *grid));
+  std::unique_ptr<sgpp::base::OperationMatrix> opSparse(
+      sgpp::op_factory::createOperationLaplaceExplicit(*grid));
+  checkSparseEqualsDense(*opSparse, dense, generator);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace pde
+}  // namespace sgpp
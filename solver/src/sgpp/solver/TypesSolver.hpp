@@ -14,7 +14,7 @@ namespace solver {
 /**
  * enum to address different SLE solvers in a standardized way
  */
-enum class SLESolverType { CG, BiCGSTAB, FISTA };
+enum class SLESolverType { CG, BiCGSTAB, FISTA, PipelinedCG };
 
 struct SLESolverConfiguration {
   sgpp::solver::SLESolverType type_;
@@ -76,19 +76,16 @@ void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::Data
 
     // std::cout << "v " << v.get(0) << " " << v.get(1)  << std::endl;
 
-    omega = (v.dotProduct(w)) / (v.dotProduct(v));
+    double vv = 0.0;
+    omega = v.dotProductWithNorm(w, vv) / vv;
 
     // x = x - a*p - omega*w
-    alpha.axpy((-1.0) * a, p);
-    alpha.axpy((-1.0) * omega, w);
+    alpha.axpy((-1.0) * a, p, (-1.0) * omega, w);
 
     // r = r - a*s - omega*v
-    r.axpy((-1.0) * a, s);
-    r.axpy((-1.0) * omega, v);
+    r.axpy((-1.0) * a, s, (-1.0) * omega, v);
 
-    rho_new = r.dotProduct(rZero);
-
-    delta = r.dotProduct(r);
+    rho_new = r.dotProductWithNorm(rZero, delta);
 
     if (verbose == true) {
       std::cout << "delta: " << delta << std::endl;
@@ -106,8 +103,7 @@ void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::Data
 
     // p = r + beta*(p - omega*s)
     p.axpy((-1.0) * omega, s);
-    p.mult(beta);
-    p.add(r);
+    p.xpay(beta, r);
 
     this->nIterations++;
   }
@@ -77,19 +77,16 @@ void BiCGStabSP::solve(sgpp::base::OperationMatrixSP& SystemMatrix, sgpp::base::
 
     // std::cout << "v " << v.get(0) << " " << v.get(1)  << std::endl;
 
-    omega = (v.dotProduct(w)) / (v.dotProduct(v));
+    float vv = 0.0f;
+    omega = v.dotProductWithNorm(w, vv) / vv;
 
     // x = x - a*p - omega*w
-    alpha.axpy((-1.0f) * a, p);
-    alpha.axpy((-1.0f) * omega, w);
+    alpha.axpy((-1.0f) * a, p, (-1.0f) * omega, w);
 
     // r = r - a*s - omega*v
-    r.axpy((-1.0f) * a, s);
-    r.axpy((-1.0f) * omega, v);
+    r.axpy((-1.0f) * a, s, (-1.0f) * omega, v);
 
-    rho_new = r.dotProduct(rZero);
-
-    delta = r.dotProduct(r);
+    rho_new = r.dotProductWithNorm(rZero, delta);
 
     if (verbose == true) {
       std::cout << "delta: " << delta << std::endl;
@@ -107,8 +104,7 @@ void BiCGStabSP::solve(sgpp::base::OperationMatrixSP& SystemMatrix, sgpp::base::
 
     // p = r + beta*(p - omega*s)
     p.axpy((-1.0f) * omega, s);
-    p.mult(beta);
-    p.add(r);
+    p.xpay(beta, r);
 
     this->nIterations++;
   }
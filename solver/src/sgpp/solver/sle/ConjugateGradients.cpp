@@ -102,7 +102,7 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
     }
 
     // a = d_new / d.q
-    a = delta_new / d.dotProduct(q);
+    a = delta_new / dq;
 
     // x = x + a*d
     alpha.axpy(a, d);
@@ -113,14 +113,15 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
       SystemMatrix.mult(alpha, temp);
       r.copyFrom(b);
       r.sub(temp);
+      delta_old = delta_new;
+      delta_new = r.dotProduct(r);
     } else {
-      // r = r - a*q
-      r.axpy(-a, q);
+      // r = r - a*q, fused with the calculation of the new delta
+      delta_old = delta_new;
+      delta_new = r.axpyDot(-a, q);
     }
 
-    // calculate new deltas and determine beta
-    delta_old = delta_new;
-    delta_new = r.dotProduct(r);
+    // determine beta
     beta = delta_new / delta_old;
 
 #ifdef X86_MIC_SYMMETRIC
@@ -134,8 +135,8 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
       std::cout << "delta: " << delta_new << std::endl;
     }
 
-    d.mult(beta);
-    d.add(r);
+    // d = r + beta*d
+    d.xpay(beta, r);
 
     this->nIterations++;
   }
@@ -91,14 +91,15 @@ void ConjugateGradientsSP::solve(sgpp::base::OperationMatrixSP& SystemMatrix,
       SystemMatrix.mult(alpha, temp);
       r.copyFrom(b);
       r.sub(temp);
+      delta_old = delta_new;
+      delta_new = r.dotProduct(r);
     } else {
-      // r = r - a*q
-      r.axpy(-a, q);
+      // r = r - a*q, fused with the calculation of the new delta
+      delta_old = delta_new;
+      delta_new = r.axpyDot(-a, q);
     }
 
-    // calculate new deltas and determine beta
-    delta_old = delta_new;
-    delta_new = r.dotProduct(r);
+    // determine beta
     beta = delta_new / delta_old;
 
 #ifdef X86_MIC_SYMMETRIC
@@ -111,8 +112,8 @@ void ConjugateGradientsSP::solve(sgpp::base::OperationMatrixSP& SystemMatrix,
       std::cout << "delta: " << delta_new << std::endl;
     }
 
-    d.mult(beta);
-    d.add(r);
+    // d = r + beta*d
+    d.xpay(beta, r);
 
     this->nIterations++;
   }
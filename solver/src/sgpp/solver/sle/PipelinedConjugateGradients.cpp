@@ -0,0 +1,184 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <iostream>
+
+namespace sgpp {
+namespace solver {
+
+namespace {
+
+/// minimal number of unknowns for which the vector updates are parallelized with OpenMP
+const size_t MIN_PARALLEL_SIZE = 16384;
+
+/// number of iterations after which the residual is recomputed
+const size_t RESIDUAL_REPLACEMENT_PERIOD = 50;
+
+/**
+ * Performs the vector updates of one iteration and computes the dot products of the next
+ * iteration in the same pass over the data.
+ *
+ * @param a           step size
+ * @param beta        update coefficient of the search directions
+ * @param n           A*w
+ * @param z           A*s (updated)
+ * @param s           A*p (updated)
+ * @param p           search direction (updated)
+ * @param x           iterate (updated)
+ * @param r           residual (updated)
+ * @param w           A*r (updated)
+ * @param[out] gamma  r*r for the updated r
+ * @param[out] delta  r*w for the updated r and w
+ */
+void updateVectors(double a, double beta, const base::DataVector& n, base::DataVector& z,
+                   base::DataVector& s, base::DataVector& p, base::DataVector& x,
+                   base::DataVector& r, base::DataVector& w, double& gamma, double& delta) {
+  const size_t size = x.getSize();
+  const double* nData = n.getPointer();
+  double* zData = z.getPointer();
+  double* sData = s.getPointer();
+  double* pData = p.getPointer();
+  double* xData = x.getPointer();
+  double* rData = r.getPointer();
+  double* wData = w.getPointer();
+  double rr = 0.0;
+  double rw = 0.0;
+
+#pragma omp parallel for simd schedule(static) reduction(+ : rr, rw) if (size >= MIN_PARALLEL_SIZE)
+  for (size_t i = 0; i < size; i++) {
+    zData[i] = nData[i] + beta * zData[i];
+    sData[i] = wData[i] + beta * sData[i];
+    pData[i] = rData[i] + beta * pData[i];
+    xData[i] += a * pData[i];
+    rData[i] -= a * sData[i];
+    wData[i] -= a * zData[i];
+    rr += rData[i] * rData[i];
+    rw += rData[i] * wData[i];
+  }
+
+  gamma = rr;
+  delta = rw;
+}
+
+}  // namespace
+
+PipelinedConjugateGradients::PipelinedConjugateGradients(size_t imax, double epsilon)
+    : SLESolver(imax, epsilon) {}
+
+PipelinedConjugateGradients::~PipelinedConjugateGradients() {}
+
+void PipelinedConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                                        sgpp::base::DataVector& alpha, sgpp::base::DataVector& b,
+                                        bool reuse, bool verbose, double max_threshold) {
+  if (alpha.getSize() != b.getSize()) {
+    throw sgpp::base::data_exception(
+        "PipelinedConjugateGradients::solve : Dimensions do not match");
+  }
+
+  if (verbose == true) {
+    std::cout << "Starting Pipelined Conjugated Gradients" << std::endl;
+  }
+
+  // needed for residuum calculation
+  const double epsilonSquared = this->myEpsilon * this->myEpsilon;
+  const size_t size = alpha.getSize();
+  this->nIterations = 0;
+
+  sgpp::base::DataVector r(b);
+  sgpp::base::DataVector w(size);
+  sgpp::base::DataVector n(size);
+  sgpp::base::DataVector z(size, 0.0);
+  sgpp::base::DataVector s(size, 0.0);
+  sgpp::base::DataVector p(size, 0.0);
+
+  double delta_0 = 0.0;
+
+  if (reuse == true) {
+    // residuum of the zero vector
+    delta_0 = b.dotProduct(b) * epsilonSquared;
+  } else {
+    alpha.setAll(0.0);
+  }
+
+  // r = b - A*x, w = A*r
+  SystemMatrix.mult(alpha, n);
+  r.sub(n);
+  SystemMatrix.mult(r, w);
+
+  double gamma = 0.0;
+  double delta = r.dotProductWithNorm(w, gamma);
+
+  if (reuse == false) {
+    delta_0 = gamma * epsilonSquared;
+  }
+
+  this->residuum = gamma;
+
+  if (verbose == true) {
+    std::cout << "Starting norm of residuum: " << gamma << std::endl;
+    std::cout << "Target norm:               " << delta_0 << std::endl;
+  }
+
+  double gamma_old = 0.0;
+  double a_old = 0.0;
+
+  while ((this->nIterations < this->nMaxIterations) && (gamma > delta_0) &&
+         (gamma > max_threshold)) {
+    // n = A*w, does not depend on the dot products of this iteration
+    SystemMatrix.mult(w, n);
+
+    double beta = 0.0;
+    double denominator = delta;
+
+    if (this->nIterations > 0) {
+      beta = gamma / gamma_old;
+      denominator = delta - beta * gamma / a_old;
+    }
+
+    if (denominator == 0.0) {
+      break;
+    }
+
+    const double a = gamma / denominator;
+    gamma_old = gamma;
+    a_old = a;
+
+    updateVectors(a, beta, n, z, s, p, alpha, r, w, gamma, delta);
+    this->nIterations++;
+
+    if ((this->nIterations % RESIDUAL_REPLACEMENT_PERIOD) == 0) {
+      // r = b - A*x, w = A*r, s = A*p, z = A*s
+      SystemMatrix.mult(alpha, n);
+      r.copyFrom(b);
+      r.sub(n);
+      SystemMatrix.mult(r, w);
+      SystemMatrix.mult(p, s);
+      SystemMatrix.mult(s, z);
+      delta = r.dotProductWithNorm(w, gamma);
+    }
+
+    this->residuum = gamma;
+
+    if (verbose == true) {
+      std::cout << "delta: " << gamma << std::endl;
+    }
+  }
+
+  this->residuum = gamma;
+
+  if (verbose == true) {
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Final norm of residuum: " << gamma << std::endl;
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
@@ -0,0 +1,60 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PIPELINEDCONJUGATEGRADIENTS_HPP
+#define PIPELINEDCONJUGATEGRADIENTS_HPP
+
+#include <sgpp/solver/SLESolver.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Pipelined conjugate gradient method (without preconditioning).
+ *
+ * In contrast to ConjugateGradients, the iteration is reformulated such that each iteration
+ * needs only one global reduction (the dot products \f$r \cdot r\f$ and \f$r \cdot w\f$ with
+ * \f$w = Ar\f$ are computed together), and the matrix-vector product of the iteration does not
+ * depend on the result of this reduction. Hence, the reduction can be overlapped with the
+ * matrix-vector product. Here, the reduction is fused with the vector updates of the previous
+ * iteration into a single parallel pass over the data, such that each iteration consists of one
+ * matrix-vector product and one synchronizing pass over the vectors.
+ *
+ * In exact arithmetic, the iterates are the same as those of ConjugateGradients. The recurrences
+ * accumulate more rounding errors, therefore the residual and the auxiliary vectors are
+ * recomputed from the current iterate every 50 iterations (residual replacement).
+ *
+ * Reference:
+ * P. Ghysels, W. Vanroose. Hiding global synchronization latency in the preconditioned
+ * Conjugate Gradient algorithm. Parallel Computing 40(7), 2014.
+ */
+class PipelinedConjugateGradients : public SLESolver {
+ public:
+  /**
+   * Std-Constructor
+   *
+   * @param imax      maximum number of iterations
+   * @param epsilon   relative accuracy (of the norm of the residual)
+   */
+  PipelinedConjugateGradients(size_t imax, double epsilon);
+
+  /**
+   * Std-Destructor
+   */
+  virtual ~PipelinedConjugateGradients();
+
+  virtual void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+                     sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
+                     double max_threshold = -1.0);
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* PIPELINEDCONJUGATEGRADIENTS_HPP */
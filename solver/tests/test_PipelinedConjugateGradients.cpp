@@ -0,0 +1,99 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/solver/SLESolverTypeParser.hpp>
+#include <sgpp/solver/TypesSolver.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+
+using sgpp::base::DataVector;
+
+namespace {
+
+/**
+ * Symmetric positive definite tridiagonal matrix tridiag(-1, diagonal, -1).
+ */
+class TridiagonalMatrix : public sgpp::base::OperationMatrix {
+ public:
+  explicit TridiagonalMatrix(double diagonal) : diagonal(diagonal) {}
+
+  void mult(DataVector& alpha, DataVector& result) override {
+    const size_t n = alpha.getSize();
+
+    for (size_t i = 0; i < n; i++) {
+      result[i] = diagonal * alpha[i];
+
+      if (i > 0) {
+        result[i] -= alpha[i - 1];
+      }
+
+      if (i + 1 < n) {
+        result[i] -= alpha[i + 1];
+      }
+    }
+  }
+
+ private:
+  double diagonal;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestPipelinedConjugateGradients)
+
+BOOST_AUTO_TEST_CASE(testSameSolutionAsCG) {
+  // a well-conditioned system that is large enough for the parallel vector updates and
+  // an ill-conditioned system that needs several residual replacements
+  for (const auto& system : {std::make_pair(static_cast<size_t>(30000), 2.5),
+                             std::make_pair(static_cast<size_t>(300), 2.0)}) {
+    const size_t n = system.first;
+    TridiagonalMatrix matrix(system.second);
+
+    DataVector solution(n);
+
+    for (size_t i = 0; i < n; i++) {
+      solution[i] = std::sin(0.01 * static_cast<double>(i)) + 1.0;
+    }
+
+    DataVector b(n);
+    matrix.mult(solution, b);
+
+    sgpp::solver::ConjugateGradients cg(2 * n, 1e-12);
+    sgpp::solver::PipelinedConjugateGradients pipelinedCG(2 * n, 1e-12);
+    DataVector alphaCG(n);
+    DataVector alphaPipelinedCG(n);
+    cg.solve(matrix, alphaCG, b);
+    pipelinedCG.solve(matrix, alphaPipelinedCG, b);
+
+    BOOST_CHECK_GT(pipelinedCG.getNumberIterations(), 0);
+    BOOST_CHECK_LE(pipelinedCG.getNumberIterations(), cg.getNumberIterations() + 5);
+    BOOST_CHECK_LE(pipelinedCG.getResiduum(), 1e-24 * b.dotProduct(b));
+
+    for (size_t i = 0; i < n; i++) {
+      BOOST_CHECK_SMALL(alphaPipelinedCG[i] - solution[i], 1e-8);
+      BOOST_CHECK_SMALL(alphaPipelinedCG[i] - alphaCG[i], 1e-8);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testParser) {
+  BOOST_CHECK(sgpp::solver::SLESolverTypeParser::parse("PipelinedCG") ==
+              sgpp::solver::SLESolverType::PipelinedCG);
+  BOOST_CHECK_EQUAL(
+      sgpp::solver::SLESolverTypeParser::toString(sgpp::solver::SLESolverType::PipelinedCG),
+      "PipelinedCG");
+}
+
+BOOST_AUTO_TEST_SUITE_END()